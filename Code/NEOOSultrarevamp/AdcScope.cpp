@@ -0,0 +1,312 @@
+#include "AdcScope.h"
+#include "Log.h"
+#include "Scheduler.h"
+
+#if !defined(ARDUINO)
+#include "HostHal.h"
+#endif
+
+// On the ESP32 the IDF continuous ADC driver runs the conversions and
+// the DMA; the Arduino analogContinuous() API averages each frame, which
+// would hide the spikes the min/max columns are for. The host converts
+// its analog signal at the sample rate in virtual time, with the
+// driver's bounded pool. Other boards have no continuous ADC.
+#if defined(ARDUINO_ARCH_ESP32)
+#include "esp_adc/adc_continuous.h"
+
+static_assert(SOC_ADC_DIGI_RESULT_BYTES == sizeof(uint32_t), "SCOPE_SAMPLE() reads type 2 results");
+
+static adc_continuous_handle_t adcHandle = nullptr;
+static volatile uint32_t poolOverflows = 0;
+
+static bool IRAM_ATTR onPoolOverflow(adc_continuous_handle_t, const adc_continuous_evt_data_t*, void*) {
+  poolOverflows++;
+  return false;
+}
+#else
+static uint32_t poolOverflows = 0;
+#if !defined(ARDUINO)
+static double nextSampleUs = 0;  // virtual time of the next conversion
+#endif
+#endif
+
+AdcScope adcScope;
+
+// Per division; each is a whole number of samples per column
+static const uint32_t timebases[] = {200, 1000, 2000, 5000, 10000, 20000, 50000, 100000};
+
+#define TIMEBASE_COUNT (sizeof(timebases) / sizeof(timebases[0]))
+
+void scopeDecimatorReset(ScopeDecimator& state, uint32_t perColumn) {
+  state.perColumn = perColumn > 0 ? perColumn : 1;
+  state.filled = 0;
+  state.low = SCOPE_MAX_VALUE;
+  state.high = 0;
+}
+
+// The inner loop runs a column's worth of samples at a time with the
+// extremes in registers and no branches, the outer one only handles
+// column and buffer boundaries
+size_t scopeDecimate(ScopeDecimator& state, const uint32_t* words, size_t count, ScopeColumn* out, size_t room,
+                     size_t& columns) {
+  size_t used = 0;
+  uint32_t low = state.low;
+  uint32_t high = state.high;
+  columns = 0;
+  while (used < count && columns < room) {
+    size_t take = min<size_t>(count - used, state.perColumn - state.filled);
+    const uint32_t* word = words + used;
+    for (size_t i = 0; i < take; i++) {
+      uint32_t value = SCOPE_SAMPLE(word[i]);
+      low = value < low ? value : low;
+      high = value > high ? value : high;
+    }
+    used += take;
+    state.filled += take;
+    if (state.filled == state.perColumn) {
+      out[columns].low = low;
+      out[columns].high = high;
+      columns++;
+      low = SCOPE_MAX_VALUE;
+      high = 0;
+      state.filled = 0;
+    }
+  }
+  state.low = low;
+  state.high = high;
+  return used;
+}
+
+int scopeFindTrigger(const uint32_t* words, size_t count, uint16_t level, bool& armed) {
+  uint16_t rearm = level > SCOPE_TRIGGER_HYSTERESIS ? level - SCOPE_TRIGGER_HYSTERESIS : 0;
+  for (size_t i = 0; i < count; i++) {
+    uint16_t value = SCOPE_SAMPLE(words[i]);
+    if (value < rearm) {
+      armed = true;
+    } else if (armed && value >= level) {
+      armed = false;
+      return (int)i;
+    }
+  }
+  return -1;
+}
+
+AdcScope::AdcScope()
+  : front(0), filled(0), running(false), sweeping(false), armed(false), triggered(false), frontTriggered(false),
+    held(false), waited(0), timebase(1), level(SCOPE_MAX_VALUE / 2), sweepCount(0) {
+  memset(sweeps, 0, sizeof(sweeps));
+  scopeDecimatorReset(decimator, 1);
+}
+
+bool AdcScope::start() {
+  stop();
+#if defined(ARDUINO_ARCH_ESP32)
+  adc_unit_t unit;
+  adc_channel_t channel;
+  if (adc_continuous_io_to_channel(SCOPE_PIN, &unit, &channel) != ESP_OK || unit != ADC_UNIT_1) {
+    return false;
+  }
+  adc_continuous_handle_cfg_t handleConfig = {};
+  handleConfig.max_store_buf_size = SCOPE_POOL_FRAMES * sizeof(frame);
+  handleConfig.conv_frame_size = sizeof(frame);
+  if (adc_continuous_new_handle(&handleConfig, &adcHandle) != ESP_OK) {
+    adcHandle = nullptr;
+    return false;
+  }
+  adc_digi_pattern_config_t pattern = {};
+  pattern.atten = ADC_ATTEN_DB_11;
+  pattern.channel = channel;
+  pattern.unit = unit;
+  pattern.bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+  adc_continuous_config_t config = {};
+  config.pattern_num = 1;
+  config.adc_pattern = &pattern;
+  config.sample_freq_hz = SCOPE_SAMPLE_RATE;
+  config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+  adc_continuous_evt_cbs_t callbacks = {};
+  callbacks.on_pool_ovf = onPoolOverflow;
+  if (adc_continuous_config(adcHandle, &config) != ESP_OK ||
+      adc_continuous_register_event_callbacks(adcHandle, &callbacks, nullptr) != ESP_OK ||
+      adc_continuous_start(adcHandle) != ESP_OK) {
+    adc_continuous_deinit(adcHandle);
+    adcHandle = nullptr;
+    return false;
+  }
+#elif !defined(ARDUINO)
+  nextSampleUs = hostHal.now();
+#endif
+  poolOverflows = 0;
+  sweepCount = 0;
+  running = true;
+  setTimebase(timebase);
+  return true;
+}
+
+void AdcScope::stop() {
+#if defined(ARDUINO_ARCH_ESP32)
+  if (adcHandle != nullptr) {
+    adc_continuous_stop(adcHandle);
+    adc_continuous_deinit(adcHandle);
+    adcHandle = nullptr;
+  }
+#endif
+  running = false;
+}
+
+bool AdcScope::isRunning() const {
+  return running;
+}
+
+uint32_t AdcScope::step() {
+  if (!running) {
+    return TASK_STOP;
+  }
+  // A pool's worth at most, so a long stall can't keep the task here
+  for (uint8_t i = 0; i <= SCOPE_POOL_FRAMES; i++) {
+    size_t count = readFrame();
+    if (count == 0) {
+      break;
+    }
+    consume(frame, count);
+  }
+  return SCOPE_POLL_INTERVAL;
+}
+
+size_t AdcScope::readFrame() {
+#if defined(ARDUINO_ARCH_ESP32)
+  uint32_t length = 0;
+  if (adc_continuous_read(adcHandle, reinterpret_cast<uint8_t*>(frame), sizeof(frame), &length, 0) != ESP_OK) {
+    return 0;
+  }
+  return length / sizeof(frame[0]);
+#elif defined(ARDUINO)
+  // Back-to-back conversions, so the timebase is only nominal here
+  for (size_t i = 0; i < SCOPE_FRAME_SAMPLES; i++) {
+    frame[i] = analogRead(SCOPE_PIN);
+  }
+  return SCOPE_FRAME_SAMPLES;
+#else
+  const double period = 1000000.0 / SCOPE_SAMPLE_RATE;
+  double now = hostHal.now();
+  if (nextSampleUs > now) {
+    return 0;
+  }
+  size_t due = (size_t)((now - nextSampleUs) / period) + 1;
+  if (due < SCOPE_FRAME_SAMPLES) {
+    return 0;  // the driver hands out whole frames
+  }
+  // Whole frames the pool had no room for are lost, as on the device
+  size_t pool = SCOPE_POOL_FRAMES * SCOPE_FRAME_SAMPLES;
+  if (due > pool) {
+    size_t lost = (due - pool + SCOPE_FRAME_SAMPLES - 1) / SCOPE_FRAME_SAMPLES;
+    poolOverflows += lost;
+    nextSampleUs += lost * SCOPE_FRAME_SAMPLES * period;
+  }
+  for (size_t i = 0; i < SCOPE_FRAME_SAMPLES; i++) {
+    frame[i] = hostHal.analogAt(SCOPE_PIN, nextSampleUs);
+    nextSampleUs += period;
+  }
+  return SCOPE_FRAME_SAMPLES;
+#endif
+}
+
+void AdcScope::beginSweep(bool onTrigger) {
+  scopeDecimatorReset(decimator, (uint64_t)timebases[timebase] * SCOPE_SAMPLE_RATE / 1000000UL / SCOPE_DIV_COLUMNS);
+  filled = 0;
+  sweeping = true;
+  triggered = onTrigger;
+}
+
+void AdcScope::consume(const uint32_t* words, size_t count) {
+  while (count > 0) {
+    if (!sweeping) {
+      int at = scopeFindTrigger(words, count, level, armed);
+      uint32_t limit = SCOPE_COLUMNS * decimator.perColumn + SCOPE_AUTO_HOLDOFF;
+      if (at < 0 && waited + count < limit) {
+        waited += count;
+        return;
+      }
+      // Without a trigger the sweep starts where the holdoff ran out
+      size_t skip = at >= 0 ? (size_t)at : limit - waited;
+      beginSweep(at >= 0);
+      words += skip;
+      count -= skip;
+    }
+    size_t columns;
+    ScopeColumn* back = sweeps[front ^ 1];
+    size_t used = scopeDecimate(decimator, words, count, back + filled, SCOPE_COLUMNS - filled, columns);
+    filled += columns;
+    words += used;
+    count -= used;
+    if (filled == SCOPE_COLUMNS) {
+      if (!held) {
+        front ^= 1;
+        frontTriggered = triggered;
+      }
+      sweepCount++;
+      sweeping = false;
+      armed = false;
+      waited = 0;
+      filled = 0;
+    }
+  }
+}
+
+uint8_t AdcScope::getTimebaseCount() {
+  return TIMEBASE_COUNT;
+}
+
+uint32_t AdcScope::getTimebaseUs(uint8_t index) {
+  return timebases[index < TIMEBASE_COUNT ? index : 0];
+}
+
+// The sweep in progress is dropped; the next one uses the new timebase
+void AdcScope::setTimebase(uint8_t index) {
+  timebase = index < TIMEBASE_COUNT ? index : 0;
+  beginSweep(false);
+  sweeping = false;
+  armed = false;
+  waited = 0;
+}
+
+uint8_t AdcScope::getTimebase() const {
+  return timebase;
+}
+
+void AdcScope::setTriggerLevel(uint16_t value) {
+  level = min<uint16_t>(value, SCOPE_MAX_VALUE);
+}
+
+uint16_t AdcScope::getTriggerLevel() const {
+  return level;
+}
+
+void AdcScope::setHold(bool hold) {
+  held = hold;
+}
+
+bool AdcScope::isHeld() const {
+  return held;
+}
+
+const ScopeColumn* AdcScope::getSweep() const {
+  return sweeps[front];
+}
+
+const ScopeColumn* AdcScope::getProgress(uint16_t& columns) const {
+  columns = held ? 0 : filled;
+  return sweeps[front ^ 1];
+}
+
+bool AdcScope::wasTriggered() const {
+  return frontTriggered;
+}
+
+uint32_t AdcScope::getSweeps() const {
+  return sweepCount;
+}
+
+uint32_t AdcScope::getOverflows() const {
+  return poolOverflows;
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#ifndef ADC_SCOPE_H
+#define ADC_SCOPE_H
+
+#include <Arduino.h>
+
+// ADC1 channel 0; the other ADC1 pins are buttons or the IR LED
+#define SCOPE_PIN 0
+
+#define SCOPE_SAMPLE_RATE 80000    // Hz, near the C3's 83.3 kHz continuous limit
+#define SCOPE_FRAME_SAMPLES 256    // per DMA conversion frame, 3.2 ms
+#define SCOPE_POOL_FRAMES 8        // 25.6 ms held for the task, longer than a full-screen flush
+#define SCOPE_POLL_INTERVAL 2      // ms between drains of the DMA pool
+#define SCOPE_COLUMNS 128          // one sweep, the display's width
+#define SCOPE_DIV_COLUMNS 16       // columns per timebase division
+#define SCOPE_MAX_VALUE 4095       // 12-bit conversions
+#define SCOPE_FULL_SCALE_MV 2500   // at 11 dB attenuation, uncalibrated
+#define SCOPE_TRIGGER_HYSTERESIS 64
+#define SCOPE_AUTO_HOLDOFF 4000    // samples past a sweep's worth without trigger before auto sweeps
+
+// The sample in a C3 DMA result word (type 2: data in bits 0-11)
+#define SCOPE_SAMPLE(word) ((uint16_t)((word) & 0xFFF))
+
+// Lowest and highest sample that went into one screen column
+struct ScopeColumn {
+  uint16_t low;
+  uint16_t high;
+};
+
+// Where scopeDecimate() is inside the column it is filling
+struct ScopeDecimator {
+  uint32_t perColumn;  // samples per column
+  uint32_t filled;     // samples of the current column so far
+  uint16_t low;
+  uint16_t high;
+};
+
+void scopeDecimatorReset(ScopeDecimator& state, uint32_t perColumn);
+
+// Folds DMA result words into columns of perColumn samples each,
+// keeping each column's min and max so a spike one sample wide still
+// shows. Stops once room columns are out. Returns the words used;
+// columns gets the number of columns completed.
+size_t scopeDecimate(ScopeDecimator& state, const uint32_t* words, size_t count, ScopeColumn* out, size_t room,
+                     size_t& columns);
+
+// Index of the first sample that rises through level, having been below
+// level - SCOPE_TRIGGER_HYSTERESIS first, or -1. armed carries that
+// across calls.
+int scopeFindTrigger(const uint32_t* words, size_t count, uint16_t level, bool& armed);
+
+// Oscilloscope on SCOPE_PIN. The ADC converts continuously into DMA
+// frames without the CPU; each step drains the frames that are done
+// and folds them into min/max columns. Sweeps are double buffered: the
+// display reads the last whole sweep while the next fills the other,
+// and a sweep starts on a rising crossing of the trigger level, or
+// without one once the auto holdoff has passed.
+class AdcScope {
+  public:
+    AdcScope();
+
+    bool start();  // false if the ADC can't be set up
+    void stop();
+    bool isRunning() const;
+    // Drains the DMA pool; returns ms until it needs to run again
+    uint32_t step();
+
+    static uint8_t getTimebaseCount();
+    static uint32_t getTimebaseUs(uint8_t index);  // per division
+    void setTimebase(uint8_t index);
+    uint8_t getTimebase() const;
+    void setTriggerLevel(uint16_t level);
+    uint16_t getTriggerLevel() const;
+    void setHold(bool held);  // keeps the last sweep on screen
+    bool isHeld() const;
+
+    const ScopeColumn* getSweep() const;  // last complete sweep, SCOPE_COLUMNS
+    // The sweep being filled; columns gets how far it is
+    const ScopeColumn* getProgress(uint16_t& columns) const;
+    bool wasTriggered() const;  // the last sweep started on the trigger
+    uint32_t getSweeps() const;
+    uint32_t getOverflows() const;  // DMA frames lost before the task read them
+
+  private:
+    ScopeColumn sweeps[2][SCOPE_COLUMNS];
+    uint8_t front;    // sweeps[front] is complete
+    uint16_t filled;  // columns of sweeps[front ^ 1]
+    ScopeDecimator decimator;
+    bool running;
+    bool sweeping;    // else waiting for the trigger
+    bool armed;
+    bool triggered;   // the sweep being filled
+    bool frontTriggered;
+    bool held;
+    uint32_t waited;  // samples without trigger
+    uint8_t timebase;
+    uint16_t level;
+    uint32_t sweepCount;
+    uint32_t frame[SCOPE_FRAME_SAMPLES];
+
+    size_t readFrame();  // DMA results ready, into frame
+    void consume(const uint32_t* words, size_t count);
+    void beginSweep(bool onTrigger);
+};
+
+extern AdcScope adcScope;
+
+#endif
\ No newline at end of file
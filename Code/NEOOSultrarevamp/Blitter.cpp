@@ -0,0 +1,300 @@
+#include "Blitter.h"
+
+// Word stores into the byte buffer; may_alias keeps them from being
+// reordered around the byte accesses to the same memory
+typedef uint32_t __attribute__((__may_alias__)) BlitWord;
+
+// Upper-left quarter circles, one mask per column from the left edge,
+// bit n being row n from the top. Filled on first use by the same
+// midpoint stepping u8g2 draws circles with.
+static uint16_t cornerMasks[BLIT_MAX_RADIUS + 1][BLIT_MAX_RADIUS + 1];
+static bool cornersReady = false;
+
+static void buildCorners() {
+  for (int r = 0; r <= BLIT_MAX_RADIUS; r++) {
+    int f = 1 - r;
+    int ddFx = 1;
+    int ddFy = -2 * r;
+    int x = 0;
+    int y = r;
+    for (;;) {
+      // u8g2 plots (x0 - x, y0 - y) and (x0 - y, y0 - x)
+      cornerMasks[r][r - x] |= 1 << (r - y);
+      cornerMasks[r][r - y] |= 1 << (r - x);
+      if (x >= y) {
+        break;
+      }
+      if (f >= 0) {
+        y--;
+        ddFy += 2;
+        f += ddFy;
+      }
+      x++;
+      ddFx += 2;
+      f += ddFx;
+    }
+  }
+  cornersReady = true;
+}
+
+static uint16_t reverseRows(uint16_t mask, int rows) {
+  uint16_t reversed = 0;
+  for (int i = 0; i < rows; i++) {
+    if (mask & (1 << i)) {
+      reversed |= 1 << (rows - 1 - i);
+    }
+  }
+  return reversed;
+}
+
+// ORs bits into row[left, right), four bytes at a time once aligned
+static void orSpan(uint8_t* row, int left, int right, uint8_t bits) {
+  uint8_t* cell = row + left;
+  uint8_t* end = row + right;
+  while (cell < end && ((uintptr_t)cell & 3) != 0) {
+    *cell++ |= bits;
+  }
+  uint32_t word = bits * 0x01010101UL;
+  for (; cell + 4 <= end; cell += 4) {
+    *(BlitWord*)cell |= word;
+  }
+  while (cell < end) {
+    *cell++ |= bits;
+  }
+}
+
+// Page holding row y and the row's bit in it, for negative y as well
+static inline int pageOf(int y) {
+  return y >= 0 ? y / 8 : -((7 - y) / 8);
+}
+
+// One column: ink ORed in after cover is cleared, both starting at row top
+static void blitColumn(uint8_t* buffer, int x, int top, uint32_t ink, uint32_t cover) {
+  if (x < 0 || x >= DISPLAY_WIDTH) {
+    return;
+  }
+  int page = pageOf(top);
+  int shift = top - page * 8;
+  uint64_t inkBits = (uint64_t)ink << shift;
+  uint64_t coverBits = (uint64_t)cover << shift;
+  for (; page < DISPLAY_PAGES && (inkBits | coverBits) != 0; page++) {
+    if (page >= 0) {
+      uint8_t* cell = buffer + page * DISPLAY_WIDTH + x;
+      *cell = (*cell & ~(uint8_t)coverBits) | (uint8_t)inkBits;
+    }
+    inkBits >>= 8;
+    coverBits >>= 8;
+  }
+}
+
+void blitHLine(uint8_t* buffer, int x, int y, int width) {
+  if (y < 0 || y >= DISPLAY_HEIGHT) {
+    return;
+  }
+  int left = max(x, 0);
+  int right = min(x + width, DISPLAY_WIDTH);
+  if (left < right) {
+    orSpan(buffer + (y >> 3) * DISPLAY_WIDTH, left, right, 1 << (y & 7));
+  }
+}
+
+void blitVLine(uint8_t* buffer, int x, int y, int height) {
+  blitBox(buffer, x, y, 1, height);
+}
+
+void blitBox(uint8_t* buffer, int x, int y, int width, int height) {
+  int left = max(x, 0);
+  int right = min(x + width, DISPLAY_WIDTH);
+  int top = max(y, 0);
+  int bottom = min(y + height, DISPLAY_HEIGHT);
+  if (left >= right || top >= bottom) {
+    return;
+  }
+  for (int page = top >> 3; page <= (bottom - 1) >> 3; page++) {
+    int first = max(top, page * 8) & 7;
+    int last = min(bottom - 1, page * 8 + 7) & 7;
+    uint8_t bits = (0xFF << first) & (0xFF >> (7 - last));
+    orSpan(buffer + page * DISPLAY_WIDTH, left, right, bits);
+  }
+}
+
+bool blitRFrame(uint8_t* buffer, int x, int y, int width, int height, int radius) {
+  if (radius < 0 || radius > BLIT_MAX_RADIUS || width < 2 * radius + 1 || height < 2 * radius + 1) {
+    return false;
+  }
+  if (!cornersReady) {
+    buildCorners();
+  }
+  int xl = x + radius;
+  int yu = y + radius;
+  int xr = x + width - radius - 1;
+  int yl = y + height - radius - 1;
+  const uint16_t* corner = cornerMasks[radius];
+  for (int i = 0; i <= radius; i++) {
+    uint16_t lower = reverseRows(corner[i], radius + 1);
+    blitColumn(buffer, x + i, y, corner[i], 0);
+    blitColumn(buffer, xr + radius - i, y, corner[i], 0);
+    blitColumn(buffer, x + i, yl, lower, 0);
+    blitColumn(buffer, xr + radius - i, yl, lower, 0);
+  }
+
+  int ww = width - 2 * radius;
+  int hh = height - 2 * radius;
+  if (ww >= 3) {
+    blitHLine(buffer, xl + 1, y, ww - 2);
+    blitHLine(buffer, xl + 1, y + height - 1, ww - 2);
+  }
+  if (hh >= 3) {
+    blitVLine(buffer, x, yu + 1, hh - 2);
+    blitVLine(buffer, x + width - 1, yu + 1, hh - 2);
+  }
+  return true;
+}
+
+void blitGlyph(uint8_t* buffer, int x, int y, const BlitGlyph& glyph) {
+  int top = y + glyph.top;
+  if (glyph.width == 0 || top >= DISPLAY_HEIGHT || top + glyph.height <= 0) {
+    return;
+  }
+  uint32_t cover = 0;
+  if (glyph.solid) {
+    cover = glyph.height >= 32 ? 0xFFFFFFFFUL : (1UL << glyph.height) - 1;
+  }
+  int left = x + glyph.x;
+  for (uint8_t i = 0; i < glyph.width; i++) {
+    blitColumn(buffer, left + i, top, glyph.columns[i], cover);
+  }
+}
+
+// u8g2 font format: a 23-byte header, then glyphs of an encoding byte,
+// the offset to the next glyph and a bit stream of the glyph's box,
+// offsets and advance followed by run lengths of background and ink,
+// row by row. Read LSB first as u8g2_font_decode_get_unsigned_bits() does.
+#define FONT_HEADER_SIZE 23
+#define FONT_BITS_PER_0 2
+#define FONT_BITS_PER_1 3
+#define FONT_BITS_PER_WIDTH 4
+#define FONT_BITS_PER_HEIGHT 5
+#define FONT_BITS_PER_X 6
+#define FONT_BITS_PER_Y 7
+#define FONT_BITS_PER_DELTA 8
+#define FONT_MAX_WIDTH 9
+#define FONT_MAX_HEIGHT 10
+#define FONT_START_UPPER_A 17
+#define FONT_START_LOWER_A 19
+
+struct FontBits {
+  const uint8_t* data;
+  uint8_t bit;
+};
+
+static uint8_t readBits(FontBits& bits, uint8_t count) {
+  uint8_t value = u8x8_pgm_read(bits.data) >> bits.bit;
+  uint8_t end = bits.bit + count;
+  if (end >= 8) {
+    bits.data++;
+    value |= u8x8_pgm_read(bits.data) << (8 - bits.bit);
+    end -= 8;
+  }
+  bits.bit = end;
+  return value & ((1U << count) - 1);
+}
+
+static int8_t readSignedBits(FontBits& bits, uint8_t count) {
+  return (int8_t)(readBits(bits, count) - (1 << (count - 1)));
+}
+
+static const uint8_t* findGlyph(const uint8_t* font, uint8_t encoding) {
+  const uint8_t* glyph = font + FONT_HEADER_SIZE;
+  if (encoding >= 'a') {
+    glyph += (u8x8_pgm_read(font + FONT_START_LOWER_A) << 8) | u8x8_pgm_read(font + FONT_START_LOWER_A + 1);
+  } else if (encoding >= 'A') {
+    glyph += (u8x8_pgm_read(font + FONT_START_UPPER_A) << 8) | u8x8_pgm_read(font + FONT_START_UPPER_A + 1);
+  }
+  for (;;) {
+    uint8_t next = u8x8_pgm_read(glyph + 1);
+    if (next == 0) {
+      return nullptr;
+    }
+    if (u8x8_pgm_read(glyph) == encoding) {
+      return glyph + 2;
+    }
+    glyph += next;
+  }
+}
+
+bool blitFontSupported(const uint8_t* font) {
+  return font != nullptr && u8x8_pgm_read(font + FONT_MAX_WIDTH) <= BLIT_MAX_GLYPH_WIDTH &&
+         u8x8_pgm_read(font + FONT_MAX_HEIGHT) <= BLIT_MAX_GLYPH_HEIGHT;
+}
+
+void blitDecodeGlyph(const uint8_t* font, uint8_t encoding, BlitGlyph& glyph) {
+  glyph.x = 0;
+  glyph.top = 0;
+  glyph.width = 0;
+  glyph.height = 0;
+  glyph.advance = 0;
+  // DisplayManager leaves u8g2 in font mode 0, which paints the box
+  glyph.solid = true;
+  const uint8_t* data = findGlyph(font, encoding);
+  if (data == nullptr) {
+    return;
+  }
+  FontBits bits = {data, 0};
+  uint8_t width = readBits(bits, u8x8_pgm_read(font + FONT_BITS_PER_WIDTH));
+  uint8_t height = readBits(bits, u8x8_pgm_read(font + FONT_BITS_PER_HEIGHT));
+  int8_t x = readSignedBits(bits, u8x8_pgm_read(font + FONT_BITS_PER_X));
+  int8_t y = readSignedBits(bits, u8x8_pgm_read(font + FONT_BITS_PER_Y));
+  glyph.advance = readSignedBits(bits, u8x8_pgm_read(font + FONT_BITS_PER_DELTA));
+  if (width == 0) {
+    return;
+  }
+  glyph.x = x;
+  glyph.top = -(height + y);
+  glyph.width = width;
+  glyph.height = height;
+  memset(glyph.columns, 0, width * sizeof(glyph.columns[0]));
+
+  // Runs wrap from the end of one row to the start of the next
+  uint8_t bitsPer0 = u8x8_pgm_read(font + FONT_BITS_PER_0);
+  uint8_t bitsPer1 = u8x8_pgm_read(font + FONT_BITS_PER_1);
+  unsigned column = 0;
+  unsigned row = 0;
+  while (row < height) {
+    uint8_t background = readBits(bits, bitsPer0);
+    uint8_t ink = readBits(bits, bitsPer1);
+    do {
+      column += background;
+      while (column >= width) {
+        column -= width;
+        row++;
+      }
+      for (uint8_t i = 0; i < ink; i++) {
+        if (row < BLIT_MAX_GLYPH_HEIGHT) {
+          glyph.columns[column] |= 1UL << row;
+        }
+        if (++column == width) {
+          column = 0;
+          row++;
+        }
+      }
+    } while (readBits(bits, 1) != 0);
+  }
+}
+
+// u8g2 ends a string at a newline
+size_t blitStrLength(const char* text) {
+  return strcspn(text, "\n");
+}
+
+int blitStr(uint8_t* buffer, const uint8_t* font, int x, int y, const char* text) {
+  BlitGlyph glyph;
+  int width = 0;
+  size_t length = blitStrLength(text);
+  for (size_t i = 0; i < length; i++) {
+    blitDecodeGlyph(font, (uint8_t)text[i], glyph);
+    blitGlyph(buffer, x + width, y, glyph);
+    width += glyph.advance;
+  }
+  return width;
+}
\ No newline at end of file
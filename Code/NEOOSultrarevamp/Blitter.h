@@ -0,0 +1,52 @@
+#ifndef BLITTER_H
+#define BLITTER_H
+
+#include <Arduino.h>
+#include "Display.h"
+
+// Drawing straight into a framebuffer in SSD1306 page layout, for the
+// shapes the menus draw every frame. A horizontal run is the same bit in
+// consecutive bytes of one page, so it is ORed in four bytes at a time;
+// vertical runs and glyphs are whole byte-columns ORed into each page.
+// Everything draws in u8g2 draw color 1 and clips to the display.
+
+#define BLIT_MAX_RADIUS 8         // largest rounded corner with a precomputed mask
+#define BLIT_MAX_GLYPH_WIDTH 24   // columns in a BlitGlyph
+#define BLIT_MAX_GLYPH_HEIGHT 32  // rows, one bit each in a column word
+
+// One glyph as column words: bit n of columns[i] is row top + n of
+// column x + i, both relative to the pen position on the baseline
+struct BlitGlyph {
+  int8_t x;
+  int8_t top;
+  uint8_t width;
+  uint8_t height;
+  int8_t advance;
+  bool solid;  // the width x height box behind the ink is cleared
+  uint32_t columns[BLIT_MAX_GLYPH_WIDTH];
+};
+
+void blitHLine(uint8_t* buffer, int x, int y, int width);
+void blitVLine(uint8_t* buffer, int x, int y, int height);
+void blitBox(uint8_t* buffer, int x, int y, int width, int height);
+
+// u8g2's drawRFrame() pixel for pixel; false (nothing drawn) when the
+// radius has no corner mask or the frame is too small for its corners
+bool blitRFrame(uint8_t* buffer, int x, int y, int width, int height, int radius);
+
+// Whether every glyph of the font fits a BlitGlyph
+bool blitFontSupported(const uint8_t* font);
+
+// Rasterises one glyph of a supported font. A glyph the font lacks
+// comes out empty with the advance u8g2 gives it.
+void blitDecodeGlyph(const uint8_t* font, uint8_t encoding, BlitGlyph& glyph);
+void blitGlyph(uint8_t* buffer, int x, int y, const BlitGlyph& glyph);
+
+// u8g2's drawStr() with the baseline at y, for a supported font.
+// Returns the advance, as drawStr() does.
+int blitStr(uint8_t* buffer, const uint8_t* font, int x, int y, const char* text);
+
+// Characters of text that blitStr() draws
+size_t blitStrLength(const char* text);
+
+#endif
\ No newline at end of file
@@ -1,58 +1,210 @@
-#include "ButtonHandler.h"
-#include "MenuSystem.h"
-
-ButtonHandler::ButtonHandler() : lastButtonPress(0) {
-  // Constructor
-}
-
-void ButtonHandler::init() {
-  // Initialize buttons with internal pullup
-  pinMode(BUTTON_A, INPUT_PULLUP);
-  pinMode(BUTTON_B, INPUT_PULLUP);
-  pinMode(BUTTON_LEFT, INPUT_PULLUP);
-  pinMode(BUTTON_RIGHT, INPUT_PULLUP);
-  pinMode(BUTTON_UP, INPUT_PULLUP);
-  pinMode(BUTTON_DOWN, INPUT_PULLUP);
-}
-
-bool ButtonHandler::isButtonPressed(uint8_t pin) {
-  if (!digitalRead(pin)) {
-    if (millis() - lastButtonPress > DEBOUNCE_DELAY) {
-      lastButtonPress = millis();
-      return true;
-    }
-  }
-  return false;
-}
-
-void ButtonHandler::checkButtons(MenuSystem* menuSystem) {
-  // Check A button (selection)
-  if (isButtonPressed(BUTTON_A)) {
-    menuSystem->handleSelectButton();
-  }
-  
-  // Check B button for going back
-  if (isButtonPressed(BUTTON_B)) {
-    menuSystem->handleBackButton();
-  }
-  
-  // Check left button
-  if (isButtonPressed(BUTTON_LEFT)) {
-    menuSystem->handleLeftButton();
-  }
-  
-  // Check right button
-  if (isButtonPressed(BUTTON_RIGHT)) {
-    menuSystem->handleRightButton();
-  }
-  
-  // Check UP button
-  if (isButtonPressed(BUTTON_UP)) {
-    menuSystem->handleUpButton();
-  }
-  
-  // Check DOWN button
-  if (isButtonPressed(BUTTON_DOWN)) {
-    menuSystem->handleDownButton();
-  }
+#include "ButtonHandler.h"
+#include "MenuSystem.h"
+
+// Every push into the event ring happens either in the pin-change ISR or
+// with that ISR masked, so the ring only ever sees one producer at a time.
+#if defined(ARDUINO_ARCH_ESP32)
+#include <driver/gpio.h>
+static portMUX_TYPE buttonMux = portMUX_INITIALIZER_UNLOCKED;
+#define BUTTON_ISR_ATTR IRAM_ATTR
+#define BUTTON_LOCK() portENTER_CRITICAL(&buttonMux)
+#define BUTTON_UNLOCK() portEXIT_CRITICAL(&buttonMux)
+#define BUTTON_LOCK_ISR() portENTER_CRITICAL_ISR(&buttonMux)
+#define BUTTON_UNLOCK_ISR() portEXIT_CRITICAL_ISR(&buttonMux)
+#else
+#define BUTTON_ISR_ATTR
+#define BUTTON_LOCK() noInterrupts()
+#define BUTTON_UNLOCK() interrupts()
+#define BUTTON_LOCK_ISR()
+#define BUTTON_UNLOCK_ISR()
+#endif
+
+ButtonHandler* ButtonHandler::instance = nullptr;
+
+static const uint8_t buttonPins[ButtonHandler::BUTTON_COUNT] = {
+  ButtonHandler::BUTTON_A, ButtonHandler::BUTTON_B,
+  ButtonHandler::BUTTON_LEFT, ButtonHandler::BUTTON_RIGHT,
+  ButtonHandler::BUTTON_UP, ButtonHandler::BUTTON_DOWN
+};
+
+ButtonHandler::ButtonHandler() : droppedEvents(0) {
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    pinStates[i].pin = buttonPins[i];
+    pinStates[i].down = false;
+    pinStates[i].lastEdge = 0;
+    pinStates[i].masked = false;
+    pinStates[i].held = false;
+    pinStates[i].longSent = false;
+    pinStates[i].pressedAt = 0;
+    pinStates[i].nextRepeat = 0;
+  }
+}
+
+template <uint8_t index>
+void BUTTON_ISR_ATTR ButtonHandler::onPinChange() {
+  BUTTON_LOCK_ISR();
+  instance->handleEdge(index, micros());
+  BUTTON_UNLOCK_ISR();
+}
+
+void ButtonHandler::init() {
+  instance = this;
+
+  // Initialize buttons with internal pullup
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    pinMode(pinStates[i].pin, INPUT_PULLUP);
+    pinStates[i].down = !digitalRead(pinStates[i].pin);
+    pinStates[i].held = pinStates[i].down;
+  }
+
+  attachInterrupt(digitalPinToInterrupt(BUTTON_A), onPinChange<0>, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(BUTTON_B), onPinChange<1>, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(BUTTON_LEFT), onPinChange<2>, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(BUTTON_RIGHT), onPinChange<3>, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(BUTTON_UP), onPinChange<4>, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(BUTTON_DOWN), onPinChange<5>, CHANGE);
+}
+
+// Runs in the ISR, or from settlePins() with the ISR masked
+void BUTTON_ISR_ATTR ButtonHandler::handleEdge(uint8_t index, uint32_t now) {
+  PinState& state = pinStates[index];
+  if (state.masked) {
+    return;
+  }
+
+  if (now - state.lastEdge >= DEBOUNCE_DELAY * 1000UL) {
+    bool down = !digitalRead(state.pin);
+    if (down != state.down) {
+      state.down = down;
+      state.lastEdge = now;
+
+      ButtonEvent event;
+      event.pin = state.pin;
+      event.type = down ? BUTTON_PRESS : BUTTON_RELEASE;
+      event.timestamp = now;
+      if (!events.push(event)) {
+        droppedEvents++;
+      }
+    }
+  }
+}
+
+// An edge that lands inside a lockout window is ignored by the ISR; once
+// the window has passed, compare the debounced level with the pin again.
+void ButtonHandler::settlePins() {
+  uint32_t now = micros();
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    PinState& state = pinStates[i];
+    if (state.masked) {
+      continue;
+    }
+    if (now - state.lastEdge >= DEBOUNCE_DELAY * 1000UL && state.down == (bool)digitalRead(state.pin)) {
+      BUTTON_LOCK();
+      handleEdge(i, now);
+      BUTTON_UNLOCK();
+    }
+  }
+}
+
+bool ButtonHandler::nextEvent(ButtonEvent& event) {
+  settlePins();
+
+  if (events.pop(event)) {
+    trackHold(event);
+    return true;
+  }
+  return nextHoldEvent(event);
+}
+
+void ButtonHandler::trackHold(const ButtonEvent& event) {
+  int index = indexOf(event.pin);
+  if (index < 0) {
+    return;
+  }
+
+  PinState& state = pinStates[index];
+  if (event.type == BUTTON_PRESS) {
+    state.held = true;
+    state.longSent = false;
+    state.pressedAt = event.timestamp;
+    state.nextRepeat = event.timestamp + REPEAT_DELAY * 1000UL;
+  } else if (event.type == BUTTON_RELEASE) {
+    state.held = false;
+  }
+}
+
+// Long-press and auto-repeat are derived from how long a press has been
+// held, so they are generated here rather than queued by the ISR.
+bool ButtonHandler::nextHoldEvent(ButtonEvent& event) {
+  uint32_t now = micros();
+
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    PinState& state = pinStates[i];
+    if (!state.held) {
+      continue;
+    }
+
+    uint32_t longAt = state.pressedAt + LONG_PRESS_DELAY * 1000UL;
+    if (!state.longSent && (int32_t)(now - longAt) >= 0) {
+      state.longSent = true;
+      event.pin = state.pin;
+      event.type = BUTTON_LONG_PRESS;
+      event.timestamp = longAt;
+      return true;
+    }
+
+    if ((int32_t)(now - state.nextRepeat) >= 0) {
+      event.pin = state.pin;
+      event.type = BUTTON_REPEAT;
+      event.timestamp = state.nextRepeat;
+      state.nextRepeat += REPEAT_INTERVAL * 1000UL;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ButtonHandler::isButtonDown(uint8_t pin) const {
+  int index = indexOf(pin);
+  return index >= 0 && pinStates[index].down;
+}
+
+uint32_t ButtonHandler::getDroppedEvents() const {
+  return droppedEvents;
+}
+
+void ButtonHandler::maskPin(uint8_t pin, bool masked) {
+  int index = indexOf(pin);
+  if (index < 0) {
+    return;
+  }
+
+  BUTTON_LOCK();
+  pinStates[index].masked = masked;
+  BUTTON_UNLOCK();
+#if defined(ARDUINO_ARCH_ESP32)
+  // Saves taking an interrupt per SDA edge while the panel is flushed
+  if (masked) {
+    gpio_intr_disable((gpio_num_t)pin);
+  } else {
+    gpio_intr_enable((gpio_num_t)pin);
+  }
+#endif
+}
+
+int ButtonHandler::indexOf(uint8_t pin) const {
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    if (pinStates[i].pin == pin) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+void ButtonHandler::checkButtons(MenuSystem* menuSystem) {
+  // Drain everything that arrived since the last frame
+  ButtonEvent event;
+  while (nextEvent(event)) {
+    menuSystem->handleButtonEvent(event);
+  }
 }
\ No newline at end of file
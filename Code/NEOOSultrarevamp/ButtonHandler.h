@@ -1,29 +1,83 @@
-#ifndef BUTTON_HANDLER_H
-#define BUTTON_HANDLER_H
-
-#include <Arduino.h>
-
-// Forward declaration to avoid circular includes
-class MenuSystem;
-
-class ButtonHandler {
-  public:
-    ButtonHandler();
-    void init();
-    bool isButtonPressed(uint8_t pin);
-    void checkButtons(MenuSystem* menuSystem);
-    
-    // Button pin definitions
-    static const int BUTTON_A = 10;   // Selection button
-    static const int BUTTON_B = 6;    // Back button
-    static const int BUTTON_LEFT = 1;  // Left navigation
-    static const int BUTTON_RIGHT = 8; // Right navigation
-    static const int BUTTON_UP = 2;    // Up navigation
-    static const int BUTTON_DOWN = 3;  // Down navigation
-    
-  private:
-    unsigned long lastButtonPress;
-    static const int DEBOUNCE_DELAY = 75;
-};
-
+#ifndef BUTTON_HANDLER_H
+#define BUTTON_HANDLER_H
+
+#include <Arduino.h>
+#include "RingBuffer.h"
+
+// Forward declaration to avoid circular includes
+class MenuSystem;
+
+enum ButtonEventType : uint8_t {
+  BUTTON_PRESS,
+  BUTTON_RELEASE,
+  BUTTON_LONG_PRESS,  // once per press, after LONG_PRESS_DELAY
+  BUTTON_REPEAT       // while held, after REPEAT_DELAY every REPEAT_INTERVAL
+};
+
+struct ButtonEvent {
+  uint8_t pin;
+  ButtonEventType type;
+  uint32_t timestamp;  // micros() of the edge (or of the hold threshold)
+};
+
+class ButtonHandler {
+  public:
+    ButtonHandler();
+    void init();
+    void checkButtons(MenuSystem* menuSystem);
+
+    // Next debounced event, oldest first. Returns false when none is pending.
+    bool nextEvent(ButtonEvent& event);
+    bool isButtonDown(uint8_t pin) const;
+    uint32_t getDroppedEvents() const;
+
+    // For a pin shared with a bus: while masked its interrupt is off and
+    // its level is not read, so bus traffic is not taken for presses.
+    // The debounced level is compared with the pin again once unmasked.
+    void maskPin(uint8_t pin, bool masked);
+
+    // Button pin definitions
+    static const int BUTTON_A = 10;   // Selection button
+    static const int BUTTON_B = 6;    // Back button, also the panel's SDA
+    static const int BUTTON_LEFT = 1;  // Left navigation
+    static const int BUTTON_RIGHT = 8; // Right navigation
+    static const int BUTTON_UP = 2;    // Up navigation
+    static const int BUTTON_DOWN = 3;  // Down navigation
+    static const int BUTTON_COUNT = 6;
+
+  private:
+    // Per-pin debounce state. The first edge is taken immediately and
+    // further edges are ignored as bounce for DEBOUNCE_DELAY; a level
+    // change hidden inside that window is picked up by settlePins().
+    struct PinState {
+      uint8_t pin;
+      volatile bool down;           // debounced level, written by the ISR
+      volatile uint32_t lastEdge;   // micros() of the last accepted edge
+      volatile bool masked;         // see maskPin()
+      // Hold tracking, main loop only
+      bool held;
+      bool longSent;
+      uint32_t pressedAt;
+      uint32_t nextRepeat;
+    };
+
+    PinState pinStates[BUTTON_COUNT];
+    RingBuffer<ButtonEvent, 32> events;
+    volatile uint32_t droppedEvents;
+
+    static const int DEBOUNCE_DELAY = 20;       // ms, per pin
+    static const int LONG_PRESS_DELAY = 600;    // ms
+    static const int REPEAT_DELAY = 400;        // ms before the first repeat
+    static const int REPEAT_INTERVAL = 120;     // ms between repeats
+
+    static ButtonHandler* instance;
+    template <uint8_t index> static void onPinChange();
+
+    void handleEdge(uint8_t index, uint32_t now);
+    void settlePins();
+    void trackHold(const ButtonEvent& event);
+    bool nextHoldEvent(ButtonEvent& event);
+    int indexOf(uint8_t pin) const;
+};
+
 #endif
\ No newline at end of file
@@ -1,38 +1,451 @@
-#include "Display.h"
-
-DisplayManager::DisplayManager() 
-  : u8g2(U8G2_R0, /* clock=*/ 7, /* data=*/ 6, /* reset=*/ U8X8_PIN_NONE) {
-  // Constructor
-}
-
-void DisplayManager::init() {
-  u8g2.begin();
-}
-
-void DisplayManager::clearBuffer() {
-  u8g2.clearBuffer();
-}
-
-void DisplayManager::sendBuffer() {
-  u8g2.sendBuffer();
-}
-
-void DisplayManager::drawRFrame(int x, int y, int width, int height, int radius) {
-  u8g2.drawRFrame(x, y, width, height, radius);
-}
-
-void DisplayManager::drawStr(int x, int y, const char* text) {
-  u8g2.drawStr(x, y, text);
-}
-
-void DisplayManager::setFont(const uint8_t* font) {
-  u8g2.setFont(font);
-}
-
-int DisplayManager::getStrWidth(const char* text) {
-  return u8g2.getStrWidth(text);
-}
-
-U8G2_SSD1306_128X64_NONAME_F_SW_I2C* DisplayManager::getU8g2() {
-  return &u8g2;
+#include "Display.h"
+#include "Blitter.h"
+#include "Profiler.h"
+
+// Byte/GPIO callbacks for DISPLAY_HOST_STUB: accept everything, send nothing
+static uint8_t displayStubByte(u8x8_t* u8x8, uint8_t msg, uint8_t argInt, void* argPtr) {
+  return 1;
+}
+
+static uint8_t displayStubGpio(u8x8_t* u8x8, uint8_t msg, uint8_t argInt, void* argPtr) {
+  return 1;
+}
+
+DisplayManager::DisplayManager(DisplayTransport transport)
+  : transport(transport), blitter(true), blitFont(nullptr), renderIndex(0), renderStale(false),
+    background(DISPLAY_NO_LAYER), layerPoolUsed(0), runCount(0), flushBusy(false),
+    busHook(nullptr), busHookContext(nullptr) {
+  switch (transport) {
+    case DISPLAY_SW_I2C:
+      u8g2_Setup_ssd1306_i2c_128x64_noname_f(u8g2.getU8g2(), U8G2_R0,
+        u8x8_byte_arduino_sw_i2c, u8x8_gpio_and_delay_arduino);
+      u8x8_SetPin_SW_I2C(u8g2.getU8x8(), DISPLAY_SW_I2C_CLOCK, DISPLAY_SW_I2C_DATA, U8X8_PIN_NONE);
+      break;
+    case DISPLAY_HW_I2C:
+    case DISPLAY_HW_I2C_ASYNC:
+      // Board default SDA/SCL; u8g2 clocks the bus at the panel's 400 kHz
+      u8g2_Setup_ssd1306_i2c_128x64_noname_f(u8g2.getU8g2(), U8G2_R0,
+        u8x8_byte_arduino_hw_i2c, u8x8_gpio_and_delay_arduino);
+      u8x8_SetPin_HW_I2C(u8g2.getU8x8(), U8X8_PIN_NONE);
+      break;
+    case DISPLAY_HOST_STUB:
+      u8g2_Setup_ssd1306_i2c_128x64_noname_f(u8g2.getU8g2(), U8G2_R0,
+        displayStubByte, displayStubGpio);
+      break;
+  }
+
+  frameBuffers[0] = u8g2.getBufferPtr();
+  frameBuffers[1] = secondBuffer;
+  memset(secondBuffer, 0, sizeof(secondBuffer));
+  memset(panelShadow, 0, sizeof(panelShadow));
+  memset(damagedTiles, 0, sizeof(damagedTiles));
+  memset(inkedTiles, 0, sizeof(inkedTiles));
+  memset(drawnTiles, 0, sizeof(drawnTiles));
+  memset(layers, 0, sizeof(layers));
+  resetStats();
+
+#if defined(ARDUINO_ARCH_ESP32)
+  flushTask = nullptr;
+#endif
+}
+
+void DisplayManager::init() {
+  // begin() clears the panel, which matches the zeroed shadow
+  u8g2.begin();
+  memset(panelShadow, 0, sizeof(panelShadow));
+  memset(damagedTiles, 0, sizeof(damagedTiles));
+  memset(inkedTiles, 0, sizeof(inkedTiles));
+
+#if defined(ARDUINO_ARCH_ESP32)
+  if (transport == DISPLAY_HW_I2C_ASYNC && flushTask == nullptr) {
+    // Above the loop task so a queued frame starts clocking out right away;
+    // it blocks in the I2C driver, leaving the CPU to the loop meanwhile.
+    xTaskCreate(flushTaskMain, "displayFlush", 2048, this, 2, &flushTask);
+  }
+#endif
+}
+
+void DisplayManager::clearBuffer() {
+  u8g2.clearBuffer();
+  renderStale = false;
+  // Only tiles that currently show something change when cleared
+  for (uint8_t page = 0; page < DISPLAY_PAGES; page++) {
+    damagedTiles[page] |= inkedTiles[page];
+    drawnTiles[page] = 0;
+  }
+  background = DISPLAY_NO_LAYER;
+}
+
+bool DisplayManager::beginLayer(uint8_t layer) {
+  if (layer >= DISPLAY_LAYERS || !layers[layer].cached) {
+    clearBuffer();
+    return false;
+  }
+  const DisplayLayer& saved = layers[layer];
+  uint8_t* buffer = frameBuffers[renderIndex];
+  memset(buffer, 0, DISPLAY_BUFFER_SIZE);
+  renderStale = false;
+
+  const uint8_t* tile = layerPool + saved.offset * 8;
+  for (uint8_t page = 0; page < DISPLAY_PAGES; page++) {
+    uint16_t tiles = saved.tiles[page];
+    for (uint8_t tx = 0; tiles != 0; tx++, tiles >>= 1) {
+      if (tiles & 1) {
+        memcpy(buffer + page * DISPLAY_WIDTH + tx * 8, tile, 8);
+        tile += 8;
+      }
+    }
+    // On the same background the panel differs only where the last
+    // frame drew over it; on another, wherever either has ink
+    if (layer == background) {
+      damagedTiles[page] |= drawnTiles[page];
+    } else {
+      damagedTiles[page] |= inkedTiles[page] | saved.tiles[page];
+    }
+    drawnTiles[page] = 0;
+  }
+  background = layer;
+  stats.layerHits++;
+  return true;
+}
+
+void DisplayManager::saveLayer(uint8_t layer) {
+  if (layer >= DISPLAY_LAYERS || layers[layer].cached) {
+    return;
+  }
+  prepareRender();
+  const uint8_t* buffer = frameBuffers[renderIndex];
+  DisplayLayer& saved = layers[layer];
+  uint16_t count = 0;
+  for (uint8_t page = 0; page < DISPLAY_PAGES; page++) {
+    saved.tiles[page] = 0;
+    for (uint8_t tx = 0; tx < DISPLAY_TILE_COLS; tx++) {
+      const uint8_t* tile = buffer + page * DISPLAY_WIDTH + tx * 8;
+      for (uint8_t i = 0; i < 8; i++) {
+        if (tile[i] != 0) {
+          saved.tiles[page] |= (1 << tx);
+          count++;
+          break;
+        }
+      }
+    }
+  }
+  stats.layerMisses++;
+  if (layerPoolUsed + count > DISPLAY_LAYER_TILES) {
+    // No room: this background is drawn every frame
+    return;
+  }
+
+  uint8_t* tile = layerPool + layerPoolUsed * 8;
+  for (uint8_t page = 0; page < DISPLAY_PAGES; page++) {
+    for (uint8_t tx = 0; tx < DISPLAY_TILE_COLS; tx++) {
+      if (saved.tiles[page] & (1 << tx)) {
+        memcpy(tile, buffer + page * DISPLAY_WIDTH + tx * 8, 8);
+        tile += 8;
+      }
+    }
+    drawnTiles[page] = 0;
+  }
+  saved.offset = layerPoolUsed;
+  saved.count = count;
+  saved.cached = true;
+  layerPoolUsed += count;
+  background = layer;
+}
+
+void DisplayManager::invalidateLayers() {
+  memset(layers, 0, sizeof(layers));
+  layerPoolUsed = 0;
+  background = DISPLAY_NO_LAYER;
+}
+
+// The render buffer holds the frame before last after a swap. Callers
+// that draw on top of the previous frame without clearing get a copy of it.
+void DisplayManager::prepareRender() {
+  if (renderStale) {
+    memcpy(frameBuffers[renderIndex], frameBuffers[renderIndex ^ 1], DISPLAY_BUFFER_SIZE);
+    renderStale = false;
+  }
+}
+
+void DisplayManager::sendBuffer() {
+  prepareRender();
+
+  // The run list and the front buffer belong to the flush until it ends
+  if (flushBusy) {
+    stats.flushStalls++;
+    waitForFlush();
+  }
+
+  uint16_t frameTiles = 0;
+  runCount = 0;
+  for (uint8_t page = 0; page < DISPLAY_PAGES; page++) {
+    if (damagedTiles[page] != 0) {
+      frameTiles += queuePage(page);
+    }
+    damagedTiles[page] = 0;
+  }
+
+  stats.frames++;
+  stats.lastFrameTiles = frameTiles;
+  stats.lastFrameBytes = frameTiles * 8;
+  stats.tilesSent += frameTiles;
+  stats.bytesSent += frameTiles * 8;
+
+  if (frameTiles == 0) {
+    stats.framesSkipped++;
+    return;
+  }
+
+  // Swap: the finished frame becomes the front buffer
+  renderIndex ^= 1;
+  u8g2.getU8g2()->tile_buf_ptr = frameBuffers[renderIndex];
+  renderStale = true;
+
+  startFlush();
+}
+
+// Queue the runs of damaged tiles in one page that differ from the panel
+// shadow. Undamaged tiles match it already. Returns the number of tiles
+// queued.
+uint16_t DisplayManager::queuePage(uint8_t page) {
+  uint8_t* row = frameBuffers[renderIndex] + page * DISPLAY_WIDTH;
+  uint8_t* shadow = panelShadow + page * DISPLAY_WIDTH;
+  uint16_t damaged = damagedTiles[page];
+  uint16_t changed = 0;
+  uint16_t queued = 0;
+
+  for (uint8_t tx = 0; tx < DISPLAY_TILE_COLS; tx++) {
+    if (!(damaged & (1 << tx))) {
+      continue;
+    }
+    stats.tilesCompared++;
+    if (memcmp(row + tx * 8, shadow + tx * 8, 8) != 0) {
+      changed |= (1 << tx);
+    }
+  }
+
+  uint8_t tx = 0;
+  while (tx < DISPLAY_TILE_COLS) {
+    if (!(changed & (1 << tx))) {
+      tx++;
+      continue;
+    }
+
+    // Extend the run over changed tiles and short clean gaps
+    uint8_t start = tx;
+    uint8_t end = tx + 1;
+    uint8_t probe = end;
+    while (probe < DISPLAY_TILE_COLS && probe - end <= DISPLAY_TILE_MERGE_GAP) {
+      if (changed & (1 << probe)) {
+        end = probe + 1;
+      }
+      probe++;
+    }
+
+    uint8_t width = end - start;
+    memcpy(shadow + start * 8, row + start * 8, width * 8);
+    runs[runCount].page = page;
+    runs[runCount].start = start;
+    runs[runCount].width = width;
+    runCount++;
+    queued += width;
+    tx = end;
+  }
+
+  for (tx = 0; tx < DISPLAY_TILE_COLS; tx++) {
+    if (!(changed & (1 << tx))) {
+      continue;
+    }
+    const uint8_t* tile = shadow + tx * 8;
+    bool inked = false;
+    for (uint8_t i = 0; i < 8 && !inked; i++) {
+      inked = tile[i] != 0;
+    }
+    if (inked) {
+      inkedTiles[page] |= (1 << tx);
+    } else {
+      inkedTiles[page] &= ~(1 << tx);
+    }
+  }
+
+  return queued;
+}
+
+void DisplayManager::startFlush() {
+  flushBusy = true;
+
+#if defined(ARDUINO_ARCH_ESP32)
+  if (flushTask != nullptr) {
+    xTaskNotifyGive(flushTask);
+    return;
+  }
+#endif
+
+  flushRuns();
+  flushBusy = false;
+}
+
+// Push the queued runs from the front buffer to the panel
+void DisplayManager::flushRuns() {
+  PROFILE_SCOPE(SPAN_FLUSH);
+  uint8_t* front = frameBuffers[renderIndex ^ 1];
+  u8x8_t* u8x8 = u8g2.getU8x8();
+  if (busHook != nullptr) {
+    busHook(true, busHookContext);
+  }
+
+  for (uint8_t i = 0; i < runCount; i++) {
+    const DisplayTileRun& run = runs[i];
+    u8x8_DrawTile(u8x8, run.start, run.page, run.width,
+                  front + run.page * DISPLAY_WIDTH + run.start * 8);
+  }
+  u8x8_RefreshDisplay(u8x8);
+  if (busHook != nullptr) {
+    busHook(false, busHookContext);
+  }
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+void DisplayManager::flushTaskMain(void* arg) {
+  DisplayManager* self = static_cast<DisplayManager*>(arg);
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    self->flushRuns();
+    self->flushBusy = false;
+  }
+}
+#endif
+
+bool DisplayManager::isFlushing() const {
+  return flushBusy;
+}
+
+void DisplayManager::waitForFlush() {
+  while (flushBusy) {
+    delay(1);
+  }
+}
+
+void DisplayManager::setBusHook(DisplayBusHook hook, void* context) {
+  waitForFlush();
+  busHook = hook;
+  busHookContext = context;
+}
+
+DisplayTransport DisplayManager::getTransport() const {
+  return transport;
+}
+
+void DisplayManager::markTiles(int x, int y, int width, int height) {
+  int left = max(x, 0);
+  int right = min(x + width - 1, DISPLAY_WIDTH - 1);
+  int top = max(y, 0);
+  int bottom = min(y + height - 1, DISPLAY_HEIGHT - 1);
+  if (left > right || top > bottom) {
+    return;
+  }
+  uint16_t tiles = (uint16_t)((2UL << (right / 8)) - (1UL << (left / 8)));
+  for (int page = top / 8; page <= bottom / 8; page++) {
+    damagedTiles[page] |= tiles;
+    drawnTiles[page] |= tiles;
+  }
+}
+
+void DisplayManager::markAll() {
+  for (uint8_t page = 0; page < DISPLAY_PAGES; page++) {
+    damagedTiles[page] = 0xFFFF;
+    drawnTiles[page] = 0xFFFF;
+  }
+}
+
+void DisplayManager::markDirty(int x, int y, int width, int height) {
+  markTiles(x, y, width, height);
+}
+
+void DisplayManager::drawRFrame(int x, int y, int width, int height, int radius) {
+  prepareRender();
+  if (!blitter || !blitRFrame(u8g2.getBufferPtr(), x, y, width, height, radius)) {
+    u8g2.drawRFrame(x, y, width, height, radius);
+  }
+  markDirty(x, y, width, height);
+}
+
+void DisplayManager::drawBox(int x, int y, int width, int height) {
+  prepareRender();
+  if (blitter) {
+    blitBox(u8g2.getBufferPtr(), x, y, width, height);
+  } else {
+    u8g2.drawBox(x, y, width, height);
+  }
+  markDirty(x, y, width, height);
+}
+
+void DisplayManager::drawStr(int x, int y, const char* text) {
+  prepareRender();
+  int width;
+  if (blitter && blitFont != nullptr) {
+    width = blitStr(u8g2.getBufferPtr(), blitFont, x, y, text);
+  } else {
+    width = u8g2.drawStr(x, y, text);
+  }
+  markText(x, y, width);
+}
+
+void DisplayManager::drawLabel(int x, int y, const char* text) {
+  if (!blitter || blitFont == nullptr) {
+    drawStr(x, y, text);
+    return;
+  }
+  prepareRender();
+  int width = labels.draw(u8g2.getBufferPtr(), blitFont, x, y, text);
+  markText(x, y, width);
+}
+
+// Covers both baseline and top font positioning, and glyphs reaching
+// past the pen on either side
+void DisplayManager::markText(int x, int y, int width) {
+  int charWidth = u8g2.getMaxCharWidth();
+  int charHeight = u8g2.getMaxCharHeight();
+  markTiles(x - charWidth, y - charHeight, width + charWidth * 2, charHeight * 2);
+}
+
+void DisplayManager::setFont(const uint8_t* font) {
+  u8g2.setFont(font);
+  blitFont = blitFontSupported(font) ? font : nullptr;
+}
+
+int DisplayManager::getStrWidth(const char* text) {
+  return u8g2.getStrWidth(text);
+}
+
+void DisplayManager::setBlitter(bool enabled) {
+  blitter = enabled;
+}
+
+bool DisplayManager::isBlitterEnabled() const {
+  return blitter;
+}
+
+const DisplayStats& DisplayManager::getStats() const {
+  return stats;
+}
+
+void DisplayManager::resetStats() {
+  memset(&stats, 0, sizeof(stats));
+  labels.resetStats();
+}
+
+const TextCacheStats& DisplayManager::getTextCacheStats() const {
+  return labels.getStats();
+}
+
+const uint8_t* DisplayManager::getPanelFrame() const {
+  return panelShadow;
+}
+
+U8G2* DisplayManager::getU8g2() {
+  prepareRender();
+  markAll();
+  return &u8g2;
 }
\ No newline at end of file
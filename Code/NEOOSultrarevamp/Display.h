@@ -1,26 +1,186 @@
-#ifndef DISPLAY_H
-#define DISPLAY_H
-
-#include <Arduino.h>
-#include <U8g2lib.h>
-
-class DisplayManager {
-  public:
-    DisplayManager();
-    void init();
-    void clearBuffer();
-    void sendBuffer();
-    void drawRFrame(int x, int y, int width, int height, int radius);
-    void drawStr(int x, int y, const char* text);
-    void setFont(const uint8_t* font);
-    int getStrWidth(const char* text);
-    
-    // Provide direct access to u8g2 for more complex operations
-    U8G2_SSD1306_128X64_NONAME_F_SW_I2C* getU8g2();
-
-  private:
-    // Use Software I2C with pins 7 (clock) and 6 (data)
-    U8G2_SSD1306_128X64_NONAME_F_SW_I2C u8g2;
-};
-
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include "TextCache.h"
+
+// SSD1306 geometry: the framebuffer is 8 pages of 128 bytes, each byte
+// holding 8 vertical pixels. A tile is one 8x8 block (8 bytes) of a page.
+#define DISPLAY_WIDTH 128
+#define DISPLAY_HEIGHT 64
+#define DISPLAY_PAGES 8
+#define DISPLAY_TILE_COLS 16
+#define DISPLAY_BUFFER_SIZE (DISPLAY_WIDTH * DISPLAY_PAGES)
+
+// Clean tiles between two dirty runs are sent anyway when the gap is this
+// small, since a new column/page address costs about as much as a tile.
+#define DISPLAY_TILE_MERGE_GAP 1
+
+// With a merge gap of 1 a page splits into at most 6 runs
+#define DISPLAY_MAX_RUNS (DISPLAY_PAGES * 6)
+
+// Background layers: static chrome kept as page-aligned tile snapshots.
+// Only non-empty tiles are stored, in one pool shared by all layers.
+#define DISPLAY_LAYERS 6
+#define DISPLAY_LAYER_TILES 256  // 2 KB; a full window frame is 44 tiles
+#define DISPLAY_NO_LAYER 0xFF
+
+// Pins for the software I2C transport (the original wiring).
+// Note pin 6 is also ButtonHandler::BUTTON_B, and the board's default
+// SDA for the hardware transports, see setBusHook().
+#define DISPLAY_SW_I2C_CLOCK 7
+#define DISPLAY_SW_I2C_DATA 6
+
+// How the framebuffer reaches the panel
+enum DisplayTransport {
+  DISPLAY_SW_I2C,        // bit-banged I2C, blocking
+  DISPLAY_HW_I2C,        // I2C peripheral via Wire, blocking
+  DISPLAY_HW_I2C_ASYNC,  // I2C peripheral, flushed from a background task
+  DISPLAY_HOST_STUB      // no panel attached, flushes are only counted
+};
+
+// Builds can pick the transport with -DDISPLAY_DEFAULT_TRANSPORT=...
+#if defined(DISPLAY_DEFAULT_TRANSPORT)
+#elif defined(ARDUINO_ARCH_ESP32)
+#define DISPLAY_DEFAULT_TRANSPORT DISPLAY_HW_I2C_ASYNC
+#elif defined(ARDUINO)
+#define DISPLAY_DEFAULT_TRANSPORT DISPLAY_HW_I2C
+#else
+#define DISPLAY_DEFAULT_TRANSPORT DISPLAY_HOST_STUB
+#endif
+
+// Called with true before a flush drives the panel bus and with false
+// once it is released, from whichever task runs the flush
+typedef void (*DisplayBusHook)(bool busy, void* context);
+
+// Flush counters, reset only by resetStats()
+struct DisplayStats {
+  uint32_t frames;          // sendBuffer() calls
+  uint32_t framesSkipped;   // frames identical to what the panel shows
+  uint32_t flushStalls;     // sendBuffer() calls that waited on the previous flush
+  uint32_t tilesSent;       // 8x8 tiles pushed to the panel
+  uint32_t bytesSent;       // framebuffer bytes pushed to the panel
+  uint16_t lastFrameTiles;  // tiles pushed by the most recent sendBuffer()
+  uint16_t lastFrameBytes;  // bytes pushed by the most recent sendBuffer()
+  uint32_t tilesCompared;   // damaged tiles checked against the panel
+  uint32_t layerHits;       // frames composed from a cached background
+  uint32_t layerMisses;     // backgrounds drawn and saved
+};
+
+// One horizontal run of tiles queued for the panel
+struct DisplayTileRun {
+  uint8_t page;
+  uint8_t start;
+  uint8_t width;
+};
+
+// A saved background: which tiles are non-empty, and where they sit in
+// the pool, page by page in tile order
+struct DisplayLayer {
+  bool cached;
+  uint16_t tiles[DISPLAY_PAGES];
+  uint16_t offset;  // first tile in the pool
+  uint16_t count;
+};
+
+class DisplayManager {
+  public:
+    DisplayManager(DisplayTransport transport = DISPLAY_DEFAULT_TRANSPORT);
+    void init();
+    void clearBuffer();
+    // Queues the changed tiles and returns; the frame is clocked out from
+    // the front buffer while the next one is drawn into the back buffer.
+    void sendBuffer();
+    void drawRFrame(int x, int y, int width, int height, int radius);
+    void drawBox(int x, int y, int width, int height);
+    void drawStr(int x, int y, const char* text);
+    // drawStr() for text drawn unchanged frame after frame (labels,
+    // titles, hints): rasterised once into the text cache, then copied
+    void drawLabel(int x, int y, const char* text);
+    void setFont(const uint8_t* font);
+    int getStrWidth(const char* text);
+
+    // Mark a region as changed when drawing through getU8g2() directly
+    void markDirty(int x, int y, int width, int height);
+
+    // Start a frame on a background layer instead of clearBuffer(). If
+    // the layer is cached it becomes the frame and true is returned;
+    // otherwise the buffer is cleared and the caller draws the layer,
+    // then hands it to saveLayer(). Either way only what is drawn on
+    // top afterwards, plus a change of background, is sent.
+    bool beginLayer(uint8_t layer);
+    void saveLayer(uint8_t layer);
+    void invalidateLayers();
+
+    // drawRFrame() and drawStr() go through the Blitter unless disabled,
+    // falling back to u8g2 for shapes and fonts it doesn't cover
+    void setBlitter(bool enabled);
+    bool isBlitterEnabled() const;
+
+    bool isFlushing() const;
+    void waitForFlush();
+    // Lets pins shared with the bus stand aside while it is in use
+    void setBusHook(DisplayBusHook hook, void* context);
+    DisplayTransport getTransport() const;
+
+    const DisplayStats& getStats() const;
+    void resetStats();
+    const TextCacheStats& getTextCacheStats() const;
+
+    // The frame as last queued for the panel, in u8g2 page layout
+    const uint8_t* getPanelFrame() const;
+
+    // Provide direct access to u8g2 for more complex operations.
+    // The whole screen is treated as damaged for the current frame.
+    U8G2* getU8g2();
+
+  private:
+    U8G2 u8g2;
+    DisplayTransport transport;
+    bool blitter;
+    const uint8_t* blitFont;  // current font, if the Blitter supports it
+    TextCache labels;
+
+    // Double buffering: u8g2 renders into one buffer while the other is
+    // being sent. The first is u8g2's own, the second lives here.
+    uint8_t* frameBuffers[2];
+    uint8_t secondBuffer[DISPLAY_BUFFER_SIZE];
+    uint8_t renderIndex;
+    bool renderStale;      // render buffer still holds an older frame
+
+    // Copy of the framebuffer as last queued, i.e. what the panel shows
+    // once the current flush completes
+    uint8_t panelShadow[DISPLAY_BUFFER_SIZE];
+    // Per page, bit n for tile n
+    uint16_t damagedTiles[DISPLAY_PAGES];  // may differ from the panel
+    uint16_t inkedTiles[DISPLAY_PAGES];    // lit on the panel
+    uint16_t drawnTiles[DISPLAY_PAGES];    // drawn over the background layer
+    uint8_t background;                    // layer the frame started from
+    DisplayStats stats;
+
+    DisplayLayer layers[DISPLAY_LAYERS];
+    uint16_t layerPoolUsed;
+    uint8_t layerPool[DISPLAY_LAYER_TILES * 8];
+
+    DisplayTileRun runs[DISPLAY_MAX_RUNS];
+    uint8_t runCount;
+    volatile bool flushBusy;
+    DisplayBusHook busHook;
+    void* busHookContext;
+
+    void markTiles(int x, int y, int width, int height);
+    void markAll();
+    void markText(int x, int y, int width);
+    void prepareRender();
+    uint16_t queuePage(uint8_t page);
+    void startFlush();
+    void flushRuns();
+
+#if defined(ARDUINO_ARCH_ESP32)
+    TaskHandle_t flushTask;
+    static void flushTaskMain(void* arg);
+#endif
+};
+
 #endif
\ No newline at end of file
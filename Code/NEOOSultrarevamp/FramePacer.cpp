@@ -0,0 +1,70 @@
+#include "FramePacer.h"
+
+FramePacer::FramePacer()
+  : scheduler(nullptr), taskId(-1), render(nullptr), context(nullptr), wanted(false), wantedAt(0),
+    statsSince(0), idleSince(0) {
+  memset(&stats, 0, sizeof(stats));
+}
+
+bool FramePacer::begin(Scheduler* taskScheduler, RenderFunction renderFunction, void* renderContext,
+                       uint8_t priority) {
+  scheduler = taskScheduler;
+  render = renderFunction;
+  context = renderContext;
+  wanted = true;
+  wantedAt = millis();
+  resetStats();
+  taskId = scheduler->addTask("render", renderTask, this, priority);
+  return taskId >= 0;
+}
+
+void FramePacer::invalidate() {
+  if (!wanted) {
+    wanted = true;
+    wantedAt = millis();
+  }
+  scheduler->start(taskId);
+}
+
+uint32_t FramePacer::renderTask(void* context) {
+  return static_cast<FramePacer*>(context)->renderFrame();
+}
+
+uint32_t FramePacer::renderFrame() {
+  uint32_t startedMs = millis();
+  uint32_t started = micros();
+  bool animating = render(context);
+  uint32_t elapsed = micros() - started;
+
+  stats.frames++;
+  stats.lastFrameTime = elapsed;
+  stats.maxFrameTime = max(stats.maxFrameTime, elapsed);
+  stats.totalFrameTime += elapsed;
+  if (wanted && (int32_t)(millis() - wantedAt) > FRAME_BUDGET) {
+    stats.missedDeadlines++;
+  }
+
+  // The next animation frame is owed one budget after this one began;
+  // the scheduler keeps the period from its deadlines, not from now
+  wanted = animating;
+  wantedAt = startedMs + FRAME_BUDGET;
+  return animating ? FRAME_BUDGET : FRAME_IDLE_PERIOD;
+}
+
+const FrameStats& FramePacer::getStats() const {
+  return stats;
+}
+
+void FramePacer::resetStats() {
+  memset(&stats, 0, sizeof(stats));
+  statsSince = millis();
+  idleSince = scheduler != nullptr ? scheduler->getIdleTime() : 0;
+}
+
+uint8_t FramePacer::getIdlePercent() const {
+  uint32_t elapsed = millis() - statsSince;
+  if (elapsed == 0 || scheduler == nullptr) {
+    return 0;
+  }
+  return min<uint32_t>(100, (uint64_t)(scheduler->getIdleTime() - idleSince) * 100 / elapsed);
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <Arduino.h>
+#include "Scheduler.h"
+
+#define FRAME_BUDGET 25         // ms per frame while something on screen moves
+#define FRAME_IDLE_PERIOD 1000  // ms between refreshes while nothing does
+
+// Draws one frame; returns true while something on screen is moving
+typedef bool (*RenderFunction)(void* context);
+
+// Counters, reset only by resetStats()
+struct FrameStats {
+  uint32_t frames;           // rendered
+  uint32_t missedDeadlines;  // frames on screen more than FRAME_BUDGET after they were wanted
+  uint32_t lastFrameTime;    // us spent rendering the most recent frame
+  uint32_t maxFrameTime;     // us
+  uint64_t totalFrameTime;   // us, for the mean
+};
+
+// Runs the render function as a scheduler task, only as often as the
+// screen needs it: every FRAME_BUDGET ms while it reports animation,
+// right away after invalidate(), and otherwise once per
+// FRAME_IDLE_PERIOD as a safety refresh (sendBuffer() skips it when
+// nothing changed). An idle menu costs about one frame a second.
+class FramePacer {
+  public:
+    FramePacer();
+
+    // Registers the render task, which draws a first frame right away
+    bool begin(Scheduler* scheduler, RenderFunction render, void* context, uint8_t priority);
+
+    // The screen is out of date: render at the scheduler's next pass
+    void invalidate();
+
+    const FrameStats& getStats() const;
+    void resetStats();
+    // Share of the time since resetStats() the scheduler spent asleep
+    uint8_t getIdlePercent() const;
+
+  private:
+    Scheduler* scheduler;
+    int taskId;
+    RenderFunction render;
+    void* context;
+    bool wanted;          // a frame is owed by wantedAt + FRAME_BUDGET
+    uint32_t wantedAt;    // ms
+    uint32_t statsSince;  // ms
+    uint32_t idleSince;   // scheduler idle time at resetStats()
+    FrameStats stats;
+
+    static uint32_t renderTask(void* context);
+    uint32_t renderFrame();
+};
+
+#endif
\ No newline at end of file
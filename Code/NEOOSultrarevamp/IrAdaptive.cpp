@@ -0,0 +1,286 @@
+#include "IrAdaptive.h"
+#include "IrLibrary.h"
+#include "IrProtocols.h"
+#include "IrSequencer.h"
+#include "IrTxQueue.h"
+#include "Log.h"
+
+IrAdaptive irAdaptive;
+
+// Carriers tried first, in kHz; 0 is the code's own. Receivers are
+// tuned to one of these, and ties go to the earlier entry.
+static const uint8_t adaptiveCarriers[] = {0, 38, 36, 40, 33, 56};
+// Duty cycles tried next; IR_TX_DUTY already ran with the carriers
+static const uint8_t adaptiveDuties[] = {25, 50};
+
+static bool takeId(const IrCodeKey& key, uint32_t id, void* context) {
+  *static_cast<int32_t*>(context) = id;
+  return false;
+}
+
+IrAdaptive::IrAdaptive()
+  : id(-1), phase(IR_ADAPTIVE_IDLE), candidate(0), trials(0), hits(0), failedBefore(0), waiting(false), ownCapture(false),
+    idleSince(0), referenceCount(0) {
+  memset(&code, 0, sizeof(code));
+  memset(&trial, 0, sizeof(trial));
+  memset(&best, 0, sizeof(best));
+  name[0] = '\0';
+  received.count = 0;
+}
+
+bool IrAdaptive::start(uint32_t position) {
+  stop();
+  phase = IR_ADAPTIVE_IDLE;
+  id = -1;
+  irLibrary.list(takeId, &id, nullptr, nullptr, position, 1);
+  if (id < 0 || !irLibrary.get(id, code)) {
+    return false;
+  }
+  irCodeKeyField(code.key.function, IR_KEY_FUNCTION, name);
+
+  if (code.protocol == IR_PROTOCOL_RAW) {
+    referenceCount = irLibrary.readRaw(code, reference, IR_TX_MAX_DURATIONS);
+    if ((referenceCount & 1) == 0 && referenceCount > 0) {
+      referenceCount--;
+    }
+  } else {
+    referenceCount = irEncode(code, reference, IR_TX_MAX_DURATIONS);
+  }
+  if (referenceCount == 0) {
+    LOG_WARN(LOG_MSG_IR_NO_ENCODER, code.protocol);
+    phase = IR_ADAPTIVE_FAILED;
+    return true;
+  }
+
+  ownCapture = !irCapture.isActive();
+  irCapture.begin();
+  trials = 0;
+  hits = 0;
+  best.sent = 0;
+  phase = IR_ADAPTIVE_CARRIER;
+  candidate = -1;
+  if (!nextTrial() || !send()) {
+    finish();
+  }
+  return true;
+}
+
+void IrAdaptive::stop() {
+  if (!isRunning()) {
+    return;
+  }
+  irSequencer.stop();
+  waiting = false;
+  if (ownCapture) {
+    irCapture.end();
+  }
+  phase = IR_ADAPTIVE_IDLE;
+}
+
+bool IrAdaptive::isRunning() const {
+  return phase == IR_ADAPTIVE_CARRIER || phase == IR_ADAPTIVE_DUTY || phase == IR_ADAPTIVE_REPEATS;
+}
+
+void IrAdaptive::setTrial(uint8_t carrierKHz, uint8_t duty, uint8_t repeats) {
+  trial.carrierKHz = carrierKHz;
+  trial.duty = duty;
+  trial.repeats = repeats;
+  trial.sent = 0;
+  trial.hits = 0;
+  trial.errorUs = 0;
+}
+
+// Steps through the lists of parameters, phase by phase. The duty cycles
+// and repeats build on the best result so far.
+bool IrAdaptive::nextTrial() {
+  for (;;) {
+    candidate++;
+    if (phase == IR_ADAPTIVE_CARRIER) {
+      if (candidate < (int8_t)sizeof(adaptiveCarriers)) {
+        uint8_t kHz = adaptiveCarriers[candidate];
+        if (candidate > 0 && kHz == code.carrierKHz) {
+          continue;
+        }
+        setTrial(kHz != 0 ? kHz : code.carrierKHz, IR_TX_DUTY, 0);
+        return true;
+      }
+      phase = IR_ADAPTIVE_DUTY;
+      candidate = -1;
+    } else if (phase == IR_ADAPTIVE_DUTY) {
+      if (candidate < (int8_t)sizeof(adaptiveDuties)) {
+        setTrial(best.carrierKHz, adaptiveDuties[candidate], 0);
+        return true;
+      }
+      phase = IR_ADAPTIVE_REPEATS;
+      candidate = -1;
+    } else if (phase == IR_ADAPTIVE_REPEATS) {
+      // Repeats only help a code that doesn't always get through
+      if (best.hits < IR_ADAPTIVE_TRIALS && candidate < IR_ADAPTIVE_MAX_REPEATS) {
+        setTrial(best.carrierKHz, best.duty, candidate + 1);
+        return true;
+      }
+      return false;
+    } else {
+      return false;
+    }
+  }
+}
+
+// One send of the trial's parameters, as a one-step macro
+bool IrAdaptive::send() {
+  while (irCapture.readFrame(received)) {
+    // Whatever came in before is not ours
+  }
+  IrMacro macro;
+  strcpy(macro.name, name);
+  macro.steps[0].key = code.key;
+  macro.steps[0].repeats = trial.repeats;
+  macro.steps[0].gapUs = 0;
+  macro.steps[0].carrierKHz = trial.carrierKHz;
+  macro.steps[0].duty = trial.duty;
+  macro.stepCount = 1;
+  failedBefore = irTxQueue.getFramesFailed();
+  waiting = irSequencer.start(macro);
+  return waiting;
+}
+
+// Sent frame against received: protocol codes must decode to the same
+// key press, RAW ones have to line up duration by duration. The timing
+// error takes out the mark stretch every receiver adds.
+bool IrAdaptive::matches(const IrRawFrame& frame, uint32_t& errorUs) const {
+  if (code.protocol != IR_PROTOCOL_RAW) {
+    IrCode decoded;
+    memset(&decoded, 0, sizeof(decoded));
+    if (!irDecode(frame.durations, frame.count, decoded) || (decoded.flags & IR_CODE_FLAG_REPEAT) ||
+        decoded.protocol != code.protocol || decoded.address != code.address || decoded.command != code.command ||
+        (code.bits != 0 && decoded.bits != code.bits)) {
+      return false;
+    }
+  } else if (frame.count != referenceCount) {
+    return false;
+  }
+
+  uint16_t count = min(frame.count, referenceCount);
+  uint32_t total = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    int32_t measured = frame.durations[i] + (i % 2 == 0 ? -IR_MARK_EXCESS : IR_MARK_EXCESS);
+    uint32_t off = abs(measured - (int32_t)reference[i]);
+    if (code.protocol == IR_PROTOCOL_RAW && off * 100 > (uint32_t)reference[i] * IR_ADAPTIVE_TOLERANCE) {
+      return false;
+    }
+    total += off;
+  }
+  errorUs = count > 0 ? total / count : 0;
+  return true;
+}
+
+// Counts the send as a hit if any of its frames came back right. A
+// send the transmitter refused tells nothing about the parameters.
+bool IrAdaptive::collect() {
+  if (irTxQueue.getFramesFailed() != failedBefore) {
+    return false;
+  }
+  bool hit = false;
+  uint32_t errorUs = 0;
+  while (irCapture.readFrame(received)) {
+    if (!hit) {
+      hit = matches(received, errorUs);
+    }
+  }
+  trial.sent++;
+  trials++;
+  if (hit) {
+    trial.errorUs = (trial.errorUs * trial.hits + errorUs) / (trial.hits + 1);
+    trial.hits++;
+    hits++;
+  }
+  return true;
+}
+
+// Stores the run in the library record; the parameters only if
+// something got through, and nothing if no send went out
+void IrAdaptive::finish() {
+  if (ownCapture) {
+    irCapture.end();
+  }
+  waiting = false;
+  phase = IR_ADAPTIVE_FAILED;
+  if (trials == 0) {
+    return;
+  }
+  code.trials += trials;
+  code.hits += hits;
+  if (best.sent > 0 && best.hits > 0) {
+    code.tunedCarrierKHz = best.carrierKHz;
+    code.tunedDuty = best.duty;
+    code.tunedRepeats = best.repeats;
+    phase = IR_ADAPTIVE_DONE;
+  }
+  irLibrary.update(id, code);
+  LOG_INFO(LOG_MSG_IR_ADAPTIVE_RESULT, name, (unsigned)best.carrierKHz, (unsigned)best.duty,
+           (unsigned)best.repeats, (unsigned)code.hits, (unsigned)code.trials);
+}
+
+uint32_t IrAdaptive::step() {
+  if (!isRunning()) {
+    return TASK_STOP;
+  }
+  if (waiting) {
+    if (irSequencer.isPlaying()) {
+      return IR_ADAPTIVE_POLL;
+    }
+    // The receiver closes a frame only after IR_CAPTURE_GAP of idle line
+    waiting = false;
+    idleSince = millis();
+    return IR_ADAPTIVE_SETTLE;
+  }
+  if (millis() - idleSince < IR_ADAPTIVE_SETTLE) {
+    return IR_ADAPTIVE_POLL;
+  }
+  if (!collect()) {
+    finish();
+    return TASK_STOP;
+  }
+  if (trial.sent < IR_ADAPTIVE_TRIALS) {
+    if (!send()) {
+      finish();
+      return TASK_STOP;
+    }
+    return IR_ADAPTIVE_POLL;
+  }
+
+  LOG_INFO(LOG_MSG_IR_ADAPTIVE_TRIAL, (unsigned)trial.carrierKHz, (unsigned)trial.duty, (unsigned)trial.repeats,
+           (unsigned)trial.hits, (unsigned)trial.sent, (unsigned long)trial.errorUs);
+  // More hits win, then less timing error; repeats only count for hits
+  bool better = best.sent == 0 || trial.hits > best.hits ||
+                (phase != IR_ADAPTIVE_REPEATS && trial.hits == best.hits && trial.hits > 0 &&
+                 trial.errorUs < best.errorUs);
+  if (better) {
+    best = trial;
+  }
+  if (!nextTrial() || !send()) {
+    finish();
+    return TASK_STOP;
+  }
+  return IR_ADAPTIVE_POLL;
+}
+
+IrAdaptivePhase IrAdaptive::getPhase() const {
+  return phase;
+}
+
+const char* IrAdaptive::getName() const {
+  return name;
+}
+
+const IrAdaptiveTrial& IrAdaptive::getTrial() const {
+  return trial;
+}
+
+const IrAdaptiveTrial& IrAdaptive::getBest() const {
+  return best;
+}
+
+const IrCode& IrAdaptive::getCode() const {
+  return code;
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#ifndef IR_ADAPTIVE_H
+#define IR_ADAPTIVE_H
+
+#include <Arduino.h>
+#include "IrCode.h"
+#include "IrCapture.h"
+#include "IrTxQueue.h"
+
+#define IR_ADAPTIVE_TRIALS 3        // sends per set of parameters
+#define IR_ADAPTIVE_MAX_REPEATS 3   // extra frames tried at most
+#define IR_ADAPTIVE_SETTLE 20       // ms the receiver gets to close the last frame
+#define IR_ADAPTIVE_POLL 10         // ms between checks while a send is on the air
+#define IR_ADAPTIVE_TOLERANCE 25    // percent a RAW duration may be off and still match
+
+enum IrAdaptivePhase : uint8_t {
+  IR_ADAPTIVE_IDLE,
+  IR_ADAPTIVE_CARRIER,  // carriers around the code's own
+  IR_ADAPTIVE_DUTY,     // duty cycles on the best carrier
+  IR_ADAPTIVE_REPEATS,  // extra frames, until every send gets through
+  IR_ADAPTIVE_DONE,     // best parameters stored in the library
+  IR_ADAPTIVE_FAILED    // nothing came back, or the code can't be sent
+};
+
+// One set of transmit parameters and how it did
+struct IrAdaptiveTrial {
+  uint8_t carrierKHz;
+  uint8_t duty;      // percent
+  uint8_t repeats;
+  uint8_t sent;
+  uint8_t hits;      // sends received and decoded as the code
+  uint32_t errorUs;  // mean timing error per duration of the frames received
+};
+
+// ADAPTIVE SEND: closed-loop tuning of one library code, with the
+// onboard receiver watching the LED. Each set of parameters goes out
+// IR_ADAPTIVE_TRIALS times through the sequencer, and what the receiver
+// makes of it is decoded and compared with what was sent. The carrier
+// is tuned first, then the duty cycle on it, then the fewest repeats
+// that get every send through. The code's hit count and the winning
+// parameters are written back to its library record, unless no send
+// made it onto the air.
+class IrAdaptive {
+  public:
+    IrAdaptive();
+
+    // Tunes the code at a sorted library position; false if there is none
+    bool start(uint32_t position);
+    void stop();
+    bool isRunning() const;
+
+    // Runs from the menu's action task; returns ms until it needs to run
+    // again, TASK_STOP once tuning is over
+    uint32_t step();
+
+    IrAdaptivePhase getPhase() const;
+    const char* getName() const;
+    const IrAdaptiveTrial& getTrial() const;  // parameters on the air
+    const IrAdaptiveTrial& getBest() const;
+    const IrCode& getCode() const;  // trials and hits include this run once it is done
+
+  private:
+    IrCode code;
+    int32_t id;
+    char name[IR_KEY_FUNCTION + 1];
+    IrAdaptivePhase phase;
+    int8_t candidate;  // position in the phase's list of parameters
+    IrAdaptiveTrial trial;
+    IrAdaptiveTrial best;
+    uint16_t trials;   // sends of this run that went out with their carrier
+    uint16_t hits;
+    uint32_t failedBefore;  // irTxQueue.getFramesFailed() as the send started
+    bool waiting;      // a send is on the air
+    bool ownCapture;   // the receiver was off before start()
+    uint32_t idleSince;
+
+    uint16_t reference[IR_TX_MAX_DURATIONS];  // the code's frame, as sent
+    uint16_t referenceCount;
+    IrRawFrame received;
+
+    bool nextTrial();  // false once every phase is through
+    void setTrial(uint8_t carrierKHz, uint8_t duty, uint8_t repeats);
+    bool send();
+    bool collect();  // false if the send never went out
+    void finish();
+    bool matches(const IrRawFrame& frame, uint32_t& errorUs) const;
+};
+
+extern IrAdaptive irAdaptive;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "IrCapture.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+#define IR_ISR_ATTR IRAM_ATTR
+#else
+#define IR_ISR_ATTR
+#endif
+
+IrCapture irCapture;
+IrCapture* IrCapture::instance = nullptr;
+
+IrCapture::IrCapture()
+  : pin(IR_RECEIVE_PIN), active(false), lastEdge(0), overflowed(false),
+    collecting(false), frames(0), droppedFrames(0) {
+  pending.count = 0;
+}
+
+void IrCapture::begin(uint8_t receivePin) {
+  if (active) {
+    end();
+  }
+  pin = receivePin;
+  instance = this;
+  edges.clear();
+  overflowed = false;
+  collecting = false;
+  pending.count = 0;
+  // The line counts as idle for a full gap, so the first mark starts a frame
+  lastEdge = micros() - IR_CAPTURE_GAP;
+
+  pinMode(pin, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(pin), onEdge, CHANGE);
+  active = true;
+}
+
+void IrCapture::end() {
+  if (!active) {
+    return;
+  }
+  detachInterrupt(digitalPinToInterrupt(pin));
+  active = false;
+}
+
+bool IrCapture::isActive() const {
+  return active;
+}
+
+void IR_ISR_ATTR IrCapture::onEdge() {
+  instance->handleEdge(micros(), digitalRead(instance->pin) == LOW);
+}
+
+// Runs in the ISR: one subtraction and one push per edge. A falling edge
+// after an idle gap opens a frame; every other edge closes the mark or
+// space that preceded it.
+void IR_ISR_ATTR IrCapture::handleEdge(uint32_t now, bool mark) {
+  uint32_t elapsed = now - lastEdge;
+  lastEdge = now;
+
+  uint16_t duration;
+  if (elapsed >= IR_CAPTURE_GAP) {
+    if (!mark) {
+      return;  // stray rising edge on an idle line
+    }
+    duration = IR_CAPTURE_FRAME_START;
+  } else {
+    duration = elapsed > 0 ? elapsed : 1;
+  }
+  // Mark the hole first, so the foreground knows which frame it is in
+  if (overflowed) {
+    if (!edges.push(IR_CAPTURE_OVERFLOW)) {
+      return;
+    }
+    overflowed = false;
+  }
+  if (!edges.push(duration)) {
+    overflowed = true;
+  }
+}
+
+bool IrCapture::finishFrame(IrRawFrame& frame) {
+  bool complete = collecting && pending.count > 0;
+  if (complete) {
+    frame.count = pending.count;
+    memcpy(frame.durations, pending.durations, pending.count * sizeof(uint16_t));
+    frames++;
+  }
+  collecting = false;
+  pending.count = 0;
+  return complete;
+}
+
+// Discards the frame being assembled, if any, and skips to the next
+void IrCapture::dropFrame() {
+  if (collecting) {
+    droppedFrames++;
+  }
+  collecting = false;
+  pending.count = 0;
+}
+
+bool IrCapture::readFrame(IrRawFrame& frame) {
+  uint16_t duration;
+  while (edges.pop(duration)) {
+    if (duration == IR_CAPTURE_OVERFLOW) {
+      dropFrame();
+    } else if (duration == IR_CAPTURE_FRAME_START) {
+      bool complete = finishFrame(frame);
+      collecting = true;
+      if (complete) {
+        return true;
+      }
+    } else if (collecting) {
+      if (pending.count < IR_CAPTURE_MAX_EDGES) {
+        pending.durations[pending.count++] = duration;
+      } else {
+        dropFrame();
+      }
+    }
+  }
+
+  // The last frame has no successor to close it; it is done once the
+  // line has been idle for a full gap. Read lastEdge before re-checking
+  // the ring so an edge racing in here can only open the next frame.
+  uint32_t last = lastEdge;
+  if (!collecting || !edges.isEmpty() || micros() - last < IR_CAPTURE_GAP) {
+    return false;
+  }
+  // Durations lost with no edge since to mark the spot were lost after
+  // everything in the ring, so from this frame
+  if (overflowed) {
+    overflowed = false;
+    dropFrame();
+    return false;
+  }
+  // A capture ends on a mark; a trailing space only means the line is still low
+  if (pending.count % 2 == 0) {
+    return false;
+  }
+  return finishFrame(frame);
+}
+
+uint32_t IrCapture::getFrames() const {
+  return frames;
+}
+
+uint32_t IrCapture::getDroppedFrames() const {
+  return droppedFrames;
+}
\ No newline at end of file
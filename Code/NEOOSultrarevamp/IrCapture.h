@@ -0,0 +1,68 @@
+#ifndef IR_CAPTURE_H
+#define IR_CAPTURE_H
+
+#include <Arduino.h>
+#include "RingBuffer.h"
+
+// Demodulated receiver output (TSOP-style, active low), as wired in
+// infared_NEOV2.1
+#define IR_RECEIVE_PIN 5
+
+#define IR_CAPTURE_RING_SIZE 1024  // durations in flight, power of two
+#define IR_CAPTURE_MAX_EDGES 512   // durations kept per frame
+#define IR_CAPTURE_GAP 10000       // us of idle line that ends a frame
+
+// Pushed by the ISR in place of the idle gap before a frame's first mark
+#define IR_CAPTURE_FRAME_START 0
+// Pushed by the ISR where durations were lost to a full ring, as soon as
+// there is room again; no real duration reaches it (see IR_CAPTURE_GAP)
+#define IR_CAPTURE_OVERFLOW 0xFFFF
+
+// One received burst: mark, space, mark, ... in us, always ending on a mark
+struct IrRawFrame {
+  uint16_t count;
+  uint16_t durations[IR_CAPTURE_MAX_EDGES];
+};
+
+// Raw edge capture, independent of any protocol. The pin-change ISR only
+// timestamps the edge and pushes the elapsed time into an SPSC ring; the
+// foreground splits the stream into frames on idle gaps, so nothing is
+// lost at high edge rates while the loop is busy drawing.
+class IrCapture {
+  public:
+    IrCapture();
+
+    void begin(uint8_t pin = IR_RECEIVE_PIN);
+    void end();
+    bool isActive() const;
+
+    // Next complete frame, oldest first. Returns false when none is ready.
+    bool readFrame(IrRawFrame& frame);
+
+    uint32_t getFrames() const;          // frames handed out
+    uint32_t getDroppedFrames() const;   // lost to a full ring or too many edges
+
+  private:
+    RingBuffer<uint16_t, IR_CAPTURE_RING_SIZE> edges;
+    uint8_t pin;
+    bool active;
+    volatile uint32_t lastEdge;  // micros() of the last edge, written by the ISR
+    volatile bool overflowed;    // durations lost, IR_CAPTURE_OVERFLOW not yet pushed
+
+    // Frame being assembled, foreground only
+    IrRawFrame pending;
+    bool collecting;  // false while skipping the rest of a damaged frame
+    uint32_t frames;
+    uint32_t droppedFrames;
+
+    static IrCapture* instance;
+    static void onEdge();
+
+    void handleEdge(uint32_t now, bool mark);
+    bool finishFrame(IrRawFrame& frame);
+    void dropFrame();
+};
+
+extern IrCapture irCapture;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,90 @@
+#ifndef IR_CODE_H
+#define IR_CODE_H
+
+#include <Arduino.h>
+
+enum IrProtocol : uint8_t {
+  IR_PROTOCOL_RAW,  // timings stored alongside, see IrCode::rawOffset
+  IR_PROTOCOL_NEC,
+  IR_PROTOCOL_SAMSUNG,
+  IR_PROTOCOL_SONY,
+  IR_PROTOCOL_PANASONIC,
+  IR_PROTOCOL_JVC,
+  IR_PROTOCOL_RC5,
+  IR_PROTOCOL_COUNT
+};
+
+// Field widths of the sort key; names are zero-padded, not terminated
+#define IR_KEY_DEVICE 8
+#define IR_KEY_BRAND 12
+#define IR_KEY_FUNCTION 12
+
+// Library sort key. Comparing the whole struct bytewise orders codes by
+// device, then brand, then function, because shorter names are padded
+// with zeros.
+struct IrCodeKey {
+  char device[IR_KEY_DEVICE];
+  char brand[IR_KEY_BRAND];
+  char function[IR_KEY_FUNCTION];
+};
+
+#define IR_CODE_NO_RAW 0xFFFFFFFFUL
+
+// IrCode::flags
+#define IR_CODE_FLAG_REPEAT 0x01  // the protocol's repeat frame, not a keypress
+
+// One library record, stored as-is in little-endian flash. Fixed size so
+// record n lives at a computable offset.
+struct IrCode {
+  IrCodeKey key;
+  uint8_t protocol;    // IrProtocol
+  uint8_t bits;
+  uint8_t carrierKHz;
+  uint8_t flags;
+  uint32_t address;
+  uint32_t command;
+  uint32_t rawOffset;  // byte offset into the raw timing file, or IR_CODE_NO_RAW
+  uint16_t rawCount;   // durations in the frame at rawOffset
+  uint16_t rawBytes;   // its IrCodec-encoded size
+  // ADAPTIVE SEND results, zero until it has run on the code
+  uint16_t trials;          // loopback sends
+  uint16_t hits;            // of them, received and decoded as this code
+  uint8_t tunedCarrierKHz;  // carrier that worked best, 0 = carrierKHz
+  uint8_t tunedDuty;        // duty cycle in percent, 0 = the transmitter's
+  uint8_t tunedRepeats;     // extra frames a send needs to get through
+  uint8_t reserved[5];      // zero
+};
+
+static_assert(sizeof(IrCodeKey) == 32, "IrCodeKey layout is part of the file format");
+static_assert(sizeof(IrCode) == 64, "IrCode layout is part of the file format");
+
+// The carrier a code is sent on: ADAPTIVE SEND's pick if it made one
+static inline uint8_t irCodeCarrierKHz(const IrCode& code) {
+  return code.tunedCarrierKHz != 0 ? code.tunedCarrierKHz : code.carrierKHz;
+}
+
+static inline void irCodeKeyCopy(char* field, uint8_t width, const char* name) {
+  memset(field, 0, width);
+  if (name != nullptr) {
+    memcpy(field, name, strnlen(name, width));
+  }
+}
+
+// Fill a key from C strings, cutting names that don't fit; nullptr = empty
+static inline void irCodeKeySet(IrCodeKey& key, const char* device, const char* brand, const char* function) {
+  irCodeKeyCopy(key.device, IR_KEY_DEVICE, device);
+  irCodeKeyCopy(key.brand, IR_KEY_BRAND, brand);
+  irCodeKeyCopy(key.function, IR_KEY_FUNCTION, function);
+}
+
+static inline int irCodeKeyCompare(const IrCodeKey& a, const IrCodeKey& b) {
+  return memcmp(&a, &b, sizeof(IrCodeKey));
+}
+
+// Copy one padded field out as a C string; out needs width + 1 bytes
+static inline void irCodeKeyField(const char* field, uint8_t width, char* out) {
+  memcpy(out, field, width);
+  out[width] = '\0';
+}
+
+#endif
\ No newline at end of file
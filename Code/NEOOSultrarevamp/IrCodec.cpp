@@ -0,0 +1,251 @@
+#include "IrCodec.h"
+
+static uint32_t quantise(uint16_t duration) {
+  uint32_t ticks = (duration + IR_CODEC_TICK / 2) / IR_CODEC_TICK;
+  return ticks > 0 ? ticks : 1;
+}
+
+static bool near(uint32_t ticks, uint32_t center) {
+  uint32_t spread = max<uint32_t>(center / IR_CODEC_TOLERANCE, IR_CODEC_MIN_SPREAD);
+  return ticks + spread >= center && ticks <= center + spread;
+}
+
+static size_t putVarint(uint8_t* out, size_t used, size_t capacity, uint32_t value) {
+  do {
+    if (used == capacity) {
+      return 0;
+    }
+    uint8_t byte = value & 0x7F;
+    value >>= 7;
+    out[used++] = value != 0 ? (byte | 0x80) : byte;
+  } while (value != 0);
+  return used;
+}
+
+static uint8_t bitsFor(uint8_t symbolCount) {
+  uint8_t bits = 1;
+  while ((1U << bits) < symbolCount) {
+    bits++;
+  }
+  return bits;
+}
+
+// Symbols are running averages of the durations they absorb, in the
+// order they first appear. Returns 0 if the frame needs more of them.
+static uint8_t buildDictionary(const uint16_t* durations, uint16_t count, uint16_t* symbols) {
+  uint32_t sums[IR_CODEC_MAX_SYMBOLS];
+  uint16_t members[IR_CODEC_MAX_SYMBOLS];
+  uint8_t symbolCount = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    uint32_t ticks = quantise(durations[i]);
+    uint8_t s = 0;
+    while (s < symbolCount && !near(ticks, sums[s] / members[s])) {
+      s++;
+    }
+    if (s == symbolCount) {
+      if (symbolCount == IR_CODEC_MAX_SYMBOLS) {
+        return 0;
+      }
+      sums[s] = 0;
+      members[s] = 0;
+      symbolCount++;
+    }
+    sums[s] += ticks;
+    members[s]++;
+  }
+  for (uint8_t s = 0; s < symbolCount; s++) {
+    symbols[s] = (sums[s] + members[s] / 2) / members[s];
+  }
+  return symbolCount;
+}
+
+static uint8_t closest(const uint16_t* symbols, uint8_t symbolCount, uint32_t ticks) {
+  uint8_t best = 0;
+  uint32_t bestDistance = 0xFFFFFFFFUL;
+  for (uint8_t s = 0; s < symbolCount; s++) {
+    uint32_t distance = ticks > symbols[s] ? ticks - symbols[s] : symbols[s] - ticks;
+    if (distance < bestDistance) {
+      best = s;
+      bestDistance = distance;
+    }
+  }
+  return best;
+}
+
+size_t irCodecEncode(const uint16_t* durations, uint16_t count, uint8_t* out, size_t capacity) {
+  if (capacity < IR_CODEC_HEADER) {
+    return 0;
+  }
+  uint16_t symbols[IR_CODEC_MAX_SYMBOLS];
+  uint8_t symbolCount = buildDictionary(durations, count, symbols);
+  out[0] = symbolCount > 0 ? IR_CODEC_DICTIONARY : IR_CODEC_VARINT;
+  out[1] = IR_CODEC_TICK;
+  out[2] = count;
+  out[3] = count >> 8;
+  size_t used = IR_CODEC_HEADER;
+
+  if (symbolCount == 0) {
+    for (uint16_t i = 0; i < count && used > 0; i++) {
+      used = putVarint(out, used, capacity, quantise(durations[i]));
+    }
+    return used;
+  }
+
+  if (used == capacity) {
+    return 0;
+  }
+  out[used++] = symbolCount;
+  for (uint8_t s = 0; s < symbolCount && used > 0; s++) {
+    used = putVarint(out, used, capacity, symbols[s]);
+  }
+  uint8_t bits = bitsFor(symbolCount);
+  uint32_t bitBuffer = 0;
+  uint8_t bitCount = 0;
+  for (uint16_t i = 0; i < count && used > 0; i++) {
+    bitBuffer |= (uint32_t)closest(symbols, symbolCount, quantise(durations[i])) << bitCount;
+    bitCount += bits;
+    while (bitCount >= 8 || (i + 1 == count && bitCount > 0)) {
+      if (used == capacity) {
+        return 0;
+      }
+      out[used++] = bitBuffer;
+      bitBuffer >>= 8;
+      bitCount = bitCount >= 8 ? bitCount - 8 : 0;
+    }
+  }
+  return used;
+}
+
+IrCodecReader::IrCodecReader()
+  : data(nullptr), length(0), position(0), source(nullptr), sourceContext(nullptr), mode(0), tick(0),
+    count(0), emitted(0), symbolCount(0), bits(0), bitBuffer(0), bitCount(0) {
+}
+
+// From memory, or from the source once the chunk in hand is used up
+bool IrCodecReader::readByte(uint8_t& byte) {
+  if (position == length) {
+    if (source == nullptr) {
+      return false;
+    }
+    length = source(chunk, sizeof(chunk), sourceContext);
+    position = 0;
+    if (length == 0) {
+      return false;
+    }
+  }
+  byte = data[position++];
+  return true;
+}
+
+bool IrCodecReader::readVarint(uint32_t& value) {
+  value = 0;
+  uint8_t byte;
+  for (uint8_t shift = 0; shift < 32 && readByte(byte); shift += 7) {
+    value |= (uint32_t)(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool IrCodecReader::begin(const uint8_t* encoded, size_t size) {
+  data = encoded;
+  length = size;
+  source = nullptr;
+  return start();
+}
+
+bool IrCodecReader::begin(IrCodecSource frameSource, void* context) {
+  data = chunk;
+  length = 0;
+  source = frameSource;
+  sourceContext = context;
+  return start();
+}
+
+bool IrCodecReader::start() {
+  position = 0;
+  count = 0;
+  emitted = 0;
+  symbolCount = 0;
+  bitBuffer = 0;
+  bitCount = 0;
+  uint8_t header[IR_CODEC_HEADER];
+  for (uint8_t i = 0; i < IR_CODEC_HEADER; i++) {
+    if (!readByte(header[i])) {
+      return false;
+    }
+  }
+  if (header[1] == 0) {
+    return false;
+  }
+  mode = header[0];
+  tick = header[1];
+  count = header[2] | (header[3] << 8);
+  if (mode == IR_CODEC_VARINT) {
+    return true;
+  }
+  if (mode != IR_CODEC_DICTIONARY || !readByte(symbolCount) ||
+      symbolCount == 0 || symbolCount > IR_CODEC_MAX_SYMBOLS) {
+    count = 0;
+    return false;
+  }
+  for (uint8_t s = 0; s < symbolCount; s++) {
+    uint32_t ticks;
+    if (!readVarint(ticks)) {
+      count = 0;
+      return false;
+    }
+    symbols[s] = min<uint32_t>(ticks * tick, 0xFFFF);
+  }
+  bits = bitsFor(symbolCount);
+  return true;
+}
+
+uint16_t IrCodecReader::getCount() const {
+  return count;
+}
+
+bool IrCodecReader::next(uint16_t& duration) {
+  if (emitted == count) {
+    return false;
+  }
+  if (mode == IR_CODEC_VARINT) {
+    uint32_t ticks;
+    if (!readVarint(ticks)) {
+      return false;
+    }
+    duration = min<uint32_t>(ticks * tick, 0xFFFF);
+  } else {
+    if (bitCount < bits) {
+      uint8_t byte;
+      if (!readByte(byte)) {
+        return false;
+      }
+      bitBuffer |= (uint32_t)byte << bitCount;
+      bitCount += 8;
+    }
+    uint8_t index = bitBuffer & ((1U << bits) - 1);
+    bitBuffer >>= bits;
+    bitCount -= bits;
+    if (index >= symbolCount) {
+      return false;
+    }
+    duration = symbols[index];
+  }
+  emitted++;
+  return true;
+}
+
+uint16_t irCodecDecode(const uint8_t* data, size_t length, uint16_t* durations, uint16_t capacity) {
+  IrCodecReader reader;
+  if (!reader.begin(data, length)) {
+    return 0;
+  }
+  uint16_t written = 0;
+  while (written < capacity && reader.next(durations[written])) {
+    written++;
+  }
+  return written;
+}
\ No newline at end of file
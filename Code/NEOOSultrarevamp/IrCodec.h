@@ -0,0 +1,77 @@
+#ifndef IR_CODEC_H
+#define IR_CODEC_H
+
+#include <Arduino.h>
+
+#define IR_CODEC_TICK 10          // us per quantisation step
+#define IR_CODEC_MAX_SYMBOLS 16   // dictionary entries per frame
+#define IR_CODEC_TOLERANCE 8      // durations within 1/8 of a symbol share it
+#define IR_CODEC_MIN_SPREAD 4     // ... or within this many ticks
+#define IR_CODEC_HEADER 4
+#define IR_CODEC_CHUNK 32         // bytes a reader on an IrCodecSource holds at once
+
+// Worst-case encoded size of a frame of count durations
+#define IR_CODEC_MAX_SIZE(count) (IR_CODEC_HEADER + 1 + 2 * IR_CODEC_MAX_SYMBOLS + 2 * (count))
+
+// Encoded frame, little-endian:
+//   u8 mode, u8 tick in us, u16 duration count, then by mode
+//   IR_CODEC_DICTIONARY  u8 symbol count n, n varint symbols in ticks,
+//                        then one index per duration, packed LSB first
+//                        at the fewest bits that hold n - 1
+//   IR_CODEC_VARINT      one varint per duration in ticks
+// Varints are LEB128: 7 bits per byte, high bit set on all but the last.
+enum IrCodecMode : uint8_t {
+  IR_CODEC_DICTIONARY = 1,
+  IR_CODEC_VARINT = 2
+};
+
+// Quantises durations to IR_CODEC_TICK and, when the frame has at most
+// IR_CODEC_MAX_SYMBOLS distinct lengths (every protocol-shaped signal),
+// replaces each duration with a few bits indexing a per-frame dictionary
+// of their averages. Noisy frames fall back to varints. Returns the
+// encoded size, or 0 if out is too small.
+size_t irCodecEncode(const uint16_t* durations, uint16_t count, uint8_t* out, size_t capacity);
+
+// Supplies the next bytes of an encoded frame, at most size of them.
+// Returns how many were written to buffer, 0 at the end.
+typedef size_t (*IrCodecSource)(uint8_t* buffer, size_t size, void* context);
+
+// Streaming decoder: yields one duration at a time straight from the
+// encoded bytes, so a frame can be sent without expanding it in RAM.
+class IrCodecReader {
+  public:
+    IrCodecReader();
+
+    bool begin(const uint8_t* data, size_t length);  // false if not a valid frame
+    // Same for a frame that is not in RAM, e.g. on flash: it is pulled
+    // from source IR_CODEC_CHUNK bytes at a time as durations are read
+    bool begin(IrCodecSource source, void* context);
+    uint16_t getCount() const;                        // durations in the frame
+    bool next(uint16_t& duration);                    // false at the end or on bad data
+
+  private:
+    const uint8_t* data;
+    size_t length;
+    size_t position;
+    IrCodecSource source;
+    void* sourceContext;
+    uint8_t chunk[IR_CODEC_CHUNK];
+    uint8_t mode;
+    uint8_t tick;
+    uint16_t count;
+    uint16_t emitted;
+    uint16_t symbols[IR_CODEC_MAX_SYMBOLS];  // in us
+    uint8_t symbolCount;
+    uint8_t bits;
+    uint32_t bitBuffer;
+    uint8_t bitCount;
+
+    bool start();
+    bool readByte(uint8_t& byte);
+    bool readVarint(uint32_t& value);
+};
+
+// Decode a whole frame into durations; returns how many were written
+uint16_t irCodecDecode(const uint8_t* data, size_t length, uint16_t* durations, uint16_t capacity);
+
+#endif
\ No newline at end of file
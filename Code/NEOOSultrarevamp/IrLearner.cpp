@@ -0,0 +1,242 @@
+#include "IrLearner.h"
+#include "IrCodec.h"
+#include "IrLibrary.h"
+#include "IrProtocols.h"
+#include "IrTransmitter.h"
+#include "Log.h"
+
+IrLearner irLearner;
+
+// FNV-1a, never 0 so that marks a free slot
+static uint32_t hashBytes(uint32_t hash, const void* data, size_t length) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ bytes[i]) * 16777619UL;
+  }
+  return hash;
+}
+
+// A decoded frame is its key press; receiver jitter doesn't matter
+static uint32_t hashCode(const IrCode& code) {
+  uint32_t hash = 2166136261UL;
+  hash = hashBytes(hash, &code.protocol, sizeof(code.protocol));
+  hash = hashBytes(hash, &code.bits, sizeof(code.bits));
+  hash = hashBytes(hash, &code.address, sizeof(code.address));
+  hash = hashBytes(hash, &code.command, sizeof(code.command));
+  return hash != 0 ? hash : 1;
+}
+
+// Raw timings are hashed as multiples of the frame's unit, the average
+// of its shortest durations, so the jitter between two presses of a key
+// doesn't change the hash
+static uint32_t hashFrame(const IrRawFrame& frame) {
+  uint16_t shortest = 0xFFFF;
+  for (uint16_t i = 0; i < frame.count; i++) {
+    shortest = min(shortest, frame.durations[i]);
+  }
+  uint32_t sum = 0;
+  uint16_t counted = 0;
+  for (uint16_t i = 0; i < frame.count; i++) {
+    if (frame.durations[i] < shortest + shortest / 2) {
+      sum += frame.durations[i];
+      counted++;
+    }
+  }
+  uint32_t unit = max<uint32_t>(counted > 0 ? sum / counted : 1, 1);
+  uint32_t hash = hashBytes(2166136261UL, &frame.count, sizeof(frame.count));
+  for (uint16_t i = 0; i < frame.count; i++) {
+    uint16_t units = (frame.durations[i] + unit / 2) / unit;
+    hash = hashBytes(hash, &units, sizeof(units));
+  }
+  return hash != 0 ? hash : 1;
+}
+
+IrLearner::IrLearner()
+  : heldCount(0), poolUsed(0), recentCount(0), lastNew(false), lastFailed(false), ownCapture(false), learned(0),
+    duplicates(0), repeats(0), saved(0), failed(0) {
+  memset(recent, 0, sizeof(recent));
+  memset(&last, 0, sizeof(last));
+  frame.count = 0;
+}
+
+void IrLearner::begin() {
+  heldCount = 0;
+  poolUsed = 0;
+  memset(recent, 0, sizeof(recent));
+  recentCount = 0;
+  memset(&last, 0, sizeof(last));
+  lastNew = false;
+  lastFailed = false;
+  learned = 0;
+  duplicates = 0;
+  repeats = 0;
+  saved = 0;
+  failed = 0;
+  ownCapture = !irCapture.isActive();
+  irCapture.begin();
+}
+
+void IrLearner::end() {
+  commit();
+  if (ownCapture) {
+    irCapture.end();
+  }
+}
+
+// Open addressing with linear probing. The set only has to cover the
+// recent past, so once it is three quarters full it starts over rather
+// than growing.
+bool IrLearner::isRecent(uint32_t hash) const {
+  uint32_t slot = hash & (IR_LEARN_RECENT - 1);
+  while (recent[slot] != 0) {
+    if (recent[slot] == hash) {
+      return true;
+    }
+    slot = (slot + 1) & (IR_LEARN_RECENT - 1);
+  }
+  return false;
+}
+
+// Only for a hash isRecent() has just said is not in the set
+void IrLearner::remember(uint32_t hash) {
+  if (recentCount >= IR_LEARN_RECENT * 3 / 4) {
+    memset(recent, 0, sizeof(recent));
+    recentCount = 0;
+  }
+  uint32_t slot = hash & (IR_LEARN_RECENT - 1);
+  while (recent[slot] != 0) {
+    slot = (slot + 1) & (IR_LEARN_RECENT - 1);
+  }
+  recent[slot] = hash;
+  recentCount++;
+}
+
+uint16_t IrLearner::poll() {
+  uint16_t added = 0;
+  while (irCapture.readFrame(frame)) {
+    memset(&last, 0, sizeof(last));
+    lastNew = false;
+    lastFailed = false;
+    bool decoded = irDecode(frame.durations, frame.count, last);
+    if (!decoded) {
+      last.protocol = IR_PROTOCOL_RAW;
+      last.carrierKHz = IR_DEFAULT_CARRIER / 1000;
+    }
+    // Repeat frames say "still held", and short bursts are stray light
+    if ((decoded && (last.flags & IR_CODE_FLAG_REPEAT)) || (!decoded && frame.count < IR_LEARN_MIN_DURATIONS)) {
+      repeats++;
+      continue;
+    }
+    uint32_t hash = decoded ? hashCode(last) : hashFrame(frame);
+    if (isRecent(hash)) {
+      duplicates++;
+      continue;
+    }
+    // A code that could not be held is not seen yet: the next press of
+    // that key tries again
+    if (!hold(last)) {
+      lastFailed = true;
+      failed++;
+      continue;
+    }
+    remember(hash);
+    lastNew = true;
+    learned++;
+    added++;
+  }
+  return added;
+}
+
+// Named as MenuSystem::saveCapture() names single captures, numbered on
+// from what the library and the batch hold
+bool IrLearner::hold(const IrCode& code) {
+  if (heldCount == IR_LEARN_BATCH && !commit()) {
+    return false;
+  }
+  IrCode& record = held[heldCount];
+  record = code;
+  record.rawOffset = IR_CODE_NO_RAW;
+  record.rawCount = 0;
+  record.rawBytes = 0;
+  char function[IR_KEY_FUNCTION + 1];
+  snprintf(function, sizeof(function), "CODE%03lu",
+           (unsigned long)(irLibrary.size() + heldCount + 1) % 100000000);
+  irCodeKeySet(record.key, IR_LEARN_DEVICE, irProtocolName(record.protocol), function);
+
+  if (record.protocol == IR_PROTOCOL_RAW) {
+    size_t length = irCodecEncode(frame.durations, frame.count, pool + poolUsed, IR_LEARN_POOL - poolUsed);
+    if (length == 0 && heldCount > 0) {
+      // Out of pool: save the batch and start the pool over
+      if (!commit()) {
+        return false;
+      }
+      return hold(code);
+    }
+    if (length == 0) {
+      return false;
+    }
+    record.rawOffset = poolUsed;
+    record.rawCount = frame.count;
+    record.rawBytes = length;
+    poolUsed += length;
+  }
+  heldCount++;
+  return true;
+}
+
+bool IrLearner::commit() {
+  if (heldCount == 0) {
+    return true;
+  }
+  if (!irLibrary.isOpen()) {
+    LOG_WARN(LOG_MSG_IR_LIBRARY_UNAVAILABLE);
+    lastFailed = true;
+    return false;
+  }
+  if (irLibrary.insertBatch(held, heldCount, pool, poolUsed) < 0) {
+    lastFailed = true;
+    return false;
+  }
+  lastFailed = false;
+  LOG_INFO(LOG_MSG_IR_LEARN_SAVED, (unsigned)heldCount, (unsigned)poolUsed);
+  saved += heldCount;
+  heldCount = 0;
+  poolUsed = 0;
+  return true;
+}
+
+uint16_t IrLearner::getHeld() const {
+  return heldCount;
+}
+
+uint16_t IrLearner::getLearned() const {
+  return learned;
+}
+
+uint16_t IrLearner::getDuplicates() const {
+  return duplicates;
+}
+
+uint16_t IrLearner::getRepeats() const {
+  return repeats;
+}
+
+uint16_t IrLearner::getSaved() const {
+  return saved;
+}
+
+uint16_t IrLearner::getFailed() const {
+  return failed;
+}
+
+const IrCode& IrLearner::getLast() const {
+  return last;
+}
+
+bool IrLearner::wasLastNew() const {
+  return lastNew;
+}
+
+bool IrLearner::wasLastFailed() const {
+  return lastFailed;
+}
\ No newline at end of file
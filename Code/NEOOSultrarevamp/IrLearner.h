@@ -0,0 +1,72 @@
+#ifndef IR_LEARNER_H
+#define IR_LEARNER_H
+
+#include <Arduino.h>
+#include "IrCode.h"
+#include "IrCapture.h"
+
+#define IR_LEARN_BATCH 48          // new codes held before they are saved
+#define IR_LEARN_POOL 8192         // bytes of encoded RAW timings held
+#define IR_LEARN_RECENT 128        // hash set slots, power of two
+#define IR_LEARN_MIN_DURATIONS 7   // shorter RAW bursts are noise, not a key
+#define IR_LEARN_DEVICE "LEARNED"  // key device of learned codes
+
+// Bulk remote learning: every frame the receiver finishes is taken in,
+// button after button, without leaving the screen. Protocol repeat
+// frames are dropped, and so is anything already seen this session,
+// which a small open-addressed set of frame hashes tells in O(1): a
+// held key or one pressed twice is stored once. New codes are kept in
+// RAM and go to the library with IrLibrary::insertBatch(), one write
+// per file for the whole batch instead of several per code.
+class IrLearner {
+  public:
+    IrLearner();
+
+    void begin();  // clears the session and starts the receiver
+    void end();    // saves what is held and stops the receiver
+
+    // Takes in the frames finished since the last call; returns how many
+    // were new codes. Saves by itself when the batch fills up.
+    uint16_t poll();
+    // Writes the held codes to the library; false if that failed
+    bool commit();
+
+    uint16_t getHeld() const;        // new codes not saved yet
+    uint16_t getLearned() const;     // new codes this session, saved or not
+    uint16_t getDuplicates() const;  // frames dropped as seen before
+    uint16_t getRepeats() const;     // protocol repeat frames and noise dropped
+    uint16_t getSaved() const;
+    uint16_t getFailed() const;      // new codes that could not be held
+    const IrCode& getLast() const;   // newest frame taken in, IR_PROTOCOL_RAW if undecoded
+    bool wasLastNew() const;
+    // The newest code could not be held, or the last save failed
+    bool wasLastFailed() const;
+
+  private:
+    IrCode held[IR_LEARN_BATCH];
+    uint16_t heldCount;
+    uint8_t pool[IR_LEARN_POOL];  // IrCodec frames of held RAW codes
+    size_t poolUsed;
+
+    uint32_t recent[IR_LEARN_RECENT];  // frame hashes, 0 = free
+    uint16_t recentCount;
+
+    IrRawFrame frame;
+    IrCode last;
+    bool lastNew;
+    bool lastFailed;
+    bool ownCapture;
+    uint16_t learned;
+    uint16_t duplicates;
+    uint16_t repeats;
+    uint16_t saved;
+    uint16_t failed;
+
+    bool isRecent(uint32_t hash) const;
+    void remember(uint32_t hash);
+    bool hold(const IrCode& code);
+};
+
+extern IrLearner irLearner;
+
+#endif
\ No newline at end of file
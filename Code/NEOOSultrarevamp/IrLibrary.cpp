@@ -0,0 +1,503 @@
+#include "IrLibrary.h"
+
+#include <LittleFS.h>
+
+IrLibrary irLibrary;
+
+IrLibrary::IrLibrary()
+  : open(false), codeCount(0), sortedCount(0), pendingCount(0), merges(0), entryReads(0),
+    rawLeft(0) {
+  dir[0] = '\0';
+}
+
+void IrLibrary::makePath(char* out, size_t size, const char* name) const {
+  snprintf(out, size, "%s/%s", dir, name);
+}
+
+// LittleFS only opens existing files for update, so create first
+File IrLibrary::openReadWrite(const char* name, bool truncate) {
+  char path[48];
+  makePath(path, sizeof(path), name);
+  if (truncate || !LittleFS.exists(path)) {
+    File created = LittleFS.open(path, "w");
+    if (!created) {
+      return File();
+    }
+    created.close();
+  }
+  return LittleFS.open(path, "r+");
+}
+
+static void putU32(uint8_t* out, uint32_t value) {
+  out[0] = value;
+  out[1] = value >> 8;
+  out[2] = value >> 16;
+  out[3] = value >> 24;
+}
+
+static uint32_t getU32(const uint8_t* in) {
+  return in[0] | (in[1] << 8) | (in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+bool IrLibrary::writeHeader(File& file, const char* magic, uint8_t itemSize, uint32_t count, uint32_t pending) {
+  uint8_t header[IR_LIBRARY_HEADER_SIZE] = {0};
+  memcpy(header, magic, 4);
+  header[4] = IR_LIBRARY_VERSION;
+  header[5] = itemSize;
+  putU32(header + 8, count);
+  putU32(header + 12, pending);
+  return file.seek(0) && file.write(header, sizeof(header)) == sizeof(header);
+}
+
+bool IrLibrary::readHeader(File& file, const char* magic, uint8_t itemSize, uint32_t& count, uint32_t& pending) {
+  uint8_t header[IR_LIBRARY_HEADER_SIZE];
+  if (!file.seek(0) || file.read(header, sizeof(header)) != sizeof(header)) {
+    return false;
+  }
+  if (memcmp(header, magic, 4) != 0 || header[4] != IR_LIBRARY_VERSION || header[5] != itemSize) {
+    return false;
+  }
+  count = getU32(header + 8);
+  pending = getU32(header + 12);
+  return true;
+}
+
+bool IrLibrary::begin(const char* directory) {
+  end();
+  if (!LittleFS.begin(true)) {
+    return false;
+  }
+  snprintf(dir, sizeof(dir), "%s", directory);
+  LittleFS.mkdir(dir);
+
+  uint32_t unused;
+  codes = openReadWrite("codes.bin", false);
+  if (!codes || !readHeader(codes, IR_LIBRARY_CODES_MAGIC, sizeof(IrCode), codeCount, unused)) {
+    // Missing or foreign: start an empty library
+    codeCount = 0;
+    codes = openReadWrite("codes.bin", true);
+    if (!codes || !writeHeader(codes, IR_LIBRARY_CODES_MAGIC, sizeof(IrCode), 0, 0)) {
+      return false;
+    }
+  }
+  raw = openReadWrite("raw.bin", codeCount == 0);
+  index = openReadWrite("index.bin", false);
+  if (!raw || !index) {
+    return false;
+  }
+  open = true;
+
+  // An index that doesn't cover every record (power lost mid-insert) is
+  // rebuilt from the records, which are always written first
+  if (!readHeader(index, IR_LIBRARY_INDEX_MAGIC, sizeof(IrIndexEntry), sortedCount, pendingCount) ||
+      sortedCount + pendingCount != codeCount) {
+    open = rebuildIndex();
+  }
+  return open;
+}
+
+void IrLibrary::end() {
+  codes.close();
+  index.close();
+  raw.close();
+  open = false;
+}
+
+bool IrLibrary::isOpen() const {
+  return open;
+}
+
+uint32_t IrLibrary::size() const {
+  return codeCount;
+}
+
+uint32_t IrLibrary::getMerges() const {
+  return merges;
+}
+
+uint32_t IrLibrary::getEntryReads() const {
+  return entryReads;
+}
+
+bool IrLibrary::rebuildIndex() {
+  index = openReadWrite("index.bin", true);
+  sortedCount = 0;
+  pendingCount = 0;
+  if (!index || !writeHeader(index, IR_LIBRARY_INDEX_MAGIC, sizeof(IrIndexEntry), 0, 0)) {
+    return false;
+  }
+  IrCode code;
+  for (uint32_t id = 0; id < codeCount; id++) {
+    if (!get(id, code)) {
+      return false;
+    }
+    IrIndexEntry entry;
+    entry.key = code.key;
+    entry.id = id;
+    if (!appendEntries(&entry, 1)) {
+      return false;
+    }
+  }
+  return flush();
+}
+
+bool IrLibrary::writeRecord(uint32_t id, const IrCode& code) {
+  return codes.seek(IR_LIBRARY_HEADER_SIZE + id * sizeof(IrCode)) &&
+         codes.write(reinterpret_cast<const uint8_t*>(&code), sizeof(IrCode)) == sizeof(IrCode);
+}
+
+bool IrLibrary::get(uint32_t id, IrCode& code) {
+  return open && id < codeCount && codes.seek(IR_LIBRARY_HEADER_SIZE + id * sizeof(IrCode)) &&
+         codes.read(reinterpret_cast<uint8_t*>(&code), sizeof(IrCode)) == sizeof(IrCode);
+}
+
+bool IrLibrary::update(uint32_t id, const IrCode& code) {
+  if (!open || id >= codeCount || !writeRecord(id, code)) {
+    return false;
+  }
+  codes.flush();
+  return true;
+}
+
+bool IrLibrary::openRaw(const IrCode& code, IrCodecReader& reader) {
+  if (!open || code.rawOffset == IR_CODE_NO_RAW || !raw.seek(code.rawOffset)) {
+    return false;
+  }
+  rawLeft = code.rawBytes;
+  return reader.begin(readRawChunk, this);
+}
+
+size_t IrLibrary::readRawChunk(uint8_t* buffer, size_t size, void* context) {
+  IrLibrary* library = static_cast<IrLibrary*>(context);
+  size_t length = library->raw.read(buffer, min<size_t>(size, library->rawLeft));
+  library->rawLeft -= length;
+  return length;
+}
+
+uint16_t IrLibrary::readRaw(const IrCode& code, uint16_t* durations, uint16_t capacity) {
+  IrCodecReader reader;
+  if (!openRaw(code, reader)) {
+    return 0;
+  }
+  uint16_t written = 0;
+  while (written < capacity && reader.next(durations[written])) {
+    written++;
+  }
+  return written;
+}
+
+bool IrLibrary::readEntries(uint32_t position, IrIndexEntry* entries, uint32_t count) {
+  entryReads += count;
+  size_t length = count * sizeof(IrIndexEntry);
+  return index.seek(IR_LIBRARY_HEADER_SIZE + position * sizeof(IrIndexEntry)) &&
+         index.read(reinterpret_cast<uint8_t*>(entries), length) == length;
+}
+
+// First sorted position whose key is not less than key
+uint32_t IrLibrary::lowerBound(const IrCodeKey& key) {
+  uint32_t low = 0;
+  uint32_t high = sortedCount;
+  while (low < high) {
+    uint32_t mid = low + (high - low) / 2;
+    IrIndexEntry entry;
+    if (!readEntries(mid, &entry, 1)) {
+      return sortedCount;
+    }
+    if (irCodeKeyCompare(entry.key, key) < 0) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+int32_t IrLibrary::find(const IrCodeKey& key, IrCode* code) {
+  if (!open) {
+    return -1;
+  }
+  int32_t id = -1;
+  IrIndexEntry entries[IR_LIBRARY_CHUNK];
+
+  uint32_t position = lowerBound(key);
+  if (position < sortedCount && readEntries(position, entries, 1) &&
+      irCodeKeyCompare(entries[0].key, key) == 0) {
+    id = entries[0].id;
+  }
+
+  // Newer codes sit unsorted after the sorted part
+  for (uint32_t done = 0; id < 0 && done < pendingCount;) {
+    uint32_t count = min<uint32_t>(pendingCount - done, IR_LIBRARY_CHUNK);
+    if (!readEntries(sortedCount + done, entries, count)) {
+      return -1;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+      if (irCodeKeyCompare(entries[i].key, key) == 0) {
+        id = entries[i].id;
+        break;
+      }
+    }
+    done += count;
+  }
+
+  if (id >= 0 && code != nullptr && !get(id, *code)) {
+    return -1;
+  }
+  return id;
+}
+
+int32_t IrLibrary::find(const char* device, const char* brand, const char* function, IrCode* code) {
+  IrCodeKey key;
+  irCodeKeySet(key, device, brand, function);
+  return find(key, code);
+}
+
+// Entries go to the pending tail, which takes at most
+// IR_LIBRARY_PENDING_MAX - pendingCount of them
+bool IrLibrary::appendEntries(const IrIndexEntry* entries, uint32_t count) {
+  uint32_t position = sortedCount + pendingCount;
+  size_t length = count * sizeof(IrIndexEntry);
+  if (!index.seek(IR_LIBRARY_HEADER_SIZE + position * sizeof(IrIndexEntry)) ||
+      index.write(reinterpret_cast<const uint8_t*>(entries), length) != length) {
+    return false;
+  }
+  pendingCount += count;
+  if (!writeHeader(index, IR_LIBRARY_INDEX_MAGIC, sizeof(IrIndexEntry), sortedCount, pendingCount)) {
+    return false;
+  }
+  return pendingCount < IR_LIBRARY_PENDING_MAX || flush();
+}
+
+int32_t IrLibrary::insert(const IrCode& code, const uint16_t* durations, uint16_t rawCount) {
+  if (!open) {
+    return -1;
+  }
+  IrCode record = code;
+  record.rawOffset = IR_CODE_NO_RAW;
+  record.rawCount = 0;
+  record.rawBytes = 0;
+  if (durations != nullptr && rawCount > 0) {
+    uint8_t encoded[IR_CODEC_MAX_SIZE(IR_LIBRARY_MAX_RAW)];
+    size_t length = rawCount <= IR_LIBRARY_MAX_RAW ? irCodecEncode(durations, rawCount, encoded, sizeof(encoded)) : 0;
+    // Timings are append-only; a replaced code leaves its old ones behind
+    if (length == 0 || !raw.seek(0, SeekEnd)) {
+      return -1;
+    }
+    record.rawOffset = raw.position();
+    if (raw.write(encoded, length) != length) {
+      return -1;
+    }
+    record.rawCount = rawCount;
+    record.rawBytes = length;
+    raw.flush();
+  }
+
+  int32_t id = find(record.key);
+  if (id >= 0) {
+    if (!writeRecord(id, record)) {
+      return -1;
+    }
+    codes.flush();
+    return id;
+  }
+
+  // Record first: an index entry must never point past the records
+  id = codeCount;
+  if (!writeRecord(id, record)) {
+    return -1;
+  }
+  codeCount++;
+  if (!writeHeader(codes, IR_LIBRARY_CODES_MAGIC, sizeof(IrCode), codeCount, 0)) {
+    return -1;
+  }
+  codes.flush();
+
+  IrIndexEntry entry;
+  entry.key = record.key;
+  entry.id = id;
+  if (!appendEntries(&entry, 1)) {
+    return -1;
+  }
+  index.flush();
+  return id;
+}
+
+int32_t IrLibrary::insertBatch(IrCode* batch, uint16_t count, const uint8_t* encoded, size_t encodedLength) {
+  if (!open || count == 0) {
+    return -1;
+  }
+  for (uint16_t i = 0; i < count; i++) {
+    if (find(batch[i].key) >= 0) {
+      return -1;
+    }
+    for (uint16_t j = 0; j < i; j++) {
+      if (irCodeKeyCompare(batch[i].key, batch[j].key) == 0) {
+        return -1;
+      }
+    }
+  }
+
+  uint32_t rawBase = 0;
+  if (encodedLength > 0) {
+    if (!raw.seek(0, SeekEnd)) {
+      return -1;
+    }
+    rawBase = raw.position();
+    if (raw.write(encoded, encodedLength) != encodedLength) {
+      return -1;
+    }
+    raw.flush();
+  }
+  for (uint16_t i = 0; i < count; i++) {
+    if (batch[i].rawOffset != IR_CODE_NO_RAW) {
+      batch[i].rawOffset += rawBase;
+    }
+  }
+
+  // Records first, as in insert()
+  int32_t first = codeCount;
+  size_t length = count * sizeof(IrCode);
+  if (!codes.seek(IR_LIBRARY_HEADER_SIZE + first * sizeof(IrCode)) ||
+      codes.write(reinterpret_cast<const uint8_t*>(batch), length) != length) {
+    return -1;
+  }
+  codeCount += count;
+  if (!writeHeader(codes, IR_LIBRARY_CODES_MAGIC, sizeof(IrCode), codeCount, 0)) {
+    return -1;
+  }
+  codes.flush();
+
+  // Index entries in as few writes as the pending tail allows
+  IrIndexEntry entries[IR_LIBRARY_CHUNK];
+  uint16_t added = 0;
+  while (added < count) {
+    uint32_t room = min<uint32_t>(IR_LIBRARY_CHUNK, IR_LIBRARY_PENDING_MAX - pendingCount);
+    uint32_t chunk = min<uint32_t>(count - added, room);
+    for (uint32_t i = 0; i < chunk; i++) {
+      entries[i].key = batch[added + i].key;
+      entries[i].id = first + added + i;
+    }
+    if (!appendEntries(entries, chunk)) {
+      return -1;
+    }
+    added += chunk;
+  }
+  index.flush();
+  return first;
+}
+
+// Sort the pending tail in RAM and stream it together with the sorted
+// part into a new index file, which then replaces the old one
+bool IrLibrary::flush() {
+  if (!open) {
+    return false;
+  }
+  if (pendingCount == 0) {
+    return true;
+  }
+
+  IrIndexEntry pending[IR_LIBRARY_PENDING_MAX];
+  if (!readEntries(sortedCount, pending, pendingCount)) {
+    return false;
+  }
+  for (uint32_t i = 1; i < pendingCount; i++) {
+    IrIndexEntry entry = pending[i];
+    uint32_t j = i;
+    while (j > 0 && irCodeKeyCompare(pending[j - 1].key, entry.key) > 0) {
+      pending[j] = pending[j - 1];
+      j--;
+    }
+    pending[j] = entry;
+  }
+
+  File merged = openReadWrite("index.tmp", true);
+  uint32_t total = sortedCount + pendingCount;
+  if (!merged || !writeHeader(merged, IR_LIBRARY_INDEX_MAGIC, sizeof(IrIndexEntry), total, 0)) {
+    return false;
+  }
+
+  IrIndexEntry in[IR_LIBRARY_CHUNK];
+  IrIndexEntry out[IR_LIBRARY_CHUNK];
+  uint32_t inCount = 0;
+  uint32_t inAt = 0;
+  uint32_t nextSorted = 0;
+  uint32_t nextPending = 0;
+  uint32_t outCount = 0;
+  for (uint32_t written = 0; written < total; written++) {
+    if (inAt == inCount && nextSorted < sortedCount) {
+      // merged is a separate file, so index can be read while writing
+      inCount = min<uint32_t>(sortedCount - nextSorted, IR_LIBRARY_CHUNK);
+      if (!readEntries(nextSorted, in, inCount)) {
+        return false;
+      }
+      nextSorted += inCount;
+      inAt = 0;
+    }
+    bool takeSorted = inAt < inCount &&
+                      (nextPending == pendingCount || irCodeKeyCompare(in[inAt].key, pending[nextPending].key) <= 0);
+    out[outCount++] = takeSorted ? in[inAt++] : pending[nextPending++];
+    if (outCount == IR_LIBRARY_CHUNK || written + 1 == total) {
+      size_t length = outCount * sizeof(IrIndexEntry);
+      if (merged.write(reinterpret_cast<const uint8_t*>(out), length) != length) {
+        return false;
+      }
+      outCount = 0;
+    }
+  }
+  merged.close();
+  index.close();
+
+  char from[48];
+  char to[48];
+  makePath(from, sizeof(from), "index.tmp");
+  makePath(to, sizeof(to), "index.bin");
+  LittleFS.remove(to);
+  if (!LittleFS.rename(from, to)) {
+    open = false;
+    return false;
+  }
+  index = openReadWrite("index.bin", false);
+  sortedCount = total;
+  pendingCount = 0;
+  merges++;
+  return (bool)index;
+}
+
+uint32_t IrLibrary::list(IrLibraryVisitor visitor, void* context, const char* device,
+                         const char* brand, uint32_t skip, uint32_t limit) {
+  if (!flush()) {
+    return 0;
+  }
+
+  // Matches for a device/brand prefix are one contiguous sorted run
+  if (device == nullptr) {
+    brand = nullptr;
+  }
+  IrCodeKey prefix;
+  irCodeKeySet(prefix, device, brand, nullptr);
+  uint32_t position = device != nullptr ? lowerBound(prefix) : 0;
+  position += skip;
+
+  uint32_t visited = 0;
+  IrIndexEntry entries[IR_LIBRARY_CHUNK];
+  while (visited < limit && position < sortedCount) {
+    uint32_t count = min<uint32_t>(sortedCount - position, IR_LIBRARY_CHUNK);
+    count = min(count, limit - visited);
+    if (!readEntries(position, entries, count)) {
+      break;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+      const IrCodeKey& key = entries[i].key;
+      if ((device != nullptr && memcmp(key.device, prefix.device, IR_KEY_DEVICE) != 0) ||
+          (brand != nullptr && memcmp(key.brand, prefix.brand, IR_KEY_BRAND) != 0)) {
+        return visited;
+      }
+      visited++;
+      if (!visitor(key, entries[i].id, context)) {
+        return visited;
+      }
+    }
+    position += count;
+  }
+  return visited;
+}
\ No newline at end of file
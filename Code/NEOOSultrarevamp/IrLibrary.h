@@ -0,0 +1,117 @@
+#ifndef IR_LIBRARY_H
+#define IR_LIBRARY_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "IrCode.h"
+#include "IrCodec.h"
+
+#define IR_LIBRARY_DIR "/irlib"
+#define IR_LIBRARY_PENDING_MAX 32  // unsorted index entries before a merge
+#define IR_LIBRARY_CHUNK 16        // index entries per read when streaming
+#define IR_LIBRARY_MAX_RAW 512     // durations per raw code, as captured
+
+// On-flash layout, little-endian, three files under IR_LIBRARY_DIR:
+//   codes.bin  header, then IrCode records in insertion order; a code's
+//              id is its record number and never changes
+//   index.bin  header, then IrIndexEntry sorted by key, then up to
+//              IR_LIBRARY_PENDING_MAX newer entries in insertion order
+//   raw.bin    IrCodec frames referenced by IrCode::rawOffset
+// Headers are 16 bytes: magic, u8 version, u8 item size, u16 zero,
+// u32 count (codes.bin: records; index.bin: sorted entries), u32 pending.
+#define IR_LIBRARY_CODES_MAGIC "NIRC"
+#define IR_LIBRARY_INDEX_MAGIC "NIRX"
+#define IR_LIBRARY_VERSION 2
+#define IR_LIBRARY_HEADER_SIZE 16
+
+struct IrIndexEntry {
+  IrCodeKey key;
+  uint32_t id;
+};
+
+// Called per listed code in key order; return false to stop
+typedef bool (*IrLibraryVisitor)(const IrCodeKey& key, uint32_t id, void* context);
+
+// Persistent code library. Every operation works on a few records at a
+// time through seeks, so RAM use does not grow with the library:
+// lookups binary-search the sorted index and scan the short pending
+// tail, inserts append, and the tail is merged into the sorted part in
+// one streaming pass once it fills up.
+class IrLibrary {
+  public:
+    IrLibrary();
+
+    // Mounts LittleFS and opens (or creates) the library under dir
+    bool begin(const char* dir = IR_LIBRARY_DIR);
+    void end();
+    bool isOpen() const;
+
+    uint32_t size() const;  // codes stored
+
+    // Adds a code, or replaces the one with the same key. raw timings are
+    // stored compressed for IR_PROTOCOL_RAW, at most IR_LIBRARY_MAX_RAW of
+    // them. Returns the id, or -1 on failure.
+    int32_t insert(const IrCode& code, const uint16_t* raw = nullptr, uint16_t rawCount = 0);
+
+    // Adds new codes with one write per file instead of several per code.
+    // Timings come pre-encoded: encoded holds IrCodec frames back to back,
+    // and a code's rawOffset is where its frame starts in there (rawBytes
+    // its length), IR_CODE_NO_RAW if it has none. Keys must be distinct
+    // and not stored yet, or nothing is added. Offsets are rewritten to
+    // the file's. Returns the first id, or -1.
+    int32_t insertBatch(IrCode* codes, uint16_t count, const uint8_t* encoded = nullptr, size_t encodedLength = 0);
+
+    // Returns the id of the code with this key, or -1
+    int32_t find(const IrCodeKey& key, IrCode* code = nullptr);
+    int32_t find(const char* device, const char* brand, const char* function, IrCode* code = nullptr);
+
+    bool get(uint32_t id, IrCode& code);
+    // Rewrites a stored record in place, for its statistics and tuning;
+    // the key and raw timings must stay as they are
+    bool update(uint32_t id, const IrCode& code);
+    // Decodes a code's raw timings from flash a chunk at a time, so only
+    // durations needs room for the whole frame
+    uint16_t readRaw(const IrCode& code, uint16_t* durations, uint16_t capacity);
+    // Starts reader on a code's raw timings. Until it is done, no other
+    // call may touch the library: reader reads the file as it goes.
+    bool openRaw(const IrCode& code, IrCodecReader& reader);
+
+    // Codes in key order, optionally only one device (and brand of it), skipping
+    // the first `skip` matches. Returns how many were visited.
+    uint32_t list(IrLibraryVisitor visitor, void* context, const char* device = nullptr,
+                  const char* brand = nullptr, uint32_t skip = 0, uint32_t limit = 0xFFFFFFFFUL);
+
+    // Merge the pending index tail into the sorted part
+    bool flush();
+
+    uint32_t getMerges() const;
+    uint32_t getEntryReads() const;  // index entries read, for benchmarks
+
+  private:
+    char dir[24];
+    File codes;
+    File index;
+    File raw;
+    bool open;
+    uint32_t codeCount;
+    uint32_t sortedCount;
+    uint32_t pendingCount;
+    uint32_t merges;
+    uint32_t entryReads;
+    uint32_t rawLeft;  // bytes of the frame openRaw() started that are unread
+
+    void makePath(char* out, size_t size, const char* name) const;
+    File openReadWrite(const char* name, bool truncate);
+    bool writeHeader(File& file, const char* magic, uint8_t itemSize, uint32_t count, uint32_t pending);
+    bool readHeader(File& file, const char* magic, uint8_t itemSize, uint32_t& count, uint32_t& pending);
+    bool rebuildIndex();
+    bool appendEntries(const IrIndexEntry* entries, uint32_t count);
+    bool readEntries(uint32_t position, IrIndexEntry* entries, uint32_t count);
+    uint32_t lowerBound(const IrCodeKey& key);
+    bool writeRecord(uint32_t id, const IrCode& code);
+    static size_t readRawChunk(uint8_t* buffer, size_t size, void* context);
+};
+
+extern IrLibrary irLibrary;
+
+#endif
\ No newline at end of file
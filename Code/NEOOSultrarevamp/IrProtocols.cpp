@@ -0,0 +1,294 @@
+#include "IrProtocols.h"
+
+static const char* const protocolNames[IR_PROTOCOL_COUNT] = {
+  "RAW", "NEC", "SAMSUNG", "SONY", "PANASONIC", "JVC", "RC5"
+};
+
+// Table order breaks ties between candidates that both match
+static const IrTiming timings[] = {
+  // protocol             encoding                     bits flags
+  //   header        zero mark/space  one mark/space   tol kHz  address  command  fixed  period
+  {IR_PROTOCOL_NEC,       IR_ENCODING_PULSE_DISTANCE,  32, IR_TIMING_STOP_MARK | IR_TIMING_ADDRESS_INVERTED | IR_TIMING_COMMAND_INVERTED,
+     9000, 4500,   560, 560,        560, 1690,       25, 38,  0, 16,  16, 16,  0, 108000},
+  {IR_PROTOCOL_NEC,       IR_ENCODING_PULSE_DISTANCE,   0, IR_TIMING_STOP_MARK | IR_TIMING_REPEAT,
+     9000, 2250,   560, 560,        560, 1690,       25, 38,  0, 0,   0, 0,    0, 108000},
+  {IR_PROTOCOL_SAMSUNG,   IR_ENCODING_PULSE_DISTANCE,  32, IR_TIMING_STOP_MARK | IR_TIMING_COMMAND_INVERTED,
+     4500, 4500,   560, 560,        560, 1690,       25, 38,  0, 16,  16, 16,  0, 108000},
+  {IR_PROTOCOL_JVC,       IR_ENCODING_PULSE_DISTANCE,  16, IR_TIMING_STOP_MARK,
+     8400, 4200,   526, 526,        526, 1578,       25, 38,  0, 8,   8, 8,    0, 55000},
+  {IR_PROTOCOL_SONY,      IR_ENCODING_PULSE_WIDTH,     12, 0,
+     2400, 600,    600, 600,        1200, 600,       25, 40,  7, 5,   0, 7,    0, 45000},
+  {IR_PROTOCOL_SONY,      IR_ENCODING_PULSE_WIDTH,     15, 0,
+     2400, 600,    600, 600,        1200, 600,       25, 40,  7, 8,   0, 7,    0, 45000},
+  {IR_PROTOCOL_SONY,      IR_ENCODING_PULSE_WIDTH,     20, 0,
+     2400, 600,    600, 600,        1200, 600,       25, 40,  7, 13,  0, 7,    0, 45000},
+  {IR_PROTOCOL_PANASONIC, IR_ENCODING_PULSE_DISTANCE,  48, IR_TIMING_STOP_MARK,
+     3456, 1728,   432, 432,        432, 1296,       25, 37,  0, 32,  32, 16,  0, 130000},
+  // Two start bits, toggle, 5 address bits, 6 command bits
+  {IR_PROTOCOL_RC5,       IR_ENCODING_BIPHASE,         14, IR_TIMING_MSB_FIRST,
+     0, 0,         889, 889,        889, 889,        25, 36,  6, 5,   0, 6,    0x3000, 113792},
+};
+
+#define TIMING_COUNT (sizeof(timings) / sizeof(timings[0]))
+
+static_assert(TIMING_COUNT <= 32, "candidates are a 32-bit mask");
+
+const char* irProtocolName(uint8_t protocol) {
+  return protocol < IR_PROTOCOL_COUNT ? protocolNames[protocol] : "?";
+}
+
+uint8_t irTimingCount() {
+  return TIMING_COUNT;
+}
+
+const IrTiming& irTiming(uint8_t index) {
+  return timings[index];
+}
+
+// Per-candidate progress through the frame
+struct IrCandidate {
+  uint64_t value;
+  uint8_t bit;        // bits decoded so far
+  uint8_t markMatch;  // pulse codings: bit 0 = zero mark fits, bit 1 = one mark fits
+  int8_t half;        // biphase: first half of the current bit, -1 = none yet
+};
+
+static bool matches(uint16_t measured, uint16_t expected, uint8_t tolerance) {
+  uint32_t difference = measured > expected ? measured - expected : expected - measured;
+  return difference * 100 <= (uint32_t)expected * tolerance;
+}
+
+static bool pushBit(const IrTiming& timing, IrCandidate& state, bool one) {
+  if (state.bit == timing.bits) {
+    return false;
+  }
+  if (timing.flags & IR_TIMING_MSB_FIRST) {
+    state.value = (state.value << 1) | one;
+  } else {
+    state.value |= (uint64_t)one << state.bit;
+  }
+  state.bit++;
+  return true;
+}
+
+// Biphase: bits are (space, mark) for 1 and (mark, space) for 0
+static bool pushHalf(const IrTiming& timing, IrCandidate& state, bool mark) {
+  if (state.half < 0) {
+    state.half = mark;
+    return true;
+  }
+  if (state.half == mark) {
+    return false;
+  }
+  state.half = -1;
+  return pushBit(timing, state, mark);
+}
+
+static uint8_t headerLength(const IrTiming& timing) {
+  return timing.headerMark != 0 ? 2 : 0;
+}
+
+// Consumes duration `edge` of the frame; false drops the candidate
+static bool step(const IrTiming& timing, IrCandidate& state, uint16_t edge, bool mark, uint16_t duration) {
+  uint8_t header = headerLength(timing);
+  if (edge < header) {
+    return matches(duration, mark ? timing.headerMark : timing.headerSpace, timing.tolerance);
+  }
+
+  if (timing.encoding == IR_ENCODING_BIPHASE) {
+    uint8_t halves = matches(duration, timing.zeroMark, timing.tolerance) ? 1 :
+                     matches(duration, 2 * timing.zeroMark, timing.tolerance) ? 2 : 0;
+    for (uint8_t i = 0; i < halves; i++) {
+      if (!pushHalf(timing, state, mark)) {
+        return false;
+      }
+    }
+    return halves > 0;
+  }
+
+  uint16_t position = edge - header;
+  if (position < 2 * timing.bits) {
+    if (mark) {
+      state.markMatch = matches(duration, timing.zeroMark, timing.tolerance) |
+                        (matches(duration, timing.oneMark, timing.tolerance) << 1);
+      return state.markMatch != 0;
+    }
+    bool zero = (state.markMatch & 1) && matches(duration, timing.zeroSpace, timing.tolerance);
+    bool one = (state.markMatch & 2) && matches(duration, timing.oneSpace, timing.tolerance);
+    return zero != one && pushBit(timing, state, one);
+  }
+  return position == 2 * timing.bits && (timing.flags & IR_TIMING_STOP_MARK) &&
+         matches(duration, timing.zeroMark, timing.tolerance);
+}
+
+// Frames end on a mark: a trailing space of the protocol is never seen
+static bool finish(const IrTiming& timing, IrCandidate& state, uint16_t count) {
+  if (timing.encoding == IR_ENCODING_BIPHASE) {
+    if (state.half == 1 && !pushHalf(timing, state, false)) {
+      return false;
+    }
+    return state.half < 0 && state.bit == timing.bits;
+  }
+  uint16_t position = count - headerLength(timing);
+  if (timing.flags & IR_TIMING_STOP_MARK) {
+    return position == 2 * timing.bits + 1;
+  }
+  if (timing.bits == 0 || position != 2 * timing.bits - 1) {
+    return false;
+  }
+  // The last bit is decided by its mark alone
+  return (state.markMatch == 1 || state.markMatch == 2) && pushBit(timing, state, state.markMatch == 2);
+}
+
+static uint32_t field(uint64_t value, uint8_t shift, uint8_t bits) {
+  return (value >> shift) & (((uint64_t)1 << bits) - 1);
+}
+
+static bool extract(const IrTiming& timing, const IrCandidate& state, IrCode& code) {
+  uint32_t address = field(state.value, timing.addressShift, timing.addressBits);
+  uint32_t command = field(state.value, timing.commandShift, timing.commandBits);
+  if (timing.flags & IR_TIMING_COMMAND_INVERTED) {
+    if ((command >> 8) != (~command & 0xFF)) {
+      return false;
+    }
+    command &= 0xFF;
+  }
+  if ((timing.flags & IR_TIMING_ADDRESS_INVERTED) && (address >> 8) == (~address & 0xFF)) {
+    address &= 0xFF;
+  }
+  code.protocol = timing.protocol;
+  code.bits = timing.bits;
+  code.carrierKHz = timing.carrierKHz;
+  code.flags = (timing.flags & IR_TIMING_REPEAT) ? IR_CODE_FLAG_REPEAT : 0;
+  code.address = address;
+  code.command = command;
+  return true;
+}
+
+bool irDecode(const uint16_t* durations, uint16_t count, IrCode& code, uint32_t candidates) {
+  IrCandidate states[TIMING_COUNT];
+  uint32_t active = candidates & (TIMING_COUNT == 32 ? 0xFFFFFFFFUL : (1UL << TIMING_COUNT) - 1);
+  for (uint8_t t = 0; t < TIMING_COUNT; t++) {
+    states[t].value = 0;
+    states[t].bit = 0;
+    states[t].markMatch = 0;
+    // Biphase frames start with the idle (space) half of their first bit
+    states[t].half = timings[t].encoding == IR_ENCODING_BIPHASE ? 0 : -1;
+  }
+
+  for (uint16_t edge = 0; edge < count && active != 0; edge++) {
+    bool mark = (edge & 1) == 0;
+    uint16_t duration = durations[edge];
+    if (mark) {
+      duration = duration > IR_MARK_EXCESS ? duration - IR_MARK_EXCESS : 0;
+    } else {
+      duration = duration < 0xFFFF - IR_MARK_EXCESS ? duration + IR_MARK_EXCESS : 0xFFFF;
+    }
+    for (uint32_t pending = active; pending != 0; pending &= pending - 1) {
+      uint8_t t = __builtin_ctz(pending);
+      if (!step(timings[t], states[t], edge, mark, duration)) {
+        active &= ~(1UL << t);
+      }
+    }
+  }
+
+  for (; active != 0; active &= active - 1) {
+    uint8_t t = __builtin_ctz(active);
+    if (finish(timings[t], states[t], count) && extract(timings[t], states[t], code)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+struct IrFrameWriter {
+  uint16_t* durations;
+  uint16_t capacity;
+  uint16_t count;
+  bool overflow;
+
+  // Appends a level, merging it into the previous duration if that has
+  // the same level; leading spaces are idle line and dropped
+  void add(bool mark, uint16_t us) {
+    bool lastMark = count > 0 && ((count - 1) & 1) == 0;
+    if (count > 0 && lastMark == mark) {
+      durations[count - 1] += us;
+    } else if (count == 0 && !mark) {
+      return;
+    } else if (count == capacity) {
+      overflow = true;
+    } else {
+      durations[count++] = us;
+    }
+  }
+};
+
+// The table entry a code is sent with: its repeat frame or its bit count
+static const IrTiming* findTiming(const IrCode& code) {
+  bool repeat = (code.flags & IR_CODE_FLAG_REPEAT) != 0;
+  for (uint8_t t = 0; t < TIMING_COUNT; t++) {
+    if (timings[t].protocol == code.protocol && ((timings[t].flags & IR_TIMING_REPEAT) != 0) == repeat &&
+        (repeat || code.bits == 0 || timings[t].bits == code.bits)) {
+      return &timings[t];
+    }
+  }
+  return nullptr;
+}
+
+uint32_t irFramePeriod(const IrCode& code) {
+  const IrTiming* timing = findTiming(code);
+  return timing != nullptr ? timing->period : 0;
+}
+
+bool irHasRepeatFrame(uint8_t protocol) {
+  for (uint8_t t = 0; t < TIMING_COUNT; t++) {
+    if (timings[t].protocol == protocol && (timings[t].flags & IR_TIMING_REPEAT)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint16_t irEncode(const IrCode& code, uint16_t* durations, uint16_t capacity) {
+  const IrTiming* timing = findTiming(code);
+  if (timing == nullptr) {
+    return 0;
+  }
+
+  uint32_t address = code.address;
+  uint32_t command = code.command;
+  if (timing->flags & IR_TIMING_COMMAND_INVERTED) {
+    command = (command & 0xFF) | ((~command & 0xFF) << 8);
+  }
+  if ((timing->flags & IR_TIMING_ADDRESS_INVERTED) && address <= 0xFF) {
+    address |= (~address & 0xFF) << 8;
+  }
+  uint64_t value = timing->fixedBits |
+                   ((uint64_t)field(address, 0, timing->addressBits) << timing->addressShift) |
+                   ((uint64_t)field(command, 0, timing->commandBits) << timing->commandShift);
+
+  IrFrameWriter out = {durations, capacity, 0, false};
+  if (timing->headerMark != 0) {
+    out.add(true, timing->headerMark);
+    out.add(false, timing->headerSpace);
+  }
+  for (uint8_t i = 0; i < timing->bits; i++) {
+    uint8_t shift = (timing->flags & IR_TIMING_MSB_FIRST) ? timing->bits - 1 - i : i;
+    bool one = (value >> shift) & 1;
+    if (timing->encoding == IR_ENCODING_BIPHASE) {
+      out.add(!one, timing->zeroMark);
+      out.add(one, timing->zeroMark);
+    } else {
+      out.add(true, one ? timing->oneMark : timing->zeroMark);
+      out.add(false, one ? timing->oneSpace : timing->zeroSpace);
+    }
+  }
+  if (timing->flags & IR_TIMING_STOP_MARK) {
+    out.add(true, timing->zeroMark);
+  }
+  if (out.overflow) {
+    return 0;
+  }
+  // Frames end on a mark
+  return (out.count & 1) == 0 && out.count > 0 ? out.count - 1 : out.count;
+}
\ No newline at end of file
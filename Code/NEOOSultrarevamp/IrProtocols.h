@@ -0,0 +1,72 @@
+#ifndef IR_PROTOCOLS_H
+#define IR_PROTOCOLS_H
+
+#include <Arduino.h>
+#include "IrCode.h"
+
+// Demodulating receivers stretch marks and shorten spaces by about this
+// much; measured durations are corrected before matching
+#define IR_MARK_EXCESS 50  // us
+
+enum IrEncoding : uint8_t {
+  IR_ENCODING_PULSE_DISTANCE,  // fixed mark, the space length carries the bit
+  IR_ENCODING_PULSE_WIDTH,     // the mark length carries the bit, fixed space
+  IR_ENCODING_BIPHASE          // Manchester at zeroMark us per half bit: 1 = space, mark
+};
+
+// IrTiming::flags
+#define IR_TIMING_MSB_FIRST 0x01
+#define IR_TIMING_STOP_MARK 0x02         // a mark follows the last bit
+#define IR_TIMING_REPEAT 0x04            // repeat frame of the protocol, no data
+#define IR_TIMING_ADDRESS_INVERTED 0x08  // 16-bit address field; high byte may be ~low (8-bit address)
+#define IR_TIMING_COMMAND_INVERTED 0x10  // 16-bit command field; high byte must be ~low
+
+// How one protocol looks on the wire. Frames are header (if any), bits,
+// stop mark (if any); the value is split into address and command by
+// bit position, after fixedBits (start/toggle bits) are masked out.
+struct IrTiming {
+  uint8_t protocol;  // IrProtocol
+  uint8_t encoding;  // IrEncoding
+  uint8_t bits;
+  uint8_t flags;
+  uint16_t headerMark;  // 0 = no header
+  uint16_t headerSpace;
+  uint16_t zeroMark;
+  uint16_t zeroSpace;
+  uint16_t oneMark;
+  uint16_t oneSpace;
+  uint8_t tolerance;   // percent
+  uint8_t carrierKHz;
+  uint8_t addressShift;
+  uint8_t addressBits;
+  uint8_t commandShift;
+  uint8_t commandBits;
+  uint32_t fixedBits;
+  uint32_t period;  // us from one frame start to the next while a key is held
+};
+
+#define IR_DECODE_ALL 0xFFFFFFFFUL
+
+const char* irProtocolName(uint8_t protocol);
+
+uint8_t irTimingCount();
+const IrTiming& irTiming(uint8_t index);
+
+// Matches a frame against every IrTiming whose bit is set in candidates
+// at once: one pass over the durations steps all candidates still in the
+// running, and the first one (in table order) that ends exactly with the
+// frame and passes its checks wins. On success fills protocol, bits,
+// carrierKHz, flags, address and command of code; the key is untouched.
+bool irDecode(const uint16_t* durations, uint16_t count, IrCode& code, uint32_t candidates = IR_DECODE_ALL);
+
+// The frame for a decoded code (IR_CODE_FLAG_REPEAT: its repeat frame),
+// without the trailing space. Returns the durations written, 0 if the
+// protocol is unknown or the frame doesn't fit.
+uint16_t irEncode(const IrCode& code, uint16_t* durations, uint16_t capacity);
+
+// Frame start to frame start while a key is held, 0 if unknown (RAW)
+uint32_t irFramePeriod(const IrCode& code);
+// Held keys send a short repeat frame rather than the whole frame again
+bool irHasRepeatFrame(uint8_t protocol);
+
+#endif
\ No newline at end of file
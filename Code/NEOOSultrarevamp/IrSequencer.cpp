@@ -0,0 +1,329 @@
+#include "IrSequencer.h"
+#include "IrLibrary.h"
+#include "IrProtocols.h"
+#include "Log.h"
+#include <LittleFS.h>
+
+IrSequencer irSequencer;
+
+// One DEVICE/BRAND/FUNCTION[*repeats][+gap ms] token
+static bool parseStep(const char* token, size_t length, IrMacroStep& step) {
+  char text[IR_KEY_DEVICE + IR_KEY_BRAND + IR_KEY_FUNCTION + 16];
+  if (length >= sizeof(text)) {
+    return false;
+  }
+  memcpy(text, token, length);
+  text[length] = '\0';
+
+  step.repeats = 0;
+  step.gapUs = IR_MACRO_DEFAULT_GAP;
+  step.carrierKHz = 0;
+  step.duty = 0;
+  char* gap = strchr(text, '+');
+  if (gap != nullptr) {
+    *gap = '\0';
+    step.gapUs = strtoul(gap + 1, nullptr, 10) * 1000UL;
+  }
+  char* repeats = strchr(text, '*');
+  if (repeats != nullptr) {
+    *repeats = '\0';
+    step.repeats = min<unsigned long>(strtoul(repeats + 1, nullptr, 10), IR_SEQUENCE_HOLD - 1);
+  }
+  char* brand = strchr(text, '/');
+  char* function = brand != nullptr ? strchr(brand + 1, '/') : nullptr;
+  if (function == nullptr) {
+    return false;
+  }
+  *brand++ = '\0';
+  *function++ = '\0';
+  irCodeKeySet(step.key, text, brand, function);
+  return true;
+}
+
+bool irMacroParse(const char* line, IrMacro& macro) {
+  const char* colon = strchr(line, ':');
+  if (colon == nullptr) {
+    return false;
+  }
+  while (*line == ' ' || *line == '\t') {
+    line++;
+  }
+  size_t nameLength = min<size_t>(colon - line, IR_MACRO_NAME);
+  while (nameLength > 0 && (line[nameLength - 1] == ' ' || line[nameLength - 1] == '\t')) {
+    nameLength--;
+  }
+  memcpy(macro.name, line, nameLength);
+  macro.name[nameLength] = '\0';
+
+  macro.stepCount = 0;
+  const char* cursor = colon + 1;
+  while (*cursor != '\0' && *cursor != '#') {
+    if (*cursor == ' ' || *cursor == '\t' || *cursor == '\r' || *cursor == '\n') {
+      cursor++;
+      continue;
+    }
+    size_t length = strcspn(cursor, " \t\r\n#");
+    if (macro.stepCount == IR_MACRO_MAX_STEPS || !parseStep(cursor, length, macro.steps[macro.stepCount])) {
+      return false;
+    }
+    macro.stepCount++;
+    cursor += length;
+  }
+  return macro.stepCount > 0;
+}
+
+int irMacroLoad(const char* path, uint8_t index, IrMacro* macro) {
+  File file = LittleFS.open(path, "r");
+  if (!file) {
+    return -1;
+  }
+  IrMacro scratch;
+  char line[IR_MACRO_LINE];
+  size_t length = 0;
+  int count = 0;
+  bool more = true;
+  while (more) {
+    uint8_t c;
+    more = file.read(&c, 1) == 1;
+    if (more && c != '\n') {
+      if (length < sizeof(line) - 1) {
+        line[length++] = c;
+      }
+      continue;
+    }
+    line[length] = '\0';
+    length = 0;
+    char* hash = strchr(line, '#');
+    if (hash != nullptr) {
+      *hash = '\0';
+    }
+    IrMacro& target = (macro != nullptr && count == index) ? *macro : scratch;
+    if (irMacroParse(line, target)) {
+      count++;
+    }
+  }
+  file.close();
+  return count;
+}
+
+IrSequencer::IrSequencer()
+  : step(0), stepFrames(0), stepReady(false), generating(false), slotsQueued(0), framesSent(0),
+    framesTotal(0), frameCount(0), frameAirtime(0), repeatCount(0), repeatAirtime(0), period(0),
+    carrier(IR_DEFAULT_CARRIER), duty(0) {
+  memset(&macro, 0, sizeof(macro));
+}
+
+bool IrSequencer::start(const IrMacro& next) {
+  stop();
+  if (!load(next)) {
+    return false;
+  }
+  LOG_INFO(LOG_MSG_IR_MACRO_START, macro.name, (unsigned)macro.stepCount);
+  pump();
+  return true;
+}
+
+bool IrSequencer::load(const IrMacro& next) {
+  if (next.stepCount == 0) {
+    return false;
+  }
+  macro = next;
+  step = 0;
+  stepFrames = 0;
+  stepReady = false;
+  generating = true;
+  framesSent = 0;
+  framesTotal = 0;
+  for (uint8_t i = 0; i < macro.stepCount; i++) {
+    if (macro.steps[i].repeats == IR_SEQUENCE_HOLD) {
+      framesTotal = 0;
+      break;
+    }
+    framesTotal += 1 + macro.steps[i].repeats;
+  }
+  return true;
+}
+
+void IrSequencer::stop() {
+  generating = false;
+  if (slotsQueued > 0) {
+    irTxQueue.cancel();
+  }
+}
+
+bool IrSequencer::isPlaying() const {
+  return generating || slotsQueued > 0;
+}
+
+void IrSequencer::pump() {
+  uint16_t* slot;
+  while (generating && (slot = irTxQueue.reserve()) != nullptr) {
+    IrSequenceSlot filled;
+    uint16_t count = fill(slot, IR_TX_MAX_DURATIONS, filled);
+    if (count == 0 ||
+        !irTxQueue.commit(count, filled.carrierHz, filled.gapUs, onSlotDone, this, filled.frames, filled.duty)) {
+      return;
+    }
+    slotsQueued++;
+  }
+}
+
+void IrSequencer::onSlotDone(uint32_t frames, IrTxEvent event, void* context) {
+  IrSequencer* sequencer = static_cast<IrSequencer*>(context);
+  sequencer->slotsQueued--;
+  if (event == IR_TX_DONE) {
+    sequencer->framesSent += frames;
+    sequencer->pump();
+  } else if (event == IR_TX_FAILED) {
+    // The rest would be refused the same way
+    sequencer->stop();
+  }
+}
+
+static uint32_t airtime(const uint16_t* durations, uint16_t count) {
+  uint32_t total = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    total += durations[i];
+  }
+  return total;
+}
+
+// Encodes the current step's code, and its repeat frame if the protocol
+// has one
+bool IrSequencer::loadStep() {
+  IrCode code;
+  if (irLibrary.find(macro.steps[step].key, &code) < 0) {
+    char function[IR_KEY_FUNCTION + 1];
+    irCodeKeyField(macro.steps[step].key.function, IR_KEY_FUNCTION, function);
+    LOG_WARN(LOG_MSG_IR_MACRO_MISSING, function);
+    return false;
+  }
+  if (code.protocol == IR_PROTOCOL_RAW) {
+    frameCount = irLibrary.readRaw(code, frame, IR_TX_MAX_DURATIONS);
+    // Frames end on a mark; the idle line after it is ours to time
+    if ((frameCount & 1) == 0 && frameCount > 0) {
+      frameCount--;
+    }
+  } else {
+    frameCount = irEncode(code, frame, IR_TX_MAX_DURATIONS);
+  }
+  if (frameCount == 0) {
+    LOG_WARN(LOG_MSG_IR_NO_ENCODER, code.protocol);
+    return false;
+  }
+  frameAirtime = airtime(frame, frameCount);
+  period = irFramePeriod(code);
+  const IrMacroStep& current = macro.steps[step];
+  carrier = (current.carrierKHz != 0 ? current.carrierKHz : irCodeCarrierKHz(code)) * 1000UL;
+  duty = current.duty != 0 ? current.duty : code.tunedDuty;
+
+  repeatCount = 0;
+  if (irHasRepeatFrame(code.protocol)) {
+    code.flags |= IR_CODE_FLAG_REPEAT;
+    repeatCount = irEncode(code, repeatFrame, IR_SEQUENCE_REPEAT_MAX);
+    repeatAirtime = airtime(repeatFrame, repeatCount);
+  }
+  return true;
+}
+
+// Moves past the frame just written and returns the idle line before
+// the next one: the rest of the protocol period within a step, the
+// step's gap after its last frame
+uint32_t IrSequencer::advance() {
+  const IrMacroStep& current = macro.steps[step];
+  stepFrames++;
+  if (current.repeats == IR_SEQUENCE_HOLD || stepFrames <= current.repeats) {
+    uint32_t sent = (stepFrames > 1 && repeatCount > 0) ? repeatAirtime : frameAirtime;
+    if (period == 0) {
+      return max<uint32_t>(current.gapUs, IR_SEQUENCE_MIN_GAP);
+    }
+    return max<uint32_t>(period > sent ? period - sent : 0, IR_SEQUENCE_MIN_GAP);
+  }
+  uint32_t gap = max<uint32_t>(current.gapUs, IR_SEQUENCE_MIN_GAP);
+  stepFrames = 0;
+  stepReady = false;
+  if (++step == macro.stepCount) {
+    generating = false;
+    return 0;
+  }
+  return gap;
+}
+
+// Idle line as space, 0 mark, space, ... in even pieces of at most
+// IR_TX_MAX_SPACE; all or nothing
+static bool appendSpace(uint16_t* durations, uint16_t capacity, uint16_t& count, uint32_t us) {
+  uint32_t pieces = (us + IR_TX_MAX_SPACE - 1) / IR_TX_MAX_SPACE;
+  if (count + 2 * pieces - 1 > capacity) {
+    return false;
+  }
+  for (uint32_t i = 0; i < pieces; i++) {
+    if (i > 0) {
+      durations[count++] = 0;
+    }
+    durations[count++] = us / pieces + (i < us % pieces ? 1 : 0);
+  }
+  return true;
+}
+
+uint16_t IrSequencer::fill(uint16_t* durations, uint16_t capacity, IrSequenceSlot& slot) {
+  uint16_t count = 0;
+  uint32_t span = 0;
+  slot.carrierHz = carrier;
+  slot.duty = duty;
+  slot.gapUs = 0;
+  slot.frames = 0;
+  while (generating) {
+    if (!stepReady) {
+      if (!loadStep()) {
+        // Skipped, as if it had been sent
+        stepFrames = macro.steps[step].repeats;
+        if (stepFrames == IR_SEQUENCE_HOLD) {
+          generating = false;
+        } else {
+          advance();
+        }
+        continue;
+      }
+      stepReady = true;
+    }
+    // A slot has one carrier and duty, and ends after about IR_SEQUENCE_SLOT_SPAN
+    if (count > 0 && (carrier != slot.carrierHz || duty != slot.duty || span >= IR_SEQUENCE_SLOT_SPAN)) {
+      break;
+    }
+    bool repeat = stepFrames > 0 && repeatCount > 0;
+    const uint16_t* source = repeat ? repeatFrame : frame;
+    uint16_t length = repeat ? repeatCount : frameCount;
+    if (count + length > capacity) {
+      break;
+    }
+    memcpy(durations + count, source, length * sizeof(uint16_t));
+    count += length;
+    span += repeat ? repeatAirtime : frameAirtime;
+    slot.carrierHz = carrier;
+    slot.duty = duty;
+    slot.frames++;
+
+    uint32_t idle = advance();
+    if (idle == 0) {
+      break;
+    }
+    if (!appendSpace(durations, capacity, count, idle)) {
+      slot.gapUs = idle;
+      break;
+    }
+    span += idle;
+  }
+  return count;
+}
+
+const char* IrSequencer::getName() const {
+  return macro.name;
+}
+
+uint32_t IrSequencer::getFramesSent() const {
+  return framesSent;
+}
+
+uint32_t IrSequencer::getFramesTotal() const {
+  return framesTotal;
+}
\ No newline at end of file
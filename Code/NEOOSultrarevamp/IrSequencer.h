@@ -0,0 +1,112 @@
+#ifndef IR_SEQUENCER_H
+#define IR_SEQUENCER_H
+
+#include <Arduino.h>
+#include "IrCode.h"
+#include "IrTxQueue.h"
+
+#define IR_MACRO_FILE "/irlib/macros.txt"
+#define IR_MACRO_MAX_STEPS 16
+#define IR_MACRO_NAME 15            // characters kept of a macro's name
+#define IR_MACRO_LINE 256           // longest line read from a macro file
+#define IR_MACRO_DEFAULT_GAP 100000UL  // us of idle line after a step without +ms
+#define IR_SEQUENCE_HOLD 0xFFFF     // IrMacroStep::repeats: until stop()
+#define IR_SEQUENCE_SLOT_SPAN 250000UL  // us of timeline packed into one transmit slot
+#define IR_SEQUENCE_REPEAT_MAX 8    // durations of a protocol repeat frame
+#define IR_SEQUENCE_MIN_GAP 20000   // us of idle line between frames, at least
+
+// One macro entry: a library code, sent once and then `repeats` more
+// times a protocol period apart (NEC and the like send their short
+// repeat frame). RAW codes have no period and repeat gapUs apart.
+struct IrMacroStep {
+  IrCodeKey key;
+  uint16_t repeats;
+  uint32_t gapUs;      // idle line after the step's last frame
+  uint8_t carrierKHz;  // 0 = the code's, as tuned by ADAPTIVE SEND
+  uint8_t duty;        // percent, 0 = the code's
+};
+
+static_assert(IR_MACRO_NAME >= IR_KEY_FUNCTION, "a code's function name works as a macro name");
+
+struct IrMacro {
+  char name[IR_MACRO_NAME + 1];
+  uint8_t stepCount;
+  IrMacroStep steps[IR_MACRO_MAX_STEPS];
+};
+
+// One macro per line, # comments:
+//   NAME: DEVICE/BRAND/FUNCTION[*repeats][+gap ms] ...
+// e.g. "TV OFF: TV/NEC/POWER*2+200 AMP/SONY/MUTE"
+bool irMacroParse(const char* line, IrMacro& macro);
+
+// Reads macro number index of a macro file into macro (if not null).
+// Returns how many macros the file holds, -1 if it can't be opened.
+int irMacroLoad(const char* path, uint8_t index, IrMacro* macro);
+
+// What fill() put in a slot besides the durations
+struct IrSequenceSlot {
+  uint32_t carrierHz;
+  uint8_t duty;     // percent, 0 = IR_TX_DUTY
+  uint32_t gapUs;   // idle line after the durations
+  uint16_t frames;
+};
+
+// Plays macros with exact timing. Frames and the idle line between them
+// are laid out as one edge timeline and packed into transmit slots, so
+// the RMT's microsecond clock times every gap and repeat period instead
+// of delay() or the scheduler. Only slot boundaries, one per
+// IR_SEQUENCE_SLOT_SPAN or so, add the queue's start latency.
+class IrSequencer {
+  public:
+    IrSequencer();
+
+    // Plays a macro from the top; false if it is empty
+    bool start(const IrMacro& macro);
+    // Sets a macro up for fill() alone, nothing is queued
+    bool load(const IrMacro& macro);
+    // Drops everything not on the air yet
+    void stop();
+    bool isPlaying() const;  // frames still to come or on the air
+
+    // Tops up the transmit queue; also runs from its completion callback
+    void pump();
+
+    // The next part of the timeline, without the queue: whole frames,
+    // each followed by the idle line before the next, up to capacity
+    // durations or IR_SEQUENCE_SLOT_SPAN. Idle line that doesn't fit is
+    // returned in slot.gapUs instead. Returns the durations written, 0
+    // once the macro is over.
+    uint16_t fill(uint16_t* durations, uint16_t capacity, IrSequenceSlot& slot);
+
+    const char* getName() const;
+    uint32_t getFramesSent() const;
+    uint32_t getFramesTotal() const;  // 0 while holding
+
+  private:
+    IrMacro macro;
+    uint8_t step;         // current step
+    uint16_t stepFrames;  // frames of it written so far
+    bool stepReady;       // frame and repeatFrame hold the current step
+    bool generating;
+    uint8_t slotsQueued;
+    uint32_t framesSent;
+    uint32_t framesTotal;
+
+    uint16_t frame[IR_TX_MAX_DURATIONS];
+    uint16_t frameCount;
+    uint32_t frameAirtime;
+    uint16_t repeatFrame[IR_SEQUENCE_REPEAT_MAX];
+    uint16_t repeatCount;  // 0 = repeats send the whole frame
+    uint32_t repeatAirtime;
+    uint32_t period;
+    uint32_t carrier;
+    uint8_t duty;
+
+    bool loadStep();
+    uint32_t advance();  // idle line after the frame just written, 0 at the end
+    static void onSlotDone(uint32_t frames, IrTxEvent event, void* context);
+};
+
+extern IrSequencer irSequencer;
+
+#endif
\ No newline at end of file
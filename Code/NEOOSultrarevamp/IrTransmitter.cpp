@@ -0,0 +1,26 @@
+#include "IrTransmitter.h"
+
+// IRremote 4.x; only this file may include the .hpp
+#include <IRremote.hpp>
+
+IrTransmitter irTransmitter;
+
+IrTransmitter::IrTransmitter() : started(false), framesSent(0) {
+}
+
+void IrTransmitter::begin(uint8_t pin) {
+  IrSender.begin(pin);
+  started = true;
+}
+
+void IrTransmitter::sendRaw(const uint16_t* durations, uint16_t count, uint32_t carrierHz) {
+  if (!started) {
+    begin();
+  }
+  IrSender.sendRaw(durations, count, carrierHz / 1000);
+  framesSent++;
+}
+
+uint32_t IrTransmitter::getFramesSent() const {
+  return framesSent;
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#ifndef IR_TRANSMITTER_H
+#define IR_TRANSMITTER_H
+
+#include <Arduino.h>
+
+// IR LED driver, as wired in infared_NEOV2.1
+#define IR_SEND_PIN 4
+#define IR_DEFAULT_CARRIER 38000  // Hz, NEC/Samsung and most consumer remotes
+
+// Sends raw mark/space timings on the IR LED. Used to replay frames from
+// IrCapture, including protocols nothing on the device can decode.
+class IrTransmitter {
+  public:
+    IrTransmitter();
+    void begin(uint8_t pin = IR_SEND_PIN);
+
+    // durations: mark, space, mark, ... in us. Blocks for the length of the frame.
+    void sendRaw(const uint16_t* durations, uint16_t count, uint32_t carrierHz = IR_DEFAULT_CARRIER);
+
+    uint32_t getFramesSent() const;
+
+  private:
+    bool started;
+    uint32_t framesSent;
+};
+
+extern IrTransmitter irTransmitter;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,211 @@
+#include "IrTxQueue.h"
+#include "Log.h"
+
+#if !defined(ARDUINO)
+#include "HostHal.h"
+#endif
+
+IrTxQueue irTxQueue;
+
+IrTxQueue::IrTxQueue()
+  : head(0), used(0), sending(false), startedAt(0), readyAt(0), scheduler(nullptr), taskId(-1), pin(IR_SEND_PIN),
+    framesSent(0), framesFailed(0), maxStartDelay(0) {
+}
+
+bool IrTxQueue::begin(Scheduler* taskScheduler, uint8_t ledPin) {
+  scheduler = taskScheduler;
+  pin = ledPin;
+#if defined(ARDUINO_ARCH_ESP32)
+  // 1 MHz RMT clock: symbol durations are in us
+  if (!rmtInit(pin, RMT_TX_MODE, RMT_MEM_NUM_BLOCKS_1, 1000000)) {
+    return false;
+  }
+#elif defined(ARDUINO)
+  irTransmitter.begin(pin);
+#else
+  pinMode(pin, OUTPUT);
+#endif
+  taskId = scheduler->addTask("irtx", task, this, IR_TX_TASK_PRIORITY, false);
+  return taskId >= 0;
+}
+
+uint16_t* IrTxQueue::reserve() {
+  if (used == IR_TX_QUEUE_SLOTS) {
+    return nullptr;
+  }
+  return slots[(head + used) % IR_TX_QUEUE_SLOTS].durations;
+}
+
+bool IrTxQueue::commit(uint16_t count, uint32_t carrierHz, uint32_t gapUs,
+                       IrTxCallback callback, void* context, uint32_t tag, uint8_t duty) {
+  if (used == IR_TX_QUEUE_SLOTS || count == 0 || count > IR_TX_MAX_DURATIONS || taskId < 0) {
+    return false;
+  }
+  Slot& slot = slots[(head + used) % IR_TX_QUEUE_SLOTS];
+  slot.count = count;
+  slot.carrierHz = carrierHz;
+  slot.duty = duty != 0 ? duty : IR_TX_DUTY;
+  slot.gapUs = gapUs;
+  slot.airtime = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    slot.airtime += slot.durations[i];
+  }
+  slot.queuedAt = micros();
+  slot.callback = callback;
+  slot.context = context;
+  slot.tag = tag;
+  used++;
+  if (!sending) {
+    scheduler->start(taskId);
+  }
+  return true;
+}
+
+bool IrTxQueue::enqueue(const uint16_t* durations, uint16_t count, uint32_t carrierHz, uint32_t gapUs,
+                        IrTxCallback callback, void* context, uint32_t tag, uint8_t duty) {
+  uint16_t* buffer = reserve();
+  if (buffer == nullptr || count > IR_TX_MAX_DURATIONS) {
+    return false;
+  }
+  memcpy(buffer, durations, count * sizeof(uint16_t));
+  return commit(count, carrierHz, gapUs, callback, context, tag, duty);
+}
+
+void IrTxQueue::cancel() {
+  uint8_t keep = sending ? 1 : 0;
+  while (used > keep) {
+    used--;
+    Slot& slot = slots[(head + used) % IR_TX_QUEUE_SLOTS];
+    if (slot.callback != nullptr) {
+      slot.callback(slot.tag, IR_TX_CANCELLED, slot.context);
+    }
+  }
+}
+
+uint8_t IrTxQueue::getQueued() const {
+  return used;
+}
+
+bool IrTxQueue::isIdle() const {
+  return used == 0;
+}
+
+uint32_t IrTxQueue::getFramesSent() const {
+  return framesSent;
+}
+
+uint32_t IrTxQueue::getFramesFailed() const {
+  return framesFailed;
+}
+
+uint32_t IrTxQueue::getMaxStartDelay() const {
+  return maxStartDelay;
+}
+
+uint32_t IrTxQueue::task(void* context) {
+  return static_cast<IrTxQueue*>(context)->poll();
+}
+
+bool IrTxQueue::start(Slot& slot) {
+#if defined(ARDUINO_ARCH_ESP32)
+  for (uint16_t i = 0; i < slot.count; i += 2) {
+    // Read the pair before its symbol overwrites it; a final mark gets a
+    // zero-length space, which ends the transmission
+    uint16_t mark = min<uint16_t>(slot.durations[i], 0x7FFF);
+    uint16_t space = i + 1 < slot.count ? slot.durations[i + 1] : 0;
+    rmt_data_t& symbol = slot.symbols[i / 2];
+    if (mark == 0) {
+      // More idle line, spread over both halves (see IR_TX_MAX_SPACE)
+      symbol.duration0 = space - space / 2;
+      symbol.level0 = 0;
+      symbol.duration1 = space / 2;
+    } else {
+      symbol.duration0 = mark;
+      symbol.level0 = 1;
+      symbol.duration1 = min<uint16_t>(space, 0x7FFF);
+    }
+    symbol.level1 = 0;
+  }
+  // The duty goes in as a fraction; a carrier it refuses would leave the
+  // frame unmodulated, which no receiver demodulates
+  if (!rmtSetCarrier(pin, true, true, slot.carrierHz, slot.duty / 100.0f)) {
+    return false;
+  }
+  return rmtWriteAsync(pin, slot.symbols, (slot.count + 1) / 2);
+#elif defined(ARDUINO)
+  // No transmit peripheral here: the frame goes out blocking
+  irTransmitter.sendRaw(slot.durations, slot.count, slot.carrierHz);
+  return true;
+#else
+  return hostHal.irStart(slot.durations, slot.count, slot.carrierHz, slot.duty / 100.0f);
+#endif
+}
+
+bool IrTxQueue::hardwareBusy() const {
+#if defined(ARDUINO_ARCH_ESP32)
+  return !rmtTransmitCompleted(pin);
+#elif defined(ARDUINO)
+  return false;
+#else
+  return hostHal.irBusy();
+#endif
+}
+
+uint32_t IrTxQueue::poll() {
+  if (sending) {
+    Slot& done = slots[head];
+    int32_t left = (int32_t)(startedAt + done.airtime - micros());
+    if (left > IR_TX_SPIN) {
+      return max<uint32_t>((left - IR_TX_SPIN) / 1000, IR_TX_POLL_INTERVAL);
+    }
+    if (left > 0) {
+      delayMicroseconds(left);
+    }
+    // The peripheral's clock and micros() drift apart a little
+    uint32_t waitFrom = micros();
+    while (hardwareBusy()) {
+      if (micros() - waitFrom > IR_TX_SPIN) {
+        return IR_TX_POLL_INTERVAL;
+      }
+    }
+    sending = false;
+    framesSent++;
+    // The gap runs from when the frame should have ended, so a late
+    // wake-up shows as start delay rather than stretching the gap
+    readyAt = startedAt + done.airtime + done.gapUs;
+    head = (head + 1) % IR_TX_QUEUE_SLOTS;
+    used--;
+    if (done.callback != nullptr) {
+      done.callback(done.tag, IR_TX_DONE, done.context);
+    }
+  }
+  if (used == 0) {
+    return TASK_STOP;
+  }
+
+  int32_t wait = (int32_t)(readyAt - micros());
+  if (wait > IR_TX_SPIN) {
+    return max<uint32_t>((wait - IR_TX_SPIN) / 1000, IR_TX_POLL_INTERVAL);
+  }
+  if (wait > 0) {
+    delayMicroseconds(wait);
+  }
+  uint32_t now = micros();
+  Slot& next = slots[head];
+  uint32_t due = (int32_t)(readyAt - next.queuedAt) > 0 ? readyAt : next.queuedAt;
+  maxStartDelay = max<uint32_t>(maxStartDelay, now - due);
+  if (!start(next)) {
+    LOG_WARN(LOG_MSG_IR_TX_REFUSED, (unsigned)next.carrierHz, (unsigned)next.duty);
+    framesFailed++;
+    head = (head + 1) % IR_TX_QUEUE_SLOTS;
+    used--;
+    if (next.callback != nullptr) {
+      next.callback(next.tag, IR_TX_FAILED, next.context);
+    }
+    return 0;
+  }
+  sending = true;
+  startedAt = now;
+  // Sleep through the airtime instead of polling the peripheral
+  return next.airtime > IR_TX_SPIN ? (next.airtime - IR_TX_SPIN) / 1000 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+#ifndef IR_TX_QUEUE_H
+#define IR_TX_QUEUE_H
+
+#include <Arduino.h>
+#include "IrTransmitter.h"
+#include "Scheduler.h"
+
+#if defined(ARDUINO_ARCH_ESP32)
+#include "esp32-hal-rmt.h"
+#endif
+
+#define IR_TX_QUEUE_SLOTS 4       // frames waiting or on the air
+#define IR_TX_MAX_DURATIONS 512   // per frame, as captured
+#define IR_TX_TASK_PRIORITY 4     // above input, so frames start on time
+#define IR_TX_POLL_INTERVAL 1     // ms between completion checks past a frame's airtime
+#define IR_TX_SPIN 2000           // us before a frame ends that the task waits out itself
+#define IR_TX_DUTY 33             // carrier duty cycle, percent (rmtSetCarrier() takes 0..1)
+
+// Spaces go out as one RMT symbol half, so at most IR_TX_MAX_SPACE us.
+// Longer idle line is written as space, 0 mark, space, ...: a 0 mark
+// joins the spaces either side of it.
+#define IR_TX_MAX_SPACE 32767
+
+enum IrTxEvent : uint8_t {
+  IR_TX_DONE,       // the frame has left the LED
+  IR_TX_CANCELLED,  // dropped by cancel() before it started
+  IR_TX_FAILED      // the peripheral refused the frame; nothing was sent
+};
+
+// Called from the queue's scheduler task, never from an interrupt, so it
+// may touch UI state and enqueue more frames
+typedef void (*IrTxCallback)(uint32_t tag, IrTxEvent event, void* context);
+
+// Non-blocking IR transmit queue. Frames are encoded into a slot ahead
+// of time; the queue's task starts each one on the RMT peripheral, which
+// generates carrier and modulation on its own, and comes back only when
+// the frame's airtime is nearly over to report it and start the next.
+// The last IR_TX_SPIN us are waited out in the task, so back-to-back
+// frames follow each other closer than the scheduler's 1 ms tick. The
+// UI keeps running while a long list of codes goes out.
+class IrTxQueue {
+  public:
+    IrTxQueue();
+
+    // Claims the LED pin and registers the queue's task
+    bool begin(Scheduler* scheduler, uint8_t pin = IR_SEND_PIN);
+
+    // Two-step enqueue without a copy: fill the returned buffer (room for
+    // IR_TX_MAX_DURATIONS, mark first), then commit() how many were used.
+    // reserve() returns nullptr while every slot is taken.
+    uint16_t* reserve();
+    // gapUs of idle line is kept after the frame before the next starts;
+    // duty is the carrier's in percent, 0 = IR_TX_DUTY
+    bool commit(uint16_t count, uint32_t carrierHz = IR_DEFAULT_CARRIER, uint32_t gapUs = 0,
+                IrTxCallback callback = nullptr, void* context = nullptr, uint32_t tag = 0, uint8_t duty = 0);
+
+    // reserve() + copy + commit()
+    bool enqueue(const uint16_t* durations, uint16_t count, uint32_t carrierHz = IR_DEFAULT_CARRIER,
+                 uint32_t gapUs = 0, IrTxCallback callback = nullptr, void* context = nullptr, uint32_t tag = 0,
+                 uint8_t duty = 0);
+
+    // Drop every frame not yet on the air; the one sending finishes
+    void cancel();
+
+    uint8_t getQueued() const;  // waiting or on the air
+    bool isIdle() const;
+    uint32_t getFramesSent() const;
+    uint32_t getFramesFailed() const;
+    uint32_t getMaxStartDelay() const;  // us between a frame being due and starting
+
+  private:
+    struct Slot {
+      union {
+        uint16_t durations[IR_TX_MAX_DURATIONS];
+#if defined(ARDUINO_ARCH_ESP32)
+        // A mark/space pair takes the same 4 bytes as one RMT symbol, so
+        // the frame is converted in place when it starts
+        rmt_data_t symbols[IR_TX_MAX_DURATIONS / 2];
+#endif
+      };
+      uint16_t count;
+      uint32_t carrierHz;
+      uint8_t duty;       // percent
+      uint32_t gapUs;
+      uint32_t airtime;   // us
+      uint32_t queuedAt;  // micros() at commit
+      IrTxCallback callback;
+      void* context;
+      uint32_t tag;
+    };
+
+    Slot slots[IR_TX_QUEUE_SLOTS];
+    uint8_t head;      // oldest slot: on the air or next to start
+    uint8_t used;
+    bool sending;      // slots[head] is on the air
+    uint32_t startedAt;  // micros() when slots[head] went on the air
+    uint32_t readyAt;    // micros() when the previous frame's gap is over
+    Scheduler* scheduler;
+    int taskId;
+    uint8_t pin;
+    uint32_t framesSent;
+    uint32_t framesFailed;
+    uint32_t maxStartDelay;
+
+    static uint32_t task(void* context);
+    uint32_t poll();  // returns ms until it needs to run again
+    bool start(Slot& slot);  // false if the frame could not be started
+    bool hardwareBusy() const;
+};
+
+extern IrTxQueue irTxQueue;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "ListView.h"
+
+ListView::ListView(const ListStyle* style)
+  : style(style), count(0), cursor(0), first(0), lag(0) {
+}
+
+void ListView::setCount(uint32_t rowCount) {
+  count = rowCount;
+  if (cursor >= count) {
+    jumpTo(count > 0 ? count - 1 : 0);
+  }
+}
+
+void ListView::setCursor(uint32_t index) {
+  cursor = index;
+  scrollTo(index);
+}
+
+void ListView::jumpTo(uint32_t index) {
+  cursor = index;
+  first = 0;
+  scrollTo(index);
+  lag = 0;
+}
+
+uint32_t ListView::getCursor() const {
+  return cursor;
+}
+
+bool ListView::isScrolling() const {
+  return lag != 0;
+}
+
+// Moves first so that index is visible, keeping the view where it is on
+// screen; the lag left over is animated away by draw()
+void ListView::scrollTo(uint32_t index) {
+  uint32_t target = first;
+  if (index < first) {
+    target = index;
+  } else if (index >= first + style->rows) {
+    target = index - style->rows + 1;
+  }
+  if (target == first) {
+    return;
+  }
+
+  // Past a screenful there is nothing to scroll through that stays in
+  // view, so the view jumps
+  uint32_t distance = target > first ? target - first : first - target;
+  int32_t behind = 0;
+  if (distance <= style->rows) {
+    behind = lag + ((int32_t)first - (int32_t)target) * style->rowHeight;
+  }
+  first = target;
+  lag = constrain(behind, -(int32_t)style->rows * style->rowHeight, (int32_t)style->rows * style->rowHeight);
+}
+
+void ListView::draw(DisplayManager* display, ListRowProvider provider, void* context) {
+  if (count == 0) {
+    return;
+  }
+  // Close half the remaining distance per frame, at least a pixel
+  if (lag > 0) {
+    lag -= (lag + 1) / 2;
+  } else if (lag < 0) {
+    lag -= (lag - 1) / 2;
+  }
+
+  // Mid-scroll rows land on a new row phase every frame; only the
+  // settled list is worth caching
+  bool settled = lag == 0;
+  char text[LIST_TEXT_SIZE];
+  int lastBaseline = style->top + (style->rows - 1) * style->rowHeight;
+  int spare = (abs(lag) + style->rowHeight - 1) / style->rowHeight;
+  uint32_t from = first > (uint32_t)spare ? first - spare : 0;
+  uint32_t to = min(count, first + (uint32_t)(style->rows + spare));
+
+  for (uint32_t i = from; i < to; i++) {
+    // Rows part-way out of the view are left out rather than clipped
+    int y = style->top + ((int32_t)(i - first)) * style->rowHeight - lag;
+    if (y < style->top || y > lastBaseline) {
+      continue;
+    }
+    if (!provider(i, text, sizeof(text), context)) {
+      break;
+    }
+    if (i == cursor) {
+      display->setFont(style->markerFont);
+      if (settled) {
+        display->drawLabel(style->markerX, y, ">");
+      } else {
+        display->drawStr(style->markerX, y, ">");
+      }
+    }
+    display->setFont(style->font);
+    if (style->labels && settled) {
+      display->drawLabel(style->textX, y, text);
+    } else {
+      display->drawStr(style->textX, y, text);
+    }
+  }
+
+  drawScrollbar(display, (int32_t)first * style->rowHeight + lag);
+}
+
+// Thumb only, as in drawMenu() of the first NEO firmware, sized to the
+// share of the list in view
+void ListView::drawScrollbar(DisplayManager* display, int32_t position) {
+  if (count <= style->rows) {
+    return;
+  }
+  int trackTop = style->top - style->rowHeight + 1;
+  int trackHeight = style->rows * style->rowHeight - 3;
+  int thumb = max(LIST_MIN_THUMB, (int)((uint32_t)trackHeight * style->rows / count));
+  int32_t range = (int32_t)(count - style->rows) * style->rowHeight;
+  position = constrain(position, (int32_t)0, range);
+  int y = trackTop + (int)((int64_t)(trackHeight - thumb) * position / range);
+  display->drawBox(LIST_SCROLLBAR_X, y, LIST_SCROLLBAR_WIDTH, thumb);
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#ifndef LIST_VIEW_H
+#define LIST_VIEW_H
+
+#include <Arduino.h>
+#include "Display.h"
+
+#define LIST_TEXT_SIZE 48       // longest row text, terminator included
+#define LIST_SCROLLBAR_X 122    // clear of the window frame's right corners
+#define LIST_SCROLLBAR_WIDTH 2
+#define LIST_MIN_THUMB 3        // px, so the thumb stays visible in long lists
+
+// Writes the text of row index into text; false if there is no such row
+typedef bool (*ListRowProvider)(uint32_t index, char* text, size_t size, void* context);
+
+// How a list sits on screen. Rows are drawn with their baseline at
+// top, top + rowHeight and so on, the selected one with a marker.
+struct ListStyle {
+  const uint8_t* font;
+  const uint8_t* markerFont;  // for the ">" before the selected row
+  int8_t markerX;
+  int8_t textX;
+  int8_t top;                 // baseline of the first visible row
+  uint8_t rows;               // visible rows
+  uint8_t rowHeight;
+  bool labels;                // rows are fixed strings, drawn with drawLabel() once settled
+};
+
+// Scrolling list over rows it never holds: each frame asks the provider
+// for the visible rows only, so memory does not grow with the list and
+// moving the cursor anywhere is O(1). A move of a screenful or less
+// scrolls there smoothly over a few frames; further jumps are immediate.
+class ListView {
+  public:
+    ListView(const ListStyle* style);
+
+    void setCount(uint32_t count);
+    // Moves the cursor, scrolling just enough to keep it visible
+    void setCursor(uint32_t index);
+    // Same without animating, for a list shown afresh
+    void jumpTo(uint32_t index);
+    uint32_t getCursor() const;
+
+    // Whether the next draw() still moves the rows
+    bool isScrolling() const;
+    // Steps the scroll animation, then draws the visible rows, read from
+    // the provider, and the scrollbar
+    void draw(DisplayManager* display, ListRowProvider provider, void* context = nullptr);
+
+  private:
+    const ListStyle* style;
+    uint32_t count;
+    uint32_t cursor;
+    uint32_t first;  // first visible row once the scroll settles
+    int16_t lag;     // px from first to where the view is, animated to 0
+
+    void scrollTo(uint32_t index);
+    void drawScrollbar(DisplayManager* display, int32_t position);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "Log.h"
+
+Logger logger;
+
+Logger::Logger() : head(0), tail(0), dropped(0), unreported(0) {
+}
+
+void Logger::encodeInt(uint8_t* frame, uint8_t& used, uint32_t value) {
+  if (used + 5 > LOG_FRAME_HEADER + LOG_MAX_PAYLOAD) {
+    return;
+  }
+  frame[used++] = LOG_ARG_INT;
+  frame[used++] = value;
+  frame[used++] = value >> 8;
+  frame[used++] = value >> 16;
+  frame[used++] = value >> 24;
+}
+
+void Logger::encodeArg(uint8_t* frame, uint8_t& used, const char* value) {
+  if (value == nullptr) {
+    value = "";
+  }
+  uint8_t length = strnlen(value, LOG_MAX_STRING);
+  if (used + 2 + length > LOG_FRAME_HEADER + LOG_MAX_PAYLOAD) {
+    return;
+  }
+  frame[used++] = LOG_ARG_STRING;
+  frame[used++] = length;
+  memcpy(frame + used, value, length);
+  used += length;
+}
+
+void Logger::commit(uint8_t level, LogMessage id, uint8_t* frame, uint8_t length) {
+  if (unreported > 0) {
+    // Report the loss only once the message after it fits as well
+    uint8_t notice[LOG_FRAME_OVERHEAD + 5];
+    uint8_t used = LOG_FRAME_HEADER;
+    encodeInt(notice, used, unreported);
+    uint32_t needed = used + 1 + LOG_FRAME_OVERHEAD + length;
+    if (room() < needed ||
+        !append(LOG_LEVEL_WARN, LOG_MSG_DROPPED, notice, used - LOG_FRAME_HEADER)) {
+      unreported++;
+      dropped++;
+      return;
+    }
+    unreported = 0;
+  }
+  if (!append(level, id, frame, length)) {
+    unreported++;
+    dropped++;
+  }
+}
+
+uint32_t Logger::room() const {
+  return LOG_RING_SIZE - (head - __atomic_load_n(&tail, __ATOMIC_ACQUIRE));
+}
+
+// Producer side: only the logging task moves head. The payload is
+// already in place after the header.
+bool Logger::append(uint8_t level, LogMessage id, uint8_t* frame, uint8_t length) {
+  uint32_t size = LOG_FRAME_OVERHEAD + length;
+  if (size > room()) {
+    return false;
+  }
+  uint32_t start = head;
+
+  uint32_t now = millis();
+  frame[0] = LOG_SYNC;
+  frame[1] = length;
+  frame[2] = id;
+  frame[3] = id >> 8;
+  frame[4] = level;
+  frame[5] = now;
+  frame[6] = now >> 8;
+  frame[7] = now >> 16;
+  frame[8] = now >> 24;
+  uint8_t sum = 0;
+  for (uint32_t i = 1; i < size - 1; i++) {
+    sum += frame[i];
+  }
+  frame[size - 1] = sum;
+
+  for (uint32_t i = 0; i < size; i++) {
+    ring[(start + i) & (LOG_RING_SIZE - 1)] = frame[i];
+  }
+  __atomic_store_n(&head, start + size, __ATOMIC_RELEASE);
+  return true;
+}
+
+// Consumer side: only the draining task moves tail. Bytes are handed
+// over in at most two contiguous runs, capped to the port's free space.
+void Logger::drain(Print& out) {
+  uint32_t end = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+  while (tail != end) {
+    int room = out.availableForWrite();
+    if (room <= 0) {
+      return;
+    }
+    uint32_t offset = tail & (LOG_RING_SIZE - 1);
+    uint32_t length = min<uint32_t>(end - tail, LOG_RING_SIZE - offset);
+    length = min<uint32_t>(length, room);
+    size_t sent = out.write(ring + offset, length);
+    if (sent == 0) {
+      return;
+    }
+    __atomic_store_n(&tail, tail + sent, __ATOMIC_RELEASE);
+  }
+}
+
+uint32_t Logger::getDropped() const {
+  return dropped;
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+#include "LogCatalog.h"
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+// Messages above this level are compiled out, arguments included
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_RING_SIZE 1024  // bytes, power of two
+#define LOG_MAX_PAYLOAD 64  // argument bytes per message
+#define LOG_MAX_STRING 24   // %s arguments are cut to this length
+
+// Frame, as stored in the ring and sent on the wire (little-endian):
+//   u8 LOG_SYNC, u8 payload length, u16 message id, u8 level,
+//   u32 millis, payload, u8 checksum (sum of the bytes after LOG_SYNC)
+// Payload arguments: LOG_ARG_INT + i32, or LOG_ARG_STRING + u8 length + bytes
+#define LOG_SYNC 0xA5
+#define LOG_FRAME_HEADER 9
+#define LOG_FRAME_OVERHEAD (LOG_FRAME_HEADER + 1)
+#define LOG_ARG_INT 'i'
+#define LOG_ARG_STRING 's'
+
+// Deferred binary logger. write() encodes a message into a lock-free
+// single-producer/single-consumer byte ring and returns; drain() moves
+// frames to the port only as fast as its TX buffer accepts them, so a
+// slow UART never stalls the caller. Messages that don't fit are counted
+// and reported with LOG_MSG_DROPPED once there is room again.
+class Logger {
+  public:
+    Logger();
+
+    template <typename... Args>
+    void write(uint8_t level, LogMessage id, Args... args) {
+      // Arguments are encoded straight into the frame, after its header
+      uint8_t frame[LOG_FRAME_OVERHEAD + LOG_MAX_PAYLOAD];
+      uint8_t used = LOG_FRAME_HEADER;
+      encode(frame, used, args...);
+      commit(level, id, frame, used - LOG_FRAME_HEADER);
+    }
+
+    // Call from idle time; never blocks on the port
+    void drain(Print& out);
+
+    uint32_t getDropped() const;  // total messages lost to a full ring
+
+  private:
+    uint8_t ring[LOG_RING_SIZE];
+    uint32_t head;  // bytes written, published with release
+    uint32_t tail;  // bytes drained
+    uint32_t dropped;
+    uint32_t unreported;  // dropped since the last LOG_MSG_DROPPED
+
+    uint32_t room() const;  // free ring bytes, as seen by the producer
+    void commit(uint8_t level, LogMessage id, uint8_t* frame, uint8_t length);
+    bool append(uint8_t level, LogMessage id, uint8_t* frame, uint8_t length);
+
+    static void encode(uint8_t* frame, uint8_t& used) {}
+
+    template <typename T, typename... Rest>
+    static void encode(uint8_t* frame, uint8_t& used, T value, Rest... rest) {
+      encodeArg(frame, used, value);
+      encode(frame, used, rest...);
+    }
+
+    static void encodeInt(uint8_t* frame, uint8_t& used, uint32_t value);
+    static void encodeArg(uint8_t* frame, uint8_t& used, int value) { encodeInt(frame, used, value); }
+    static void encodeArg(uint8_t* frame, uint8_t& used, unsigned int value) { encodeInt(frame, used, value); }
+    static void encodeArg(uint8_t* frame, uint8_t& used, long value) { encodeInt(frame, used, value); }
+    static void encodeArg(uint8_t* frame, uint8_t& used, unsigned long value) { encodeInt(frame, used, value); }
+    static void encodeArg(uint8_t* frame, uint8_t& used, const char* value);
+};
+
+extern Logger logger;
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(id, ...) logger.write(LOG_LEVEL_ERROR, id, ##__VA_ARGS__)
+#else
+#define LOG_ERROR(id, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(id, ...) logger.write(LOG_LEVEL_WARN, id, ##__VA_ARGS__)
+#else
+#define LOG_WARN(id, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(id, ...) logger.write(LOG_LEVEL_INFO, id, ##__VA_ARGS__)
+#else
+#define LOG_INFO(id, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(id, ...) logger.write(LOG_LEVEL_DEBUG, id, ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(id, ...) do {} while (0)
+#endif
+
+#endif
\ No newline at end of file
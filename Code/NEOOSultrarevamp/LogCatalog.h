@@ -0,0 +1,74 @@
+#ifndef LOG_CATALOG_H
+#define LOG_CATALOG_H
+
+// Every log message, X(id, format). The firmware only sends the index of
+// the entry and its arguments; the format strings are compiled into the
+// host decoder alone. Append new entries at the end so captures from
+// older builds still decode. Formats take %d %i %u %x %X %c and %s.
+#define LOG_CATALOG(X) \
+  X(LOG_MSG_DROPPED, "(%u messages dropped)") \
+  X(LOG_MSG_ENTERED_FUNCTION_SCREEN, "Transition: Entered function screen") \
+  X(LOG_MSG_EXITED_FUNCTION_SCREEN, "Transition: Exited function screen") \
+  X(LOG_MSG_DRAW_FUNCTION_SCREEN, "Drawing function screen") \
+  X(LOG_MSG_DRAW_SUBMENU, "Drawing submenu screen") \
+  X(LOG_MSG_SELECT_PRESSED, "SELECT button pressed") \
+  X(LOG_MSG_EXECUTE_FROM_FUNCTION_SCREEN, "Executing function from function screen") \
+  X(LOG_MSG_SELECTED_OPTION, "Selected option: %s") \
+  X(LOG_MSG_BACK_OPTION, "BACK option selected, returning to parent menu") \
+  X(LOG_MSG_ENTER_SUBMENU, "Entering submenu") \
+  X(LOG_MSG_ENTER_FUNCTION_SCREEN, "Entering function screen") \
+  X(LOG_MSG_BACK_PRESSED, "BACK button pressed") \
+  X(LOG_MSG_EXIT_TRANSMISSION, "Exiting transmission mode") \
+  X(LOG_MSG_EXIT_FUNCTION_SCREEN, "Exiting function screen to submenu") \
+  X(LOG_MSG_EXIT_SUBMENU, "Exiting submenu to parent menu") \
+  X(LOG_MSG_B_PRESSED, "B button pressed") \
+  X(LOG_MSG_EXECUTE_FUNCTION, "Executing function: %s") \
+  X(LOG_MSG_WIFI_SCAN, "WIFI SCAN") \
+  X(LOG_MSG_WIFI_CONNECT, "WIFI CONNECT") \
+  X(LOG_MSG_BLE_CONNECT, "BLE CONNECT") \
+  X(LOG_MSG_INFRARED_RECEIVE, "INFRARED RECEIVE") \
+  X(LOG_MSG_IR_DIRECT_SEND, "Executing Infrared Direct Send") \
+  X(LOG_MSG_IR_REPEAT_SEND, "Executing Infrared Repeat Send") \
+  X(LOG_MSG_IR_BURST_SEND, "Executing Infrared Burst Send") \
+  X(LOG_MSG_IR_ADAPTIVE_SEND, "Executing Infrared Adaptive Send") \
+  X(LOG_MSG_GPIO_READ, "GPIO READ") \
+  X(LOG_MSG_GPIO_WRITE, "GPIO WRITE") \
+  X(LOG_MSG_GPIO_TOGGLE, "GPIO TOGGLE") \
+  X(LOG_MSG_GPIO_MONITOR, "GPIO MONITOR") \
+  X(LOG_MSG_IR_CAPTURED, "Captured IR frame: %u durations") \
+  X(LOG_MSG_IR_REPLAY, "Replaying IR frame: %u durations") \
+  X(LOG_MSG_IR_LIBRARY, "INFRARED LIBRARY") \
+  X(LOG_MSG_IR_LIBRARY_UNAVAILABLE, "IR library unavailable") \
+  X(LOG_MSG_IR_SAVED, "Saved IR code %s (id %u)") \
+  X(LOG_MSG_IR_SEND_CODE, "Sending library code %u") \
+  X(LOG_MSG_IR_NO_ENCODER, "No encoder for IR protocol %u") \
+  X(LOG_MSG_IR_DECODED, "Decoded %s: %u bits, address 0x%X command 0x%X") \
+  X(LOG_MSG_IR_DECODED_REPEAT, "Decoded %s repeat") \
+  X(LOG_MSG_IR_TX_QUEUE_FULL, "IR transmit queue full") \
+  X(LOG_MSG_IR_BOMBARD, "Bombardment: %u codes") \
+  X(LOG_MSG_IR_MACRO_START, "Playing macro %s: %u steps") \
+  X(LOG_MSG_IR_MACRO_MISSING, "Macro code %s not in library") \
+  X(LOG_MSG_IR_ADAPTIVE_TRIAL, "Adaptive %u kHz %u%% x%u: %u/%u received, %u us off") \
+  X(LOG_MSG_IR_ADAPTIVE_RESULT, "Adaptive %s: %u kHz %u%% x%u, %u/%u received") \
+  X(LOG_MSG_IR_LEARN, "INFRARED LEARN REMOTE") \
+  X(LOG_MSG_IR_LEARN_SAVED, "Saved %u learned codes, %u bytes of timings") \
+  X(LOG_MSG_GPIO_LOGIC, "GPIO LOGIC ANALYZER") \
+  X(LOG_MSG_LOGIC_CAPTURED, "Logic capture: %u samples at %u Hz, %u late") \
+  X(LOG_MSG_LOGIC_EXPORTED, "Logic capture written to %s: %u bytes") \
+  X(LOG_MSG_LOGIC_EXPORT_FAILED, "Cannot write logic capture to %s") \
+  X(LOG_MSG_GPIO_PATTERN, "GPIO PATTERN GEN") \
+  X(LOG_MSG_PATTERN_START, "Playing pattern %s: %u steps, %u loops") \
+  X(LOG_MSG_PATTERN_END, "Pattern %s over: %u steps, %u late") \
+  X(LOG_MSG_GPIO_SCOPE, "GPIO SCOPE") \
+  X(LOG_MSG_SCOPE_FAILED, "Cannot run the ADC on GPIO%u") \
+  X(LOG_MSG_GPIO_WRITE_PIN, "GPIO%u set %s") \
+  X(LOG_MSG_IR_TX_REFUSED, "IR transmitter refused a frame: %u Hz at %u%% duty")
+
+#define LOG_CATALOG_ID(id, format) id,
+
+enum LogMessage : uint16_t {
+  LOG_CATALOG(LOG_CATALOG_ID)
+  LOG_MESSAGE_COUNT
+};
+
+#endif
\ No newline at end of file
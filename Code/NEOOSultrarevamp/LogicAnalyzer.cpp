@@ -0,0 +1,352 @@
+#include "LogicAnalyzer.h"
+#include "Log.h"
+#include <LittleFS.h>
+
+#if !defined(ARDUINO)
+#include "HostHal.h"
+#endif
+
+// The sample clock: CPU cycles on the ESP32, micros() elsewhere, and
+// virtual ns on the host, where waiting for a sample moves time on. The
+// sampling loop runs from IRAM with a direct read of the input register.
+// Pending GPIO interrupts stay latched while bursts have them masked, so
+// a button pressed during one is handled late, not lost.
+#if defined(ARDUINO_ARCH_ESP32)
+#include "soc/gpio_reg.h"
+static portMUX_TYPE logicMux = portMUX_INITIALIZER_UNLOCKED;
+#define LOGIC_RAM_ATTR IRAM_ATTR
+#define LOGIC_MASK() portENTER_CRITICAL(&logicMux)
+#define LOGIC_UNMASK() portEXIT_CRITICAL(&logicMux)
+#define LOGIC_READ_PORT() ((uint16_t)REG_READ(GPIO_IN_REG))
+#else
+#define LOGIC_RAM_ATTR
+#define LOGIC_MASK()
+#define LOGIC_UNMASK()
+#define LOGIC_READ_PORT() readPins()
+#endif
+
+LogicAnalyzer logicAnalyzer;
+
+static const uint8_t logicPins[LOGIC_CHANNELS] = LOGIC_PINS;
+static const uint32_t logicRates[] = {2000000, 1000000, 500000, 250000, 100000};
+static const char* const conditionNames[LOGIC_CONDITION_COUNT] = {
+  "any", "low", "high", "rise", "fall", "edge"
+};
+
+#define LOGIC_RATE_COUNT (sizeof(logicRates) / sizeof(logicRates[0]))
+
+#if defined(ARDUINO_ARCH_ESP32)
+static uint32_t ticksPerSecond() {
+  return getCpuFrequencyMhz() * 1000000UL;
+}
+
+static inline uint32_t LOGIC_RAM_ATTR ticks() {
+  return ESP.getCycleCount();
+}
+
+static inline uint32_t LOGIC_RAM_ATTR waitUntil(uint32_t due) {
+  uint32_t now;
+  do {
+    now = ticks();
+  } while ((int32_t)(now - due) < 0);
+  return now;
+}
+#elif defined(ARDUINO)
+static uint32_t ticksPerSecond() {
+  return 1000000UL;
+}
+
+static inline uint32_t ticks() {
+  return micros();
+}
+
+static inline uint32_t waitUntil(uint32_t due) {
+  uint32_t now;
+  do {
+    now = ticks();
+  } while ((int32_t)(now - due) < 0);
+  return now;
+}
+#else
+static uint32_t ticksPerSecond() {
+  return 1000000000UL;
+}
+
+static uint32_t ticks() {
+  return (uint32_t)(hostHal.now() * 1000);
+}
+
+// Virtual time has whole us, so above 1 MHz samples come in pairs
+static uint32_t waitUntil(uint32_t due) {
+  int32_t ahead = (int32_t)(due - ticks());
+  if (ahead > 0) {
+    hostHal.advance((ahead + 999) / 1000);
+  }
+  return ticks();
+}
+#endif
+
+#if !defined(ARDUINO_ARCH_ESP32)
+static uint16_t readPins() {
+  uint16_t port = 0;
+  for (uint8_t c = 0; c < LOGIC_CHANNELS; c++) {
+    if (digitalRead(logicPins[c]) == HIGH) {
+      port |= 1U << logicPins[c];
+    }
+  }
+  return port;
+}
+#endif
+
+LogicAnalyzer::LogicAnalyzer()
+  : start(0), state(LOGIC_IDLE), captured(false), forced(false), levelMask(0), levelValue(0), edgeMask(0),
+    rateHz(logicRates[0]), period(1), pretrigger(0), triggerIndex(0), bursts(0), late(0) {
+  memset(samples, 0, sizeof(samples));
+  settings.rate = 0;
+  settings.pretrigger = 50;
+  for (uint8_t c = 0; c < LOGIC_CHANNELS; c++) {
+    settings.conditions[c] = LOGIC_ANY;
+  }
+}
+
+LogicSettings& LogicAnalyzer::getSettings() {
+  return settings;
+}
+
+uint8_t LogicAnalyzer::getRateCount() {
+  return LOGIC_RATE_COUNT;
+}
+
+uint32_t LogicAnalyzer::getRate(uint8_t index) {
+  return logicRates[index < LOGIC_RATE_COUNT ? index : 0];
+}
+
+const char* LogicAnalyzer::getConditionName(LogicCondition condition) {
+  return condition < LOGIC_CONDITION_COUNT ? conditionNames[condition] : "?";
+}
+
+uint8_t LogicAnalyzer::getPin(uint8_t channel) {
+  return logicPins[channel];
+}
+
+// Every condition becomes register bits: a level to match, and for
+// edges the level after it plus a bit that has to have changed
+void LogicAnalyzer::arm() {
+  levelMask = 0;
+  levelValue = 0;
+  edgeMask = 0;
+  for (uint8_t c = 0; c < LOGIC_CHANNELS; c++) {
+    uint16_t bit = 1U << logicPins[c];
+    switch (settings.conditions[c]) {
+      case LOGIC_RISE:
+        edgeMask |= bit;
+        // fall through
+      case LOGIC_HIGH:
+        levelMask |= bit;
+        levelValue |= bit;
+        break;
+      case LOGIC_FALL:
+        edgeMask |= bit;
+        // fall through
+      case LOGIC_LOW:
+        levelMask |= bit;
+        break;
+      case LOGIC_EDGE:
+        edgeMask |= bit;
+        break;
+      default:
+        break;
+    }
+  }
+  rateHz = getRate(settings.rate);
+  period = max<uint32_t>(ticksPerSecond() / rateHz, 1);
+  pretrigger = (uint32_t)LOGIC_DEPTH * min<uint8_t>(settings.pretrigger, 90) / 100;
+  bursts = 0;
+  late = 0;
+  forced = false;
+  captured = false;  // the ring is about to be overwritten
+  state = LOGIC_ARMED;
+}
+
+void LogicAnalyzer::force() {
+  forced = true;
+}
+
+void LogicAnalyzer::cancel() {
+  state = LOGIC_IDLE;
+}
+
+bool LogicAnalyzer::step() {
+  if (state != LOGIC_ARMED) {
+    return false;
+  }
+  bursts++;
+  if (forced) {
+    levelMask = 0;
+    edgeMask = 0;
+  }
+  uint32_t search = (uint64_t)rateHz * LOGIC_BURST_US / 1000000UL;
+  if (!burst(pretrigger + search)) {
+    return false;
+  }
+  captured = true;
+  state = LOGIC_DONE;
+  LOG_INFO(LOG_MSG_LOGIC_CAPTURED, (unsigned)LOGIC_DEPTH, (unsigned)rateHz, (unsigned)late);
+  return true;
+}
+
+// The sampling loop. Until the trigger fires it gives up after limit
+// samples; after that it runs on to the end of the capture. Returns
+// true once the capture is complete.
+bool LOGIC_RAM_ATTR LogicAnalyzer::burst(uint32_t limit) {
+  uint32_t taken = 0;
+  uint32_t remaining = 0;  // samples still to take after the trigger
+  uint32_t missed = 0;
+  bool masked = rateHz >= LOGIC_MASKED_RATE;
+  if (masked) {
+    LOGIC_MASK();
+  }
+  uint16_t previous = LOGIC_READ_PORT();
+  uint32_t due = ticks() + period;
+  for (;;) {
+    uint32_t now = waitUntil(due);
+    uint16_t port = LOGIC_READ_PORT();
+    if (now - due >= period) {
+      missed++;
+    }
+    due += period;
+    samples[taken & (LOGIC_DEPTH - 1)] = port;
+    taken++;
+
+    if (remaining > 0) {
+      if (--remaining == 0) {
+        break;
+      }
+    } else if (taken > pretrigger && (port & levelMask) == levelValue &&
+               (edgeMask == 0 || ((port ^ previous) & edgeMask) != 0)) {
+      triggerIndex = taken - 1;
+      remaining = LOGIC_DEPTH - pretrigger - 1;
+      if (remaining == 0) {
+        break;
+      }
+    } else if (taken >= limit) {
+      if (masked) {
+        LOGIC_UNMASK();
+      }
+      return false;
+    }
+    previous = port;
+  }
+  if (masked) {
+    LOGIC_UNMASK();
+  }
+  start = (triggerIndex - pretrigger) & (LOGIC_DEPTH - 1);
+  triggerIndex = pretrigger;
+  late = missed;
+  return true;
+}
+
+LogicState LogicAnalyzer::getState() const {
+  return state;
+}
+
+bool LogicAnalyzer::hasCapture() const {
+  return captured;
+}
+
+uint32_t LogicAnalyzer::getCaptureRate() const {
+  return rateHz;
+}
+
+uint32_t LogicAnalyzer::getTriggerIndex() const {
+  return triggerIndex;
+}
+
+uint32_t LogicAnalyzer::getBursts() const {
+  return bursts;
+}
+
+uint32_t LogicAnalyzer::getLateSamples() const {
+  return late;
+}
+
+uint8_t LogicAnalyzer::toChannels(uint16_t port) const {
+  uint8_t levels = 0;
+  for (uint8_t c = 0; c < LOGIC_CHANNELS; c++) {
+    if (port & (1U << logicPins[c])) {
+      levels |= 1U << c;
+    }
+  }
+  return levels;
+}
+
+uint8_t LogicAnalyzer::getLevels(uint32_t index) const {
+  return toChannels(samples[(start + index) & (LOGIC_DEPTH - 1)]);
+}
+
+void LogicAnalyzer::summarize(uint32_t first, uint32_t count, uint8_t& high, uint8_t& low) const {
+  uint16_t any = 0;
+  uint16_t all = 0xFFFF;
+  for (uint32_t i = first; i < first + count && i < LOGIC_DEPTH; i++) {
+    uint16_t port = samples[(start + i) & (LOGIC_DEPTH - 1)];
+    any |= port;
+    all &= port;
+  }
+  high = toChannels(any);
+  low = toChannels(~all);
+}
+
+// Only changes are written, so a quiet bus exports in a few lines. Time 0
+// is the first sample; the trigger's time is in a comment.
+size_t LogicAnalyzer::exportVcd(Print& out) const {
+  if (!captured) {
+    return 0;
+  }
+  uint32_t periodNs = 1000000000UL / rateHz;
+  size_t written = out.printf("$timescale 1 ns $end\n$scope module gpio $end\n");
+  for (uint8_t c = 0; c < LOGIC_CHANNELS; c++) {
+    written += out.printf("$var wire 1 %c GPIO%u $end\n", '!' + c, logicPins[c]);
+  }
+  written += out.printf("$upscope $end\n$enddefinitions $end\n");
+  written += out.printf("$comment trigger at %lu $end\n", (unsigned long)(triggerIndex * periodNs));
+
+  uint8_t previous = getLevels(0);
+  written += out.printf("#0\n$dumpvars\n");
+  for (uint8_t c = 0; c < LOGIC_CHANNELS; c++) {
+    written += out.printf("%u%c\n", (previous >> c) & 1, '!' + c);
+  }
+  written += out.printf("$end\n");
+  for (uint32_t i = 1; i < LOGIC_DEPTH; i++) {
+    uint8_t levels = getLevels(i);
+    uint8_t changed = levels ^ previous;
+    if (changed == 0) {
+      continue;
+    }
+    written += out.printf("#%lu\n", (unsigned long)(i * periodNs));
+    for (uint8_t c = 0; c < LOGIC_CHANNELS; c++) {
+      if (changed & (1U << c)) {
+        written += out.printf("%u%c\n", (levels >> c) & 1, '!' + c);
+      }
+    }
+    previous = levels;
+  }
+  written += out.printf("#%lu\n", (unsigned long)(LOGIC_DEPTH * periodNs));
+  return written;
+}
+
+bool LogicAnalyzer::save(const char* path) const {
+  File file = LittleFS.open(path, "w");
+  if (!file) {
+    LOG_WARN(LOG_MSG_LOGIC_EXPORT_FAILED, path);
+    return false;
+  }
+  size_t written = exportVcd(file);
+  file.close();
+  // Nothing written: no capture yet, or the filesystem is full
+  if (written == 0) {
+    LOG_WARN(LOG_MSG_LOGIC_EXPORT_FAILED, path);
+    return false;
+  }
+  LOG_INFO(LOG_MSG_LOGIC_EXPORTED, path, (unsigned)written);
+  return true;
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#ifndef LOGIC_ANALYZER_H
+#define LOGIC_ANALYZER_H
+
+#include <Arduino.h>
+
+// GPIO pins sampled, in channel order; the pins GPIO > MONITOR shows.
+// All below 16, so one sample is the low half of the input register.
+#define LOGIC_CHANNELS 5
+#define LOGIC_PINS {6, 1, 9, 7, 8}
+
+#define LOGIC_DEPTH 8192            // samples per capture, power of two
+#define LOGIC_BURST_US 20000        // trigger search per step, on top of the capture
+#define LOGIC_MASKED_RATE 1000000   // Hz; from here on bursts run with interrupts masked
+#define LOGIC_REARM_INTERVAL 5      // ms between bursts while armed
+#define LOGIC_EXPORT_FILE "/capture.vcd"
+#define LOGIC_DUMP_COMMAND 'L'      // Serial byte that requests the capture as VCD
+
+// What a channel must do for the trigger to fire
+enum LogicCondition : uint8_t {
+  LOGIC_ANY,
+  LOGIC_LOW,
+  LOGIC_HIGH,
+  LOGIC_RISE,
+  LOGIC_FALL,
+  LOGIC_EDGE,  // either edge
+  LOGIC_CONDITION_COUNT
+};
+
+enum LogicState : uint8_t {
+  LOGIC_IDLE,   // settings shown
+  LOGIC_ARMED,  // sampling, waiting for the trigger
+  LOGIC_DONE    // capture on view
+};
+
+struct LogicSettings {
+  uint8_t rate;        // index into the sample rates
+  uint8_t pretrigger;  // percent of the capture before the trigger
+  LogicCondition conditions[LOGIC_CHANNELS];
+};
+
+// Logic analyzer on the GPIO pins. A burst samples the whole input
+// register at once in a loop paced by the CPU cycle counter, up to
+// 2 MHz, into a RAM ring. The trigger is a pattern (levels that must
+// hold) plus, optionally, channels of which at least one has to change
+// on that sample, so edge, pattern and edge-within-pattern triggers are
+// one test per sample. The ring keeps the samples before the trigger;
+// once it fires, the rest of the capture is taken in the same burst.
+//
+// Bursts are blocking and start over with an empty ring, so the samples
+// before the trigger are always contiguous. Between bursts the scheduler
+// runs the rest of the firmware.
+class LogicAnalyzer {
+  public:
+    LogicAnalyzer();
+
+    LogicSettings& getSettings();  // edited while idle, used from arm()
+    static uint8_t getRateCount();
+    static uint32_t getRate(uint8_t index);  // Hz
+    static const char* getConditionName(LogicCondition condition);
+    static uint8_t getPin(uint8_t channel);
+
+    void arm();
+    void force();   // fires the trigger as soon as the pre-trigger samples are in
+    void cancel();  // back to the settings; the last capture stays readable
+    // One burst while armed; true when it completed a capture
+    bool step();
+
+    LogicState getState() const;
+    bool hasCapture() const;
+    uint32_t getCaptureRate() const;   // Hz
+    uint32_t getTriggerIndex() const;  // sample the trigger fired on
+    uint32_t getBursts() const;        // of the current or last arming
+    uint32_t getLateSamples() const;   // taken a period or more late
+
+    // Channel bits of sample index, bit n = channel n
+    uint8_t getLevels(uint32_t index) const;
+    // Channels high somewhere and low somewhere in count samples from first
+    void summarize(uint32_t first, uint32_t count, uint8_t& high, uint8_t& low) const;
+
+    // The capture as a value change dump, as PulseView and GTKWave read it
+    size_t exportVcd(Print& out) const;
+    bool save(const char* path = LOGIC_EXPORT_FILE) const;
+
+  private:
+    uint16_t samples[LOGIC_DEPTH];  // input register snapshots
+    uint32_t start;                 // ring position of the capture's first sample
+    LogicSettings settings;
+    LogicState state;
+    bool captured;
+    volatile bool forced;
+
+    // The settings compiled to input register bits by arm()
+    uint16_t levelMask;
+    uint16_t levelValue;
+    uint16_t edgeMask;
+    uint32_t rateHz;
+    uint32_t period;      // sample clock ticks per sample
+    uint32_t pretrigger;  // samples
+    uint32_t triggerIndex;
+    uint32_t bursts;
+    uint32_t late;
+
+    bool burst(uint32_t limit);
+    uint8_t toChannels(uint16_t port) const;
+};
+
+extern LogicAnalyzer logicAnalyzer;
+
+#endif
\ No newline at end of file
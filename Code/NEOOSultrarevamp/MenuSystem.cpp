@@ -1,747 +1,1595 @@
-#include "MenuSystem.h"
-
-// Constructor - initialize new variables
-MenuSystem::MenuSystem()
-  : currentMenu(0), mainMenuIndex(0), subMenuIndex(0), 
-    transmissionSubMenuIndex(0), functionScreen(false), 
-    isTransmissionSubMenu(false), display(nullptr), buttons(nullptr) {
-  // Constructor
-}
-
-void MenuSystem::init(DisplayManager* displayManager, ButtonHandler* buttonHandler) {
-  display = displayManager;
-  buttons = buttonHandler;
-}
-
-// Update the update method to handle the new transmission submenu
-void MenuSystem::update() {
-  static bool lastFunctionScreen = false;
-  
-  // Log state transitions for debugging
-  if (functionScreen != lastFunctionScreen) {
-    if (functionScreen) {
-      Serial.println("Transition: Entered function screen");
-    } else {
-      Serial.println("Transition: Exited function screen");
-    }
-    lastFunctionScreen = functionScreen;
-  }
-
-  // Redraw the current menu
-  if (currentMenu == 0) {
-    drawMainMenu();
-  } else if (isTransmissionSubMenu) {
-    drawTransmissionSubMenu();
-  } else if (functionScreen) {
-    Serial.println("Drawing function screen");
-    drawFunctionScreen();
-  } else {
-    Serial.println("Drawing submenu screen");
-    drawSubMenu();
-  }
-}
-
-// New method to draw transmission submenu
-void MenuSystem::drawTransmissionSubMenu() {
-  display->clearBuffer();
-  
-  // Draw frame using RFrame for rounded corners
-  display->drawRFrame(0, 0, 128, 64, 4);
-  display->drawRFrame(0, 0, 128, 12, 4);
-  
-  // Draw context-specific title
-  display->setFont(u8g2_font_4x6_tr);
-  display->drawStr(5, 9, ":// INFRARED TRANSMISSION");
-  display->drawStr(110, 8, "- X");
-  
-  // Draw submenu items in vertical list
-  int startY = 24;
-  for (int i = 0; i < TRANSMISSION_SUB_MENU_COUNT; i++) {
-    int yPos = startY + (i * 10);
-    
-    if (i == transmissionSubMenuIndex) {
-      // Draw selected item with cursor
-      display->setFont(u8g2_font_4x6_tf);
-      display->drawStr(4, yPos, ">");
-      
-      display->setFont(u8g2_font_6x10_tf);
-      display->drawStr(12, yPos, transmissionSubMenuOptions[i]);
-    } else {
-      // Draw unselected item
-      display->setFont(u8g2_font_6x10_tf);
-      display->drawStr(12, yPos, transmissionSubMenuOptions[i]);
-    }
-  }
-  
-  display->sendBuffer();
-}
-
-// Modify existing button handlers to support the new submenu
-void MenuSystem::handleSelectButton() {
-  Serial.println("SELECT button pressed");
-  
-  if (currentMenu == 0) {
-    // Enter submenu from main menu
-    Serial.println("Entering submenu from main menu");
-    currentMenu = 1;
-    subMenuIndex = 0;
-    functionScreen = false;
-  } else if (isTransmissionSubMenu) {
-    // Handle transmission submenu selection
-    if (transmissionSubMenuOptions[transmissionSubMenuIndex] == "BACK") {
-      // Exit transmission submenu
-      isTransmissionSubMenu = false;
-      currentMenu = 1;
-    } else {
-      // Execute specific transmission method
-      Serial.print("Selected transmission option: ");
-      Serial.println(transmissionSubMenuOptions[transmissionSubMenuIndex]);
-      
-      // Execute corresponding transmission method
-      switch(transmissionSubMenuIndex) {
-        case 0: 
-          infraredDirectSend();
-          break;
-        case 1:
-          infraredRepeatSend();
-          break;
-        case 2:
-          infraredBurstSend();
-          break;
-        case 3:
-          infraredAdaptiveSend();
-          break;
-      }
-    }
-  } else if (functionScreen) {
-    // Execute function when in function screen
-    Serial.println("Executing function from function screen");
-    executeFunctionAction();
-  } else {
-    // Existing submenu selection logic
-    const char** currentSubMenuOptions;
-    
-    switch (mainMenuIndex) {
-      case 0: currentSubMenuOptions = wifiSubMenuOptions; break;
-      case 1: currentSubMenuOptions = bleSubMenuOptions; break;
-      case 2: currentSubMenuOptions = infraredSubMenuOptions; break;
-      case 3: currentSubMenuOptions = neokinSubMenuOptions; break;
-      case 4: currentSubMenuOptions = gpioSubMenuOptions; break;
-      case 5: currentSubMenuOptions = settingsSubMenuOptions; break;
-      default: currentSubMenuOptions = wifiSubMenuOptions;
-    }
-    
-    Serial.print("Selected submenu option: ");
-    Serial.println(currentSubMenuOptions[subMenuIndex]);
-    
-    // Check if "BACK" option is selected
-    if (strcmp(currentSubMenuOptions[subMenuIndex], "BACK") == 0) {
-      Serial.println("BACK option selected, returning to main menu");
-      currentMenu = 0; // Return to main menu
-    } else {
-      // Enter function screen
-      Serial.println("Entering function screen");
-      functionScreen = true;
-    }
-  }
-}
-
-void MenuSystem::handleBackButton() {
-  Serial.println("BACK button pressed");
-  
-  if (isTransmissionSubMenu) {
-    Serial.println("Exiting transmission submenu");
-    isTransmissionSubMenu = false;
-    currentMenu = 1;
-  } else if (functionScreen) {
-    Serial.println("Exiting function screen to submenu");
-    functionScreen = false;
-  } else if (currentMenu == 1) {
-    Serial.println("Exiting submenu to main menu");
-    currentMenu = 0;
-  }
-}
-
-void MenuSystem::handleBButton() {
-  Serial.println("B button pressed");
-  
-  if (isTransmissionSubMenu) {
-    Serial.println("B button: Exiting transmission submenu");
-    isTransmissionSubMenu = false;
-    currentMenu = 1;
-  } else if (functionScreen) {
-    Serial.println("B button: Exiting function screen to submenu");
-    functionScreen = false;
-  } else if (currentMenu == 1) {
-    Serial.println("B button: Exiting submenu to main menu");
-    currentMenu = 0;
-  }
-  
-  // Hack: force a direct update to ensure the display refreshes
-  if (currentMenu == 0) {
-    drawMainMenu();
-  } else if (functionScreen == false && currentMenu == 1) {
-    drawSubMenu();
-  }
-}
-
-// Update other navigation methods to support transmission submenu
-void MenuSystem::handleLeftButton() {
-  if (currentMenu == 0) {
-    // Main menu navigation
-    mainMenuIndex = (mainMenuIndex + MAIN_MENU_COUNT - 1) % MAIN_MENU_COUNT;
-  } else if (isTransmissionSubMenu) {
-    // Transmission submenu navigation
-    transmissionSubMenuIndex = (transmissionSubMenuIndex + TRANSMISSION_SUB_MENU_COUNT - 1) % TRANSMISSION_SUB_MENU_COUNT;
-  } else if (!functionScreen) {
-    // Regular submenu navigation
-    subMenuIndex = (subMenuIndex + SUB_MENU_COUNT - 1) % SUB_MENU_COUNT;
-  }
-}
-
-void MenuSystem::handleRightButton() {
-  if (currentMenu == 0) {
-    // Main menu navigation
-    mainMenuIndex = (mainMenuIndex + 1) % MAIN_MENU_COUNT;
-  } else if (isTransmissionSubMenu) {
-    // Transmission submenu navigation
-    transmissionSubMenuIndex = (transmissionSubMenuIndex + 1) % TRANSMISSION_SUB_MENU_COUNT;
-  } else if (!functionScreen) {
-    // Regular submenu navigation
-    subMenuIndex = (subMenuIndex + 1) % SUB_MENU_COUNT;
-  }
-}
-
-void MenuSystem::handleUpButton() {
-  if (currentMenu == 0) {
-    mainMenuIndex = (mainMenuIndex + MAIN_MENU_COUNT - 1) % MAIN_MENU_COUNT;
-  } else if (isTransmissionSubMenu) {
-    transmissionSubMenuIndex = (transmissionSubMenuIndex > 0) 
-      ? transmissionSubMenuIndex - 1 
-      : TRANSMISSION_SUB_MENU_COUNT - 1;
-  } else if (!functionScreen) {
-    subMenuIndex = (subMenuIndex > 0) ? subMenuIndex - 1 : SUB_MENU_COUNT - 1;
-  }
-}
-
-void MenuSystem::handleDownButton() {
-  if (currentMenu == 0) {
-    mainMenuIndex = (mainMenuIndex + 1) % MAIN_MENU_COUNT;
-  } else if (isTransmissionSubMenu) {
-    transmissionSubMenuIndex = (transmissionSubMenuIndex < TRANSMISSION_SUB_MENU_COUNT - 1) 
-      ? transmissionSubMenuIndex + 1 
-      : 0;
-  } else if (!functionScreen) {
-    subMenuIndex = (subMenuIndex < SUB_MENU_COUNT - 1) ? subMenuIndex + 1 : 0;
-  }
-}
-
-// Complete the existing methods from the original implementation
-
-void MenuSystem::drawMainMenu() {
-  display->clearBuffer();
-  
-  // Draw frame using RFrame for rounded corners
-  display->drawRFrame(0, 0, 128, 64, 4);
-  display->drawRFrame(0, 0, 128, 12, 4);
-  
-  // Draw title
-  display->setFont(u8g2_font_4x6_tr);
-  display->drawStr(4, 9, "NEOos V.1.0");
-  display->drawStr(110, 8, "- X");
-  
-  // Draw navigation indicators
-  display->drawStr(119, 55, ">");
-  display->drawStr(5, 55, "<");
-  
-  // Draw selected menu item
-  display->setFont(u8g2_font_profont17_tr);
-  int textWidth = display->getStrWidth(mainMenuOptions[mainMenuIndex]);
-  display->drawStr(64 - (textWidth / 2), 58, mainMenuOptions[mainMenuIndex]);
-  
-  // Draw menu icon centered
-  const char* icon = menuIcons[mainMenuIndex];
-  int iconWidth = display->getStrWidth(icon);
-  int iconX = (128 - iconWidth) / 2; // Center the icon
-  display->drawStr(iconX, 35, icon);
-  
-  display->sendBuffer();
-}
-
-void MenuSystem::drawSubMenu() {
-  display->clearBuffer();
-  
-  // Draw frame using RFrame for rounded corners
-  display->drawRFrame(0, 0, 128, 64, 4);
-  display->drawRFrame(0, 0, 128, 12, 4);
-  
-  // Get current submenu options
-  const char** currentSubMenuOptions;
-  
-  switch (mainMenuIndex) {
-    case 0: currentSubMenuOptions = wifiSubMenuOptions; break;
-    case 1: currentSubMenuOptions = bleSubMenuOptions; break;
-    case 2: currentSubMenuOptions = infraredSubMenuOptions; break;
-    case 3: currentSubMenuOptions = neokinSubMenuOptions; break;
-    case 4: currentSubMenuOptions = gpioSubMenuOptions; break;   // New GPIO menu
-    case 5: currentSubMenuOptions = settingsSubMenuOptions; break;
-    default: currentSubMenuOptions = wifiSubMenuOptions;
-  }
-  
-  // Draw context-specific title
-  display->setFont(u8g2_font_4x6_tr);
-  char contextTitle[20];
-  snprintf(contextTitle, sizeof(contextTitle), ":// %s", currentSubMenuOptions[subMenuIndex]);
-  display->drawStr(5, 9, contextTitle);
-  
-  display->drawStr(110, 8, "- X");
-  
-  // Draw submenu items in vertical list
-  int startY = 24;
-  for (int i = 0; i < SUB_MENU_COUNT; i++) {
-    int yPos = startY + (i * 10);
-    
-    if (i == subMenuIndex) {
-      // Draw selected item with cursor
-      display->setFont(u8g2_font_4x6_tf);
-      display->drawStr(4, yPos, ">");
-      
-      display->setFont(u8g2_font_6x10_tf);
-      display->drawStr(12, yPos, currentSubMenuOptions[i]);
-    } else {
-      // Draw unselected item
-      display->setFont(u8g2_font_6x10_tf);
-      display->drawStr(12, yPos, currentSubMenuOptions[i]);
-    }
-  }
-  
-  display->sendBuffer();
-}
-
-void MenuSystem::drawFunctionScreen() {
-  display->clearBuffer();
-  
-  // Draw frames
-  display->drawRFrame(0, 0, 128, 64, 4);
-  display->drawRFrame(0, 0, 128, 10, 3);
-  
-  // Get current submenu options and main menu context
-  const char** currentSubMenuOptions;
-  const char* mainMenuName = mainMenuOptions[mainMenuIndex];
-  
-  switch (mainMenuIndex) {
-    case 0: currentSubMenuOptions = wifiSubMenuOptions; break;
-    case 1: currentSubMenuOptions = bleSubMenuOptions; break;
-    case 2: currentSubMenuOptions = infraredSubMenuOptions; break;
-    case 3: currentSubMenuOptions = neokinSubMenuOptions; break;
-    case 4: currentSubMenuOptions = gpioSubMenuOptions; break;   // New GPIO menu
-    case 5: currentSubMenuOptions = settingsSubMenuOptions; break;
-    default: currentSubMenuOptions = wifiSubMenuOptions;
-  }
-  
-  const char* functionName = currentSubMenuOptions[subMenuIndex];
-  
-  // Draw header elements with actual function name
-  display->setFont(u8g2_font_4x6_tr);
-  display->drawStr(109, 7, "- X");
-  
-  // Show main menu context in the title
-  char titleName[30];
-  snprintf(titleName, sizeof(titleName), "%s:%s", mainMenuName, functionName);
-  display->drawStr(8, 8, titleName);
-  
-  
-  // Draw status indicator with context-specific info
-  display->setFont(u8g2_font_6x12_tr);
-  if (mainMenuIndex == 0) {
-    display->drawStr(111, 23, "-}");
-  } else if (mainMenuIndex == 1) {
-    display->drawStr(111, 23, "{}");
-  } else if (mainMenuIndex == 2) {
-    display->drawStr(111, 23, "} ~");
-  } else if (mainMenuIndex == 3) {
-    display->drawStr(111, 23, "^.^");
-  } else if (mainMenuIndex == 4) {
-    display->drawStr(111, 23, "<>");  // New GPIO status display
-  } else {
-    display->drawStr(111, 23, "#");
-  }
-  
-  display->sendBuffer();
-}
-
-void MenuSystem::executeFunctionAction() {
-  // Process specific submenu action
-  Serial.print("Executing function: ");
-  
-  const char** currentSubMenuOptions;
-  
-  switch (mainMenuIndex) {
-    case 0: currentSubMenuOptions = wifiSubMenuOptions; break;
-    case 1: currentSubMenuOptions = bleSubMenuOptions; break;
-    case 2: currentSubMenuOptions = infraredSubMenuOptions; break;
-    case 3: currentSubMenuOptions = neokinSubMenuOptions; break;
-    case 4: currentSubMenuOptions = gpioSubMenuOptions; break;   // New GPIO menu
-    case 5: currentSubMenuOptions = settingsSubMenuOptions; break;
-    default: currentSubMenuOptions = wifiSubMenuOptions;
-  }
-  
-  Serial.println(currentSubMenuOptions[subMenuIndex]);
-  
-  // Call appropriate action function based on menu and submenu selection
-  if (mainMenuIndex == 0) { // WIFI
-    if (subMenuIndex == 0) wifiScan();
-    if (subMenuIndex == 1) wifiConnect();
-  } else if (mainMenuIndex == 1) { // BLE
-    if (subMenuIndex == 0) bleConnect();
-  } else if (mainMenuIndex == 2) { // INFRARED
-    switch(subMenuIndex) {
-      case 0: // Transmission
-        infraredATKmenu(); 
-        break;
-      case 1: 
-        infraredReceive(); 
-        break;
-      case 2: 
-        // Library function (if you have one)
-        break;
-      case 3: 
-        // Bombardment function
-        break;
-    }
-  } else if (mainMenuIndex == 4) { // GPIO
-    if (subMenuIndex == 0) gpioRead();
-    if (subMenuIndex == 1) gpioWrite();
-    if (subMenuIndex == 2) gpioToggle();
-    if (subMenuIndex == 3) gpioMonitor();
-  }
-  // Add more menu actions as needed
-}
-
-// Placeholder implementations for other methods
-void MenuSystem::wifiScan() {
-  Serial.println("WIFI SCAN");
-  // Implementation for WiFi scan
-}
-
-void MenuSystem::wifiConnect() {
-  Serial.println("WIFI CONNECT");
-  // Implementation for WiFi connect
-}
-
-void MenuSystem::bleConnect() {
-  Serial.println("BLE CONNECT");
-  // Implementation for BLE connect
-}
-
-void MenuSystem::infraredReceive() {
-  Serial.println("INFRARED RECEIVE");
-  // Implementation for infrared receive
-}
-
-void MenuSystem::infraredATKmenu() {
-  Serial.println("INFRARED ATK MENU");
-  
-  // Directly enter transmission mode without additional button press
-  currentMenu = 1;  // Ensure we're in submenu mode
-  isTransmissionSubMenu = true;
-  transmissionSubMenuIndex = 0;
-  
-  // Draw the transmission submenu immediately
-  drawTransmissionSubMenu();
-}
-
-void MenuSystem::infraredDirectSend() {
-  Serial.println("Executing Infrared Direct Send");
-  
-  // Persistent display until B is pressed
-  bool exitMode = false;
-  
-  while (!exitMode) {
-    display->clearBuffer();
-    display->drawRFrame(0, 0, 128, 64, 4);
-    display->setFont(u8g2_font_6x10_tf);
-    
-    // Title
-    display->drawStr(10, 15, "DIRECT SEND MODE");
-    
-    // Status or additional info
-    display->drawStr(10, 30, "Transmitting...");
-    
-    // Exit instructions
-    display->drawStr(10, 50, "Press B to exit");
-    
-    display->sendBuffer();
-    
-    // Check for exit condition (B button)
-    if (buttons->isButtonPressed(BUTTON_B)) {
-      exitMode = true;
-      delay(200);  // Debounce delay
-    }
-    
-    // Optional: Add actual transmission logic here
-    // For now, just a placeholder
-    delay(100);
-  }
-  
-  // Return to transmission submenu
-  isTransmissionSubMenu = true;
-  transmissionSubMenuIndex = 0;
-  drawTransmissionSubMenu();
-}
-
-void MenuSystem::infraredRepeatSend() {
-  Serial.println("Executing Infrared Repeat Send");
-  
-  // Persistent display until B is pressed
-  bool exitMode = false;
-  int repeatCount = 0;
-  
-  while (!exitMode) {
-    display->clearBuffer();
-    display->drawRFrame(0, 0, 128, 64, 4);
-    display->setFont(u8g2_font_6x10_tf);
-    
-    // Title
-    display->drawStr(10, 15, "REPEAT SEND MODE");
-    
-    // Repeat count
-    char repeatStr[30];
-    snprintf(repeatStr, sizeof(repeatStr), "Repeats: %d", repeatCount);
-    display->drawStr(10, 30, repeatStr);
-    
-    // Exit instructions
-    display->drawStr(10, 50, "Press B to exit");
-    
-    display->sendBuffer();
-    
-    // Check for exit condition (B button)
-    if (buttons->isButtonPressed(BUTTON_B)) {
-      exitMode = true;
-      delay(200);  // Debounce delay
-    }
-    
-    // Optional: Add actual transmission logic here
-    // Increment repeat count as an example
-    repeatCount++;
-    
-    delay(100);
-  }
-  
-  // Return to transmission submenu
-  isTransmissionSubMenu = true;
-  transmissionSubMenuIndex = 0;
-  drawTransmissionSubMenu();
-}
-
-void MenuSystem::infraredBurstSend() {
-  Serial.println("Executing Infrared Burst Send");
-  
-  // Persistent display until B is pressed
-  bool exitMode = false;
-  int burstCount = 0;
-  
-  while (!exitMode) {
-    display->clearBuffer();
-    display->drawRFrame(0, 0, 128, 64, 4);
-    display->setFont(u8g2_font_6x10_tf);
-    
-    // Title
-    display->drawStr(10, 15, "BURST SEND MODE");
-    
-    // Burst count
-    char burstStr[30];
-    snprintf(burstStr, sizeof(burstStr), "Burst Count: %d", burstCount);
-    display->drawStr(10, 30, burstStr);
-    
-    // Exit instructions
-    display->drawStr(10, 50, "Press B to exit");
-    
-    display->sendBuffer();
-    
-    // Check for exit condition (B button)
-    if (buttons->isButtonPressed(BUTTON_B)) {
-      exitMode = true;
-      delay(200);  // Debounce delay
-    }
-    
-    // Optional: Add actual burst transmission logic here
-    // Increment burst count as an example
-    burstCount++;
-    
-    delay(100);
-  }
-  
-  // Return to transmission submenu
-  isTransmissionSubMenu = true;
-  transmissionSubMenuIndex = 0;
-  drawTransmissionSubMenu();
-}
-
-void MenuSystem::infraredAdaptiveSend() {
-  Serial.println("Executing Infrared Adaptive Send");
-  
-  // Persistent display until B is pressed
-  bool exitMode = false;
-  int adaptiveLevel = 0;
-  
-  while (!exitMode) {
-    display->clearBuffer();
-    display->drawRFrame(0, 0, 128, 64, 4);
-    display->setFont(u8g2_font_6x10_tf);
-    
-    // Title
-    display->drawStr(10, 15, "ADAPTIVE SEND MODE");
-    
-    // Adaptive level
-    char adaptiveStr[30];
-    snprintf(adaptiveStr, sizeof(adaptiveStr), "Adaptive Level: %d", adaptiveLevel);
-    display->drawStr(10, 30, adaptiveStr);
-    
-    // Exit instructions
-    display->drawStr(10, 50, "Press B to exit");
-    
-    display->sendBuffer();
-    
-    // Check for exit condition (B button)
-    if (buttons->isButtonPressed(BUTTON_B)) {
-      exitMode = true;
-      delay(200);  // Debounce delay
-    }
-    
-    // Optional: Add actual adaptive transmission logic here
-    // Increment adaptive level as an example
-    adaptiveLevel = (adaptiveLevel + 1) % 10;
-    
-    delay(100);
-  }
-  
-  // Return to transmission submenu
-  isTransmissionSubMenu = true;
-  transmissionSubMenuIndex = 0;
-  drawTransmissionSubMenu();
-}
-
-// GPIO function implementations
-void MenuSystem::gpioRead() {
-  Serial.println("GPIO READ");
-  
-  // Specific digital pins to monitor: 6, 1, 9, 7, 8
-  const int pinCount = 5;
-  const int digitalPins[pinCount] = {6, 1, 9, 7, 8};
-  
-  display->clearBuffer();
-  display->drawRFrame(0, 0, 128, 64, 4);
-  display->setFont(u8g2_font_6x10_tf);
-  
-  // Read and display GPIO pin states
-  display->drawStr(10, 15, "GPIO PIN STATES:");
-  
-  // Read the specific pins
-  for (int i = 0; i < pinCount; i++) {
-    char pinInfo[20];
-    int pinNumber = digitalPins[i];
-    int pinState = digitalRead(pinNumber);
-    snprintf(pinInfo, sizeof(pinInfo), "PIN %d: %s", pinNumber, pinState == HIGH ? "HIGH" : "LOW");
-    display->drawStr(10, 25 + (i * 10), pinInfo);
-  }
-  
-  display->drawStr(10, 60, "Press B to return");
-  display->sendBuffer();
-}
-
-void MenuSystem::gpioWrite() {
-  Serial.println("GPIO WRITE");
-  
-  // Specific digital pins: 6, 1, 9, 7, 8
-  const int pinCount = 5;
-  const int digitalPins[pinCount] = {6, 1, 9, 7, 8};
-  static int selectedPinIndex = 0;
-  
-  display->clearBuffer();
-  display->drawRFrame(0, 0, 128, 64, 4);
-  display->setFont(u8g2_font_6x10_tf);
-  
-  display->drawStr(10, 15, "GPIO WRITE MODE");
-  
-  // Display the currently selected pin
-  char selectedPin[30];
-  snprintf(selectedPin, sizeof(selectedPin), "Selected: PIN %d (%s)", 
-          digitalPins[selectedPinIndex], 
-          digitalRead(digitalPins[selectedPinIndex]) == HIGH ? "HIGH" : "LOW");
-  display->drawStr(10, 30, selectedPin);
-  
-  display->drawStr(10, 40, "Use UP/DOWN to select pin");
-  display->drawStr(10, 50, "Use A to toggle state");
-  display->drawStr(10, 60, "Press B to return");
-  
-  display->sendBuffer();
-}
-
-void MenuSystem::gpioToggle() {
-  Serial.println("GPIO TOGGLE");
-  
-  // Specific digital pins: 6, 1, 9, 7, 8
-  const int pinCount = 5;
-  const int digitalPins[pinCount] = {6, 1, 9, 7, 8};
-  
-  display->clearBuffer();
-  display->drawRFrame(0, 0, 128, 64, 4);
-  display->setFont(u8g2_font_6x10_tf);
-  
-  display->drawStr(10, 15, "GPIO TOGGLE MODE");
-  display->drawStr(10, 25, "Toggling all outputs...");
-  
-  // Toggle each specified pin
-  for (int i = 0; i < pinCount; i++) {
-    int pinNumber = digitalPins[i];
-    int currentState = digitalRead(pinNumber);
-    digitalWrite(pinNumber, !currentState);  // Toggle the state
-    
-    // Display toggle result for each pin
-    char pinInfo[20];
-    snprintf(pinInfo, sizeof(pinInfo), "PIN %d: %s -> %s", 
-            pinNumber, 
-            currentState == HIGH ? "HIGH" : "LOW", 
-            !currentState == HIGH ? "HIGH" : "LOW");
-    display->drawStr(10, 35 + (i * 8), pinInfo);
-  }
-  
-  display->drawStr(10, 60, "Press B to return");
-  display->sendBuffer();
-}
-
-void MenuSystem::gpioMonitor() {
-  Serial.println("GPIO MONITOR");
-  
-  // Specific digital pins: 6, 1, 9, 7, 8
-  const int pinCount = 5;
-  const int digitalPins[pinCount] = {6, 1, 9, 7, 8};
-  
-  display->clearBuffer();
-  display->drawRFrame(0, 0, 128, 64, 4);
-  display->setFont(u8g2_font_6x10_tf);
-  
-  display->drawStr(10, 15, "GPIO MONITOR (LIVE)");
-  
-  // Show real-time state for specific pins
-  for (int i = 0; i < pinCount; i++) {
-    char pinInfo[20];
-    int pinNumber = digitalPins[i];
-    int pinState = digitalRead(pinNumber);
-    
-    // Draw pin number and state
-    snprintf(pinInfo, sizeof(pinInfo), "PIN %d: %s", pinNumber, pinState == HIGH ? "HIGH" : "LOW");
-    display->drawStr(10, 25 + (i * 10), pinInfo);
-    
-    // Draw visual indicator using text instead of graphics
-    if (pinState == HIGH) {
-      display->drawStr(100, 25 + (i * 10), "[ON]");
-    } else {
-      display->drawStr(100, 25 + (i * 10), "[OFF]");
-    }
-  }
-  
-  display->drawStr(10, 60, "Press B to return");
-  display->sendBuffer();
+#include "MenuSystem.h"
+#include "Profiler.h"
+#include "Log.h"
+#include "IrTxQueue.h"
+#include "IrSequencer.h"
+#include "IrAdaptive.h"
+#include "IrLearner.h"
+#include "IrLibrary.h"
+#include "IrProtocols.h"
+#include "LogicAnalyzer.h"
+#include "AdcScope.h"
+
+#define SUBMENU_ROWS 5  // list rows that fit under the title bar
+#define LIBRARY_ROWS 3
+
+static const ListStyle subMenuStyle = {
+  u8g2_font_6x10_tf, u8g2_font_4x6_tf, 4, 12, 24, SUBMENU_ROWS, 10, true
+};
+
+// Rows read "> device brand function" in one fixed-width font
+static const ListStyle libraryStyle = {
+  u8g2_font_4x6_tr, u8g2_font_4x6_tr, 10, 18, 24, LIBRARY_ROWS, 7, false
+};
+
+// Constructor - initialize new variables
+MenuSystem::MenuSystem()
+  : display(nullptr), buttons(nullptr), scheduler(nullptr),
+    depth(0), functionScreen(false),
+    inputPending(false), inputTimestamp(0), lastInputLatency(0), maxInputLatency(0), redrawHook(nullptr),
+    redrawContext(nullptr),
+    subMenuList(&subMenuStyle), listedMenu(nullptr), libraryList(&libraryStyle),
+    actionTaskId(-1), activeAction(ACTION_NONE), actionCounter(0), libraryCursor(0), bombardNext(0),
+    macroCursor(0), macroCount(-1), logicRow(0), logicZoom(0), logicScroll(0), patternCursor(0), patternCount(0),
+    patternForever(false), gpioWriteCursor(0), gpioWriteDriven(0), gpioWriteLevels(0) {
+  menuStack[0] = &menuRoot;
+  menuIndex[0] = 0;
+  capturedFrame.count = 0;
+  memset(&capturedCode, 0, sizeof(capturedCode));
+  macroName[0] = '\0';
+  memset(&pattern, 0, sizeof(pattern));
+}
+
+void MenuSystem::init(DisplayManager* displayManager, ButtonHandler* buttonHandler, Scheduler* taskScheduler) {
+  display = displayManager;
+  buttons = buttonHandler;
+  scheduler = taskScheduler;
+  actionTaskId = scheduler->addTask("action", actionTask, this, ACTION_TASK_PRIORITY, false);
+}
+
+void MenuSystem::update() {
+  static bool lastFunctionScreen = false;
+  
+  // Log state transitions for debugging
+  if (functionScreen != lastFunctionScreen) {
+    if (functionScreen) {
+      LOG_DEBUG(LOG_MSG_ENTERED_FUNCTION_SCREEN);
+    } else {
+      LOG_DEBUG(LOG_MSG_EXITED_FUNCTION_SCREEN);
+    }
+    lastFunctionScreen = functionScreen;
+  }
+
+  // Redraw the current menu
+  if (activeAction != ACTION_NONE) {
+    drawActionScreen();
+  } else if (depth == 0) {
+    drawMainMenu();
+  } else if (functionScreen) {
+    LOG_DEBUG(LOG_MSG_DRAW_FUNCTION_SCREEN);
+    drawFunctionScreen();
+  } else {
+    LOG_DEBUG(LOG_MSG_DRAW_SUBMENU);
+    drawSubMenu();
+  }
+
+  if (inputPending) {
+    lastInputLatency = micros() - inputTimestamp;
+    maxInputLatency = max(maxInputLatency, lastInputLatency);
+    inputPending = false;
+  }
+}
+
+// Dispatch one queued button event; called by ButtonHandler::checkButtons()
+void MenuSystem::handleButtonEvent(const ButtonEvent& event) {
+  bool navigation = event.pin == ButtonHandler::BUTTON_LEFT || event.pin == ButtonHandler::BUTTON_RIGHT ||
+                    event.pin == ButtonHandler::BUTTON_UP || event.pin == ButtonHandler::BUTTON_DOWN;
+
+  // Held navigation keys auto-repeat; A and B act once per press
+  if (event.type != BUTTON_PRESS && !(event.type == BUTTON_REPEAT && navigation)) {
+    return;
+  }
+
+  if (!inputPending) {
+    inputPending = true;
+    inputTimestamp = event.timestamp;
+  }
+
+  switch (event.pin) {
+    case ButtonHandler::BUTTON_A: handleSelectButton(); break;
+    case ButtonHandler::BUTTON_B: handleBackButton(); break;
+    case ButtonHandler::BUTTON_LEFT: handleLeftButton(); break;
+    case ButtonHandler::BUTTON_RIGHT: handleRightButton(); break;
+    case ButtonHandler::BUTTON_UP: handleUpButton(); break;
+    case ButtonHandler::BUTTON_DOWN: handleDownButton(); break;
+  }
+}
+
+uint32_t MenuSystem::getInputLatency() const {
+  return lastInputLatency;
+}
+
+uint32_t MenuSystem::getMaxInputLatency() const {
+  return maxInputLatency;
+}
+
+bool MenuSystem::hasPendingInput() const {
+  return inputPending;
+}
+
+// Only the modes that move on their own; the rest redraw on input or
+// invalidate() when something arrives
+bool MenuSystem::isAnimating() const {
+  switch (activeAction) {
+    case ACTION_NONE:
+      return depth > 0 && !functionScreen && subMenuList.isScrolling();
+    case ACTION_REPEAT_SEND:
+    case ACTION_BURST_SEND:
+      return irSequencer.isPlaying();
+    case ACTION_ADAPTIVE_SEND:
+      return irAdaptive.isRunning();
+    case ACTION_LIBRARY:
+      return libraryList.isScrolling();
+    case ACTION_LOGIC:
+      return logicAnalyzer.getState() == LOGIC_ARMED;
+    case ACTION_PATTERN:
+      return patternGenerator.isRunning();
+    case ACTION_SCOPE:
+      return adcScope.isRunning() && !adcScope.isHeld();
+    default:
+      return false;
+  }
+}
+
+void MenuSystem::setRedrawHook(MenuRedrawHook hook, void* context) {
+  redrawHook = hook;
+  redrawContext = context;
+}
+
+void MenuSystem::invalidate() {
+  if (redrawHook != nullptr) {
+    redrawHook(redrawContext);
+  }
+}
+
+// Selected child of the menu shown at the current depth
+const MenuNode& MenuSystem::currentItem() const {
+  return menuStack[depth]->children[menuIndex[depth]];
+}
+
+void MenuSystem::enterMenu(const MenuNode* node) {
+  if (depth + 1 >= MENU_MAX_DEPTH) {
+    return;
+  }
+  depth++;
+  menuStack[depth] = node;
+  menuIndex[depth] = 0;
+  functionScreen = false;
+}
+
+void MenuSystem::leaveMenu() {
+  if (depth > 0) {
+    depth--;
+  }
+}
+
+// Move the cursor within the current list, wrapping at both ends
+void MenuSystem::moveSelection(int delta) {
+  if (activeAction == ACTION_LIBRARY && irLibrary.size() > 0) {
+    libraryCursor = (libraryCursor + irLibrary.size() + delta) % irLibrary.size();
+    return;
+  }
+  if (activeAction == ACTION_BURST_SEND && macroCount > 0 && !irSequencer.isPlaying()) {
+    macroCursor = (macroCursor + macroCount + delta) % macroCount;
+    selectMacro();
+    return;
+  }
+  if (activeAction == ACTION_PATTERN && patternCount > 0 && !patternGenerator.isRunning()) {
+    patternCursor = (patternCursor + patternCount + delta) % patternCount;
+    selectPattern();
+    return;
+  }
+  if (activeAction == ACTION_GPIO_WRITE) {
+    gpioWriteCursor = (gpioWriteCursor + PATTERN_CHANNELS + delta) % PATTERN_CHANNELS;
+    return;
+  }
+  if (activeAction != ACTION_NONE || functionScreen) {
+    return;
+  }
+  uint8_t count = menuStack[depth]->childCount;
+  menuIndex[depth] = (menuIndex[depth] + count + delta) % count;
+}
+
+void MenuSystem::handleSelectButton() {
+  LOG_DEBUG(LOG_MSG_SELECT_PRESSED);
+  
+  if (activeAction == ACTION_RECEIVE) {
+    replayCapture();
+    return;
+  }
+  if (activeAction == ACTION_LIBRARY) {
+    sendLibraryCode();
+    return;
+  }
+  if (activeAction == ACTION_DIRECT_SEND) {
+    queueLibraryCode(libraryCursor, 0, onDirectSent);
+    return;
+  }
+  if (activeAction == ACTION_BURST_SEND) {
+    playMacro();
+    return;
+  }
+  if (activeAction == ACTION_LEARN) {
+    irLearner.commit();
+    return;
+  }
+  if (activeAction == ACTION_ADAPTIVE_SEND && !irAdaptive.isRunning()) {
+    irAdaptive.start(libraryCursor);
+    scheduler->start(actionTaskId);
+    return;
+  }
+  if (activeAction == ACTION_LOGIC) {
+    selectLogic();
+    return;
+  }
+  if (activeAction == ACTION_PATTERN) {
+    playPattern();
+    return;
+  }
+  if (activeAction == ACTION_SCOPE) {
+    adcScope.setHold(!adcScope.isHeld());
+    return;
+  }
+  if (activeAction == ACTION_GPIO_WRITE) {
+    flipGpio();
+    return;
+  }
+  if (activeAction != ACTION_NONE) {
+    // Transmission modes only listen for B
+    return;
+  }
+
+  if (functionScreen) {
+    // Execute function when in function screen
+    LOG_INFO(LOG_MSG_EXECUTE_FROM_FUNCTION_SCREEN);
+    executeFunctionAction();
+    return;
+  }
+
+  const MenuNode& item = currentItem();
+  LOG_INFO(LOG_MSG_SELECTED_OPTION, item.label);
+
+  if (item.flags & MENU_BACK) {
+    LOG_INFO(LOG_MSG_BACK_OPTION);
+    leaveMenu();
+  } else if (item.childCount > 0) {
+    LOG_INFO(LOG_MSG_ENTER_SUBMENU);
+    enterMenu(&item);
+  } else if (item.flags & MENU_IMMEDIATE) {
+    if (item.action != nullptr) {
+      (this->*item.action)();
+    }
+  } else {
+    // Enter function screen
+    LOG_INFO(LOG_MSG_ENTER_FUNCTION_SCREEN);
+    functionScreen = true;
+  }
+}
+
+void MenuSystem::handleBackButton() {
+  LOG_DEBUG(LOG_MSG_BACK_PRESSED);
+  
+  if (activeAction == ACTION_LOGIC && logicAnalyzer.getState() != LOGIC_IDLE) {
+    // Back from the armed screen or the capture to the settings
+    logicAnalyzer.cancel();
+  } else if (activeAction == ACTION_PATTERN && patternGenerator.isRunning()) {
+    // B ends the pattern; a second B leaves
+    patternGenerator.stop();
+  } else if (activeAction != ACTION_NONE) {
+    LOG_INFO(LOG_MSG_EXIT_TRANSMISSION);
+    stopAction();
+  } else if (functionScreen) {
+    LOG_INFO(LOG_MSG_EXIT_FUNCTION_SCREEN);
+    functionScreen = false;
+  } else if (depth > 0) {
+    LOG_INFO(LOG_MSG_EXIT_SUBMENU);
+    leaveMenu();
+  }
+}
+
+void MenuSystem::handleBButton() {
+  LOG_DEBUG(LOG_MSG_B_PRESSED);
+  handleBackButton();
+
+  // Hack: force a direct update to ensure the display refreshes
+  update();
+}
+
+void MenuSystem::handleLeftButton() {
+  if (activeAction == ACTION_LOGIC) {
+    moveLogic(-1, 0);
+    return;
+  }
+  if (activeAction == ACTION_PATTERN) {
+    patternForever = !patternForever;
+    return;
+  }
+  if (activeAction == ACTION_SCOPE) {
+    moveScope(-1, 0);
+    return;
+  }
+  moveSelection(-1);
+}
+
+void MenuSystem::handleRightButton() {
+  if (activeAction == ACTION_RECEIVE) {
+    saveCapture();
+    return;
+  }
+  if (activeAction == ACTION_LOGIC) {
+    moveLogic(1, 0);
+    return;
+  }
+  if (activeAction == ACTION_PATTERN) {
+    patternForever = !patternForever;
+    return;
+  }
+  if (activeAction == ACTION_SCOPE) {
+    moveScope(1, 0);
+    return;
+  }
+  moveSelection(1);
+}
+
+void MenuSystem::handleUpButton() {
+  if (activeAction == ACTION_LOGIC) {
+    moveLogic(0, -1);
+    return;
+  }
+  if (activeAction == ACTION_SCOPE) {
+    moveScope(0, 1);
+    return;
+  }
+  moveSelection(-1);
+}
+
+void MenuSystem::handleDownButton() {
+  if (activeAction == ACTION_LOGIC) {
+    moveLogic(0, 1);
+    return;
+  }
+  if (activeAction == ACTION_SCOPE) {
+    moveScope(0, -1);
+    return;
+  }
+  moveSelection(1);
+}
+
+void MenuSystem::beginScreen(MenuLayer layer) {
+  if (display->beginLayer(layer)) {
+    return;
+  }
+
+  // Draw frame using RFrame for rounded corners
+  display->drawRFrame(0, 0, 128, 64, 4);
+  switch (layer) {
+    case LAYER_MAIN_MENU:
+      display->drawRFrame(0, 0, 128, 12, 4);
+      display->setFont(u8g2_font_4x6_tr);
+      display->drawLabel(4, 9, "NEOos V.1.0");
+      display->drawLabel(110, 8, "- X");
+      // Navigation indicators
+      display->drawLabel(119, 55, ">");
+      display->drawLabel(5, 55, "<");
+      break;
+    case LAYER_SUB_MENU:
+      display->drawRFrame(0, 0, 128, 12, 4);
+      display->setFont(u8g2_font_4x6_tr);
+      display->drawLabel(110, 8, "- X");
+      break;
+    case LAYER_FUNCTION:
+      display->drawRFrame(0, 0, 128, 10, 3);
+      display->setFont(u8g2_font_4x6_tr);
+      display->drawLabel(109, 7, "- X");
+      break;
+    case LAYER_WINDOW:
+      break;
+  }
+  display->saveLayer(layer);
+}
+
+void MenuSystem::drawMainMenu() {
+  const MenuNode& item = menuRoot.children[menuIndex[0]];
+
+  beginScreen(LAYER_MAIN_MENU);
+  
+  // Draw selected menu item
+  display->setFont(u8g2_font_profont17_tr);
+  int textWidth = display->getStrWidth(item.label);
+  display->drawLabel(64 - (textWidth / 2), 58, item.label);
+  
+  // Draw menu icon centered
+  int iconWidth = display->getStrWidth(item.icon);
+  int iconX = (128 - iconWidth) / 2; // Center the icon
+  display->drawLabel(iconX, 35, item.icon);
+  
+  display->sendBuffer();
+}
+
+bool MenuSystem::subMenuRow(uint32_t index, char* text, size_t size, void* context) {
+  MenuSystem* self = static_cast<MenuSystem*>(context);
+  const MenuNode* menu = self->menuStack[self->depth];
+  if (index >= menu->childCount) {
+    return false;
+  }
+  snprintf(text, size, "%s", menu->children[index].label);
+  return true;
+}
+
+void MenuSystem::drawSubMenu() {
+  const MenuNode* menu = menuStack[depth];
+
+  beginScreen(LAYER_SUB_MENU);
+  
+  // Draw context-specific title: the highlighted item for a top-level
+  // submenu, the parent and list name further down
+  display->setFont(u8g2_font_4x6_tr);
+  char contextTitle[32];
+  if (depth == 1) {
+    snprintf(contextTitle, sizeof(contextTitle), ":// %s", currentItem().label);
+  } else {
+    snprintf(contextTitle, sizeof(contextTitle), ":// %s %s", menuStack[depth - 1]->label, menu->label);
+  }
+  display->drawStr(5, 9, contextTitle);
+  
+  // Draw submenu items in vertical list; longer lists scroll so the
+  // cursor stays on screen. Another menu starts from its own position.
+  subMenuList.setCount(menu->childCount);
+  if (menu != listedMenu) {
+    subMenuList.jumpTo(menuIndex[depth]);
+    listedMenu = menu;
+  } else {
+    subMenuList.setCursor(menuIndex[depth]);
+  }
+  subMenuList.draw(display, subMenuRow, this);
+  
+  display->sendBuffer();
+}
+
+void MenuSystem::drawFunctionScreen() {
+  // The top-level category gives the context and status icon
+  const MenuNode* category = menuStack[1];
+
+  beginScreen(LAYER_FUNCTION);
+  
+  // Show main menu context in the title
+  display->setFont(u8g2_font_4x6_tr);
+  char titleName[30];
+  snprintf(titleName, sizeof(titleName), "%s:%s", category->label, currentItem().label);
+  display->drawStr(8, 8, titleName);
+  
+  // Draw status indicator with context-specific info
+  display->setFont(u8g2_font_6x12_tr);
+  display->drawLabel(111, 23, category->icon);
+  
+  display->sendBuffer();
+}
+
+void MenuSystem::executeFunctionAction() {
+  // Process specific submenu action
+  const MenuNode& item = currentItem();
+  LOG_INFO(LOG_MSG_EXECUTE_FUNCTION, item.label);
+  
+  // Leaves without an action are not implemented yet
+  if (item.action != nullptr) {
+    (this->*item.action)();
+  }
+}
+
+// Placeholder implementations for other methods
+void MenuSystem::wifiScan() {
+  LOG_INFO(LOG_MSG_WIFI_SCAN);
+  // Implementation for WiFi scan
+}
+
+void MenuSystem::wifiConnect() {
+  LOG_INFO(LOG_MSG_WIFI_CONNECT);
+  // Implementation for WiFi connect
+}
+
+void MenuSystem::bleConnect() {
+  LOG_INFO(LOG_MSG_BLE_CONNECT);
+  // Implementation for BLE connect
+}
+
+void MenuSystem::infraredReceive() {
+  LOG_INFO(LOG_MSG_INFRARED_RECEIVE);
+  capturedFrame.count = 0;
+  irCapture.begin();
+  startAction(ACTION_RECEIVE);
+}
+
+// Hand every frame the ISR has finished to the screen; the newest wins
+void MenuSystem::pollCapture() {
+  while (irCapture.readFrame(capturedFrame)) {
+    invalidate();
+    actionCounter++;
+    LOG_INFO(LOG_MSG_IR_CAPTURED, capturedFrame.count);
+
+    memset(&capturedCode, 0, sizeof(capturedCode));
+    if (!irDecode(capturedFrame.durations, capturedFrame.count, capturedCode)) {
+      capturedCode.protocol = IR_PROTOCOL_RAW;
+      capturedCode.carrierKHz = IR_DEFAULT_CARRIER / 1000;
+    } else if (capturedCode.flags & IR_CODE_FLAG_REPEAT) {
+      LOG_INFO(LOG_MSG_IR_DECODED_REPEAT, irProtocolName(capturedCode.protocol));
+    } else {
+      LOG_INFO(LOG_MSG_IR_DECODED, irProtocolName(capturedCode.protocol), capturedCode.bits,
+               (unsigned long)capturedCode.address, (unsigned long)capturedCode.command);
+    }
+  }
+}
+
+void MenuSystem::replayCapture() {
+  if (capturedFrame.count == 0) {
+    return;
+  }
+  LOG_INFO(LOG_MSG_IR_REPLAY, capturedFrame.count);
+
+  // Don't record our own transmission if the LED reaches the receiver;
+  // listening resumes once the frame is out
+  irCapture.end();
+  if (!irTxQueue.enqueue(capturedFrame.durations, capturedFrame.count, IR_DEFAULT_CARRIER, 0,
+                         onReplayDone, this)) {
+    LOG_WARN(LOG_MSG_IR_TX_QUEUE_FULL);
+    irCapture.begin();
+  }
+}
+
+void MenuSystem::onReplayDone(uint32_t tag, IrTxEvent event, void* context) {
+  MenuSystem* menu = static_cast<MenuSystem*>(context);
+  if (event != IR_TX_CANCELLED && menu->activeAction == ACTION_RECEIVE && irTxQueue.getQueued() == 0) {
+    irCapture.begin();
+  }
+}
+
+// Learned frames go in under LEARNED/<protocol>, numbered in order.
+// Decoded codes keep only address and command; anything else (repeat
+// frames included) is stored as raw timings.
+void MenuSystem::saveCapture() {
+  if (capturedFrame.count == 0) {
+    return;
+  }
+  if (!irLibrary.isOpen()) {
+    LOG_WARN(LOG_MSG_IR_LIBRARY_UNAVAILABLE);
+    return;
+  }
+  char function[IR_KEY_FUNCTION + 1];
+  snprintf(function, sizeof(function), "CODE%03lu", (unsigned long)(irLibrary.size() + 1) % 100000000);
+
+  IrCode code = capturedCode;
+  bool raw = code.protocol == IR_PROTOCOL_RAW || (code.flags & IR_CODE_FLAG_REPEAT);
+  if (raw) {
+    memset(&code, 0, sizeof(code));
+    code.protocol = IR_PROTOCOL_RAW;
+    code.carrierKHz = IR_DEFAULT_CARRIER / 1000;
+  }
+  irCodeKeySet(code.key, "LEARNED", irProtocolName(code.protocol), function);
+  int32_t id = raw ? irLibrary.insert(code, capturedFrame.durations, capturedFrame.count) : irLibrary.insert(code);
+  if (id >= 0) {
+    LOG_INFO(LOG_MSG_IR_SAVED, function, (unsigned long)id);
+  }
+}
+
+// Learns a whole remote: every key pressed while the screen is up is
+// kept once, and the batch is saved on A or on leaving
+void MenuSystem::infraredLearn() {
+  LOG_INFO(LOG_MSG_IR_LEARN);
+  irLearner.begin();
+  startAction(ACTION_LEARN);
+}
+
+void MenuSystem::infraredLibrary() {
+  LOG_INFO(LOG_MSG_IR_LIBRARY);
+  libraryCursor = 0;
+  libraryList.jumpTo(0);
+  startAction(ACTION_LIBRARY);
+}
+
+static bool takeId(const IrCodeKey& key, uint32_t id, void* context) {
+  *static_cast<int32_t*>(context) = id;
+  return false;
+}
+
+static bool takeKey(const IrCodeKey& key, uint32_t id, void* context) {
+  *static_cast<IrCodeKey*>(context) = key;
+  return false;
+}
+
+// Encodes the code at a sorted library position straight into a transmit
+// slot. Returns false if the queue is full or the code can't be sent.
+bool MenuSystem::queueLibraryCode(uint32_t position, uint32_t gapUs, IrTxCallback callback) {
+  uint16_t* durations = irTxQueue.reserve();
+  if (durations == nullptr) {
+    LOG_WARN(LOG_MSG_IR_TX_QUEUE_FULL);
+    return false;
+  }
+  int32_t id = -1;
+  irLibrary.list(takeId, &id, nullptr, nullptr, position, 1);
+  IrCode code;
+  if (id < 0 || !irLibrary.get(id, code)) {
+    return false;
+  }
+  LOG_INFO(LOG_MSG_IR_SEND_CODE, (unsigned long)id);
+
+  uint16_t count;
+  if (code.protocol == IR_PROTOCOL_RAW) {
+    count = irLibrary.readRaw(code, durations, IR_TX_MAX_DURATIONS);
+  } else {
+    count = irEncode(code, durations, IR_TX_MAX_DURATIONS);
+    if (count == 0) {
+      LOG_WARN(LOG_MSG_IR_NO_ENCODER, code.protocol);
+    }
+  }
+  return count > 0 && irTxQueue.commit(count, irCodeCarrierKHz(code) * 1000UL, gapUs, callback, this, id,
+                                       code.tunedDuty);
+}
+
+// A code ADAPTIVE SEND found needs repeats to get through goes out as a
+// one-step macro with them
+void MenuSystem::sendLibraryCode() {
+  int32_t id = -1;
+  IrCode code;
+  irLibrary.list(takeId, &id, nullptr, nullptr, libraryCursor, 1);
+  if (id < 0 || !irLibrary.get(id, code) || code.tunedRepeats == 0) {
+    queueLibraryCode(libraryCursor, 0, nullptr);
+    return;
+  }
+  if (irSequencer.isPlaying()) {
+    return;
+  }
+  LOG_INFO(LOG_MSG_IR_SEND_CODE, (unsigned long)id);
+  IrMacro send;
+  irCodeKeyField(code.key.function, IR_KEY_FUNCTION, send.name);
+  send.steps[0].key = code.key;
+  send.steps[0].repeats = code.tunedRepeats;
+  send.steps[0].gapUs = 0;
+  send.steps[0].carrierKHz = 0;
+  send.steps[0].duty = 0;
+  send.stepCount = 1;
+  irSequencer.start(send);
+}
+
+// BOMBARDMENT: every library code in turn, TV-B-Gone style. The step
+// keeps the transmit queue topped up; progress comes back through the
+// completion callback while the screen stays responsive.
+void MenuSystem::infraredTvbgone() {
+  LOG_INFO(LOG_MSG_IR_BOMBARD, (unsigned long)irLibrary.size());
+  bombardNext = 0;
+  startAction(ACTION_BOMBARD);
+}
+
+void MenuSystem::onBombardSent(uint32_t tag, IrTxEvent event, void* context) {
+  MenuSystem* menu = static_cast<MenuSystem*>(context);
+  // A frame that could not go out is done with, as a skipped code is
+  if (event != IR_TX_CANCELLED && menu->activeAction == ACTION_BOMBARD) {
+    menu->actionCounter++;
+    menu->invalidate();
+  }
+}
+
+void MenuSystem::stepBombard() {
+  while (bombardNext < irLibrary.size() && irTxQueue.reserve() != nullptr) {
+    // A code that can't be sent is skipped, and counted as done
+    if (!queueLibraryCode(bombardNext, IR_BOMBARD_GAP, onBombardSent)) {
+      actionCounter++;
+    }
+    bombardNext++;
+    invalidate();
+  }
+}
+
+static bool libraryRow(uint32_t index, char* text, size_t size, void* context) {
+  IrCodeKey key;
+  if (irLibrary.list(takeKey, &key, nullptr, nullptr, index, 1) == 0) {
+    return false;
+  }
+  char device[IR_KEY_DEVICE + 1];
+  char brand[IR_KEY_BRAND + 1];
+  char function[IR_KEY_FUNCTION + 1];
+  irCodeKeyField(key.device, IR_KEY_DEVICE, device);
+  irCodeKeyField(key.brand, IR_KEY_BRAND, brand);
+  irCodeKeyField(key.function, IR_KEY_FUNCTION, function);
+  snprintf(text, size, "%s %s %s", device, brand, function);
+  return true;
+}
+
+// The visible rows of the sorted library, each read straight from the index
+void MenuSystem::drawLibraryRows() {
+  libraryList.setCount(irLibrary.size());
+  libraryList.setCursor(libraryCursor);
+  libraryList.draw(display, libraryRow);
+  display->setFont(u8g2_font_6x10_tf);
+}
+
+// Transmission modes run as a scheduler task until B is pressed. Each
+// step advances the mode's state; the screen is drawn by update().
+void MenuSystem::startAction(MenuAction action) {
+  activeAction = action;
+  actionCounter = 0;
+  scheduler->start(actionTaskId);
+}
+
+void MenuSystem::stopAction() {
+  if (activeAction == ACTION_RECEIVE) {
+    irCapture.end();
+  }
+  if (activeAction == ACTION_LEARN) {
+    irLearner.end();
+  }
+  if (activeAction == ACTION_LOGIC) {
+    logicAnalyzer.cancel();
+  }
+  if (activeAction == ACTION_PATTERN) {
+    patternGenerator.stop();
+  }
+  if (activeAction == ACTION_SCOPE) {
+    adcScope.stop();
+  }
+  // Whatever is on the air finishes; nothing queued starts
+  irAdaptive.stop();
+  irSequencer.stop();
+  irTxQueue.cancel();
+  // Transmission modes go back to the top of their list; receive and the
+  // library leave the cursor where they were opened from
+  if (activeAction != ACTION_RECEIVE && activeAction != ACTION_LIBRARY && activeAction != ACTION_BOMBARD &&
+      activeAction != ACTION_LEARN && activeAction != ACTION_LOGIC && activeAction != ACTION_PATTERN &&
+      activeAction != ACTION_SCOPE && activeAction != ACTION_GPIO_WRITE) {
+    menuIndex[depth] = 0;
+  }
+  activeAction = ACTION_NONE;
+  scheduler->stop(actionTaskId);
+}
+
+// Every frame the learner takes in moves one of the counts on screen
+static uint32_t learnerFrames() {
+  return irLearner.getLearned() + irLearner.getDuplicates() + irLearner.getRepeats() + irLearner.getFailed();
+}
+
+uint32_t MenuSystem::actionTask(void* context) {
+  return static_cast<MenuSystem*>(context)->stepAction();
+}
+
+uint32_t MenuSystem::stepAction() {
+  PROFILE_SCOPE(SPAN_ACTION);
+  switch (activeAction) {
+    case ACTION_DIRECT_SEND:
+    case ACTION_LIBRARY:
+      // Only react to buttons; sends report back through their callbacks
+      return TASK_STOP;
+    case ACTION_REPEAT_SEND:
+    case ACTION_BURST_SEND:
+      // Completions top the queue up as well; this only catches up
+      irSequencer.pump();
+      break;
+    case ACTION_ADAPTIVE_SEND:
+      // Paces itself on the sends and the receiver
+      return irAdaptive.step();
+    case ACTION_RECEIVE:
+      pollCapture();
+      break;
+    case ACTION_LEARN: {
+      uint32_t seen = learnerFrames();
+      irLearner.poll();
+      if (learnerFrames() != seen) {
+        invalidate();
+      }
+      break;
+    }
+    case ACTION_BOMBARD:
+      stepBombard();
+      break;
+    case ACTION_LOGIC:
+      // One burst of sampling per step; nothing to do once a capture is in
+      if (logicAnalyzer.step()) {
+        showLogicCapture();
+      }
+      return logicAnalyzer.getState() == LOGIC_ARMED ? LOGIC_REARM_INTERVAL : TASK_STOP;
+    case ACTION_PATTERN:
+      // The timer plays the steps; this logs the end, or polls where there is no timer
+      return patternGenerator.poll();
+    case ACTION_SCOPE:
+      // The DMA keeps converting between steps; this folds what it has
+      return adcScope.step();
+    case ACTION_GPIO_WRITE:
+      // Only reacts to buttons
+      return TASK_STOP;
+    default:
+      return TASK_STOP;
+  }
+  return ACTION_STEP_INTERVAL;
+}
+
+void MenuSystem::drawActionScreen() {
+  if (activeAction == ACTION_LOGIC) {
+    drawLogicScreen();
+    return;
+  }
+  if (activeAction == ACTION_PATTERN) {
+    drawPatternScreen();
+    return;
+  }
+  if (activeAction == ACTION_SCOPE) {
+    drawScopeScreen();
+    return;
+  }
+
+  beginScreen(LAYER_WINDOW);
+  display->setFont(u8g2_font_6x10_tf);
+
+  char statusStr[30];
+  switch (activeAction) {
+    case ACTION_DIRECT_SEND:
+      display->drawLabel(10, 15, "DIRECT SEND MODE");
+      if (!libraryRow(libraryCursor, statusStr, sizeof(statusStr), nullptr)) {
+        display->drawLabel(10, 30, "No codes saved");
+        break;
+      }
+      display->drawStr(10, 27, statusStr);
+      if (irTxQueue.getQueued() > 0) {
+        display->drawLabel(10, 38, "Transmitting...");
+      } else {
+        snprintf(statusStr, sizeof(statusStr), "Sent %d", actionCounter);
+        display->drawStr(10, 38, statusStr);
+      }
+      break;
+    case ACTION_REPEAT_SEND:
+      display->drawLabel(10, 15, "REPEAT SEND MODE");
+      if (!irSequencer.isPlaying()) {
+        display->drawLabel(10, 30, "No codes saved");
+        break;
+      }
+      display->drawStr(10, 30, irSequencer.getName());
+      snprintf(statusStr, sizeof(statusStr), "Repeats: %lu", (unsigned long)irSequencer.getFramesSent());
+      display->drawStr(10, 40, statusStr);
+      break;
+    case ACTION_BURST_SEND:
+      display->drawLabel(10, 15, "BURST SEND MODE");
+      if (macroCount <= 0) {
+        display->drawLabel(10, 30, "No macros");
+        break;
+      }
+      snprintf(statusStr, sizeof(statusStr), "%s %u/%d", irSequencer.isPlaying() ? "Playing" : "Macro",
+               macroCursor + 1, macroCount);
+      display->drawStr(10, 30, statusStr);
+      if (irSequencer.isPlaying()) {
+        snprintf(statusStr, sizeof(statusStr), "Frames: %lu/%lu", (unsigned long)irSequencer.getFramesSent(),
+                 (unsigned long)irSequencer.getFramesTotal());
+      } else {
+        snprintf(statusStr, sizeof(statusStr), "> %s", macroName);
+      }
+      display->drawStr(10, 40, statusStr);
+      break;
+    case ACTION_ADAPTIVE_SEND: {
+      display->drawLabel(10, 15, "ADAPTIVE SEND MODE");
+      IrAdaptivePhase phase = irAdaptive.getPhase();
+      if (phase == IR_ADAPTIVE_IDLE) {
+        display->drawLabel(10, 30, "No codes saved");
+        break;
+      }
+      const IrCode& code = irAdaptive.getCode();
+      if (phase == IR_ADAPTIVE_FAILED) {
+        snprintf(statusStr, sizeof(statusStr), "%s: no echo", irAdaptive.getName());
+        display->drawStr(10, 27, statusStr);
+        snprintf(statusStr, sizeof(statusStr), "Received %u/%u", code.hits, code.trials);
+        display->drawStr(10, 38, statusStr);
+        break;
+      }
+      // While tuning: the parameters on the air; after: the winners
+      const IrAdaptiveTrial& shown = phase == IR_ADAPTIVE_DONE ? irAdaptive.getBest() : irAdaptive.getTrial();
+      if (phase == IR_ADAPTIVE_DONE) {
+        snprintf(statusStr, sizeof(statusStr), "Rate %u%% (%u/%u)", code.hits * 100U / code.trials, code.hits,
+                 code.trials);
+      } else {
+        snprintf(statusStr, sizeof(statusStr), "%s %u/%u", irAdaptive.getName(), shown.hits, shown.sent);
+      }
+      display->drawStr(10, 27, statusStr);
+      snprintf(statusStr, sizeof(statusStr), "%ukHz %u%% x%u %luus", shown.carrierKHz, shown.duty, shown.repeats,
+               (unsigned long)shown.errorUs);
+      display->drawStr(10, 38, statusStr);
+      break;
+    }
+    case ACTION_RECEIVE:
+      display->drawLabel(10, 15, "RECEIVE MODE");
+      if (actionCounter == 0) {
+        display->drawLabel(10, 30, "Waiting for signal...");
+      } else {
+        snprintf(statusStr, sizeof(statusStr), "Frames: %d", actionCounter);
+        display->drawStr(10, 30, statusStr);
+        if (capturedCode.protocol == IR_PROTOCOL_RAW) {
+          snprintf(statusStr, sizeof(statusStr), "Last: %u edges", capturedFrame.count);
+        } else if (capturedCode.flags & IR_CODE_FLAG_REPEAT) {
+          snprintf(statusStr, sizeof(statusStr), "Last: %s repeat", irProtocolName(capturedCode.protocol));
+        } else {
+          snprintf(statusStr, sizeof(statusStr), "%s %lX:%lX", irProtocolName(capturedCode.protocol),
+                   (unsigned long)capturedCode.address, (unsigned long)capturedCode.command);
+        }
+        display->drawStr(10, 40, statusStr);
+      }
+      break;
+    case ACTION_LEARN: {
+      display->drawLabel(10, 15, "LEARN REMOTE");
+      snprintf(statusStr, sizeof(statusStr), "New %u  Saved %u", irLearner.getLearned(), irLearner.getSaved());
+      display->drawStr(10, 27, statusStr);
+      const IrCode& last = irLearner.getLast();
+      if (irLearner.wasLastFailed()) {
+        display->drawLabel(10, 38, irLibrary.isOpen() ? "Save failed" : "No storage to save");
+      } else if (irLearner.getLearned() + irLearner.getDuplicates() == 0) {
+        display->drawLabel(10, 38, "Press remote keys");
+      } else if (!irLearner.wasLastNew()) {
+        snprintf(statusStr, sizeof(statusStr), "Seen: %u dup %u rep", irLearner.getDuplicates(),
+                 irLearner.getRepeats());
+        display->drawStr(10, 38, statusStr);
+      } else if (last.protocol == IR_PROTOCOL_RAW) {
+        display->drawLabel(10, 38, "+ RAW");
+      } else {
+        snprintf(statusStr, sizeof(statusStr), "+ %s %lX:%lX", irProtocolName(last.protocol),
+                 (unsigned long)last.address, (unsigned long)last.command);
+        display->drawStr(10, 38, statusStr);
+      }
+      break;
+    }
+    case ACTION_LIBRARY:
+      if (!irLibrary.isOpen()) {
+        display->drawLabel(10, 15, "LIBRARY");
+        display->drawLabel(10, 30, "No storage");
+      } else if (irLibrary.size() == 0) {
+        display->drawLabel(10, 15, "LIBRARY");
+        display->drawLabel(10, 30, "No codes saved");
+      } else {
+        snprintf(statusStr, sizeof(statusStr), "LIBRARY %lu/%lu", (unsigned long)libraryCursor + 1,
+                 (unsigned long)irLibrary.size());
+        display->drawStr(10, 15, statusStr);
+        drawLibraryRows();
+      }
+      break;
+    case ACTION_GPIO_WRITE:
+      display->drawLabel(10, 15, "GPIO WRITE");
+      for (uint8_t c = 0; c < PATTERN_CHANNELS; c++) {
+        uint8_t bit = 1 << c;
+        int y = 25 + c * 8;
+        snprintf(statusStr, sizeof(statusStr), "GPIO%u: %s", PatternGenerator::getPin(c),
+                 (gpioWriteDriven & bit) == 0 ? "-" : (gpioWriteLevels & bit) != 0 ? "HIGH" : "LOW");
+        if (c == gpioWriteCursor) {
+          display->drawLabel(10, y, ">");
+        }
+        display->drawStr(18, y, statusStr);
+      }
+      break;
+    case ACTION_BOMBARD:
+      display->drawLabel(10, 15, "BOMBARDMENT");
+      if (irLibrary.size() == 0) {
+        display->drawLabel(10, 30, "No codes saved");
+      } else if (actionCounter >= (int)irLibrary.size()) {
+        snprintf(statusStr, sizeof(statusStr), "Done: %lu codes", (unsigned long)irLibrary.size());
+        display->drawStr(10, 30, statusStr);
+      } else {
+        snprintf(statusStr, sizeof(statusStr), "Sent %d/%lu", actionCounter, (unsigned long)irLibrary.size());
+        display->drawStr(10, 30, statusStr);
+        snprintf(statusStr, sizeof(statusStr), "Queued: %u", irTxQueue.getQueued());
+        display->drawStr(10, 40, statusStr);
+      }
+      break;
+    default:
+      break;
+  }
+
+  // Exit instructions
+  if (activeAction == ACTION_RECEIVE && capturedFrame.count > 0) {
+    display->drawLabel(4, 50, "A:play >:save B:exit");
+  } else if ((activeAction == ACTION_LIBRARY || activeAction == ACTION_DIRECT_SEND) && irLibrary.size() > 0) {
+    display->drawLabel(10, 50, "A send, B exit");
+  } else if (activeAction == ACTION_BURST_SEND && macroCount > 0 && !irSequencer.isPlaying()) {
+    display->drawLabel(10, 50, "A play, B exit");
+  } else if (activeAction == ACTION_LEARN && irLearner.getHeld() > 0) {
+    display->drawLabel(10, 50, "A save, B save+exit");
+  } else if (activeAction == ACTION_GPIO_WRITE) {
+    display->drawLabel(10, 50, "A flip, B exit");
+  } else if (activeAction == ACTION_ADAPTIVE_SEND && irAdaptive.getPhase() >= IR_ADAPTIVE_DONE) {
+    display->drawLabel(10, 50, "A again, B exit");
+  } else {
+    display->drawLabel(10, 50, "Press B to exit");
+  }
+
+  display->sendBuffer();
+}
+
+// Sends the code last selected in LIBRARY once, and again on each A
+void MenuSystem::infraredDirectSend() {
+  LOG_INFO(LOG_MSG_IR_DIRECT_SEND);
+  startAction(ACTION_DIRECT_SEND);
+  queueLibraryCode(libraryCursor, 0, onDirectSent);
+}
+
+void MenuSystem::onDirectSent(uint32_t tag, IrTxEvent event, void* context) {
+  MenuSystem* menu = static_cast<MenuSystem*>(context);
+  if (menu->activeAction != ACTION_DIRECT_SEND) {
+    return;
+  }
+  if (event == IR_TX_DONE) {
+    menu->actionCounter++;
+  }
+  menu->invalidate();
+}
+
+// Holds the code last selected in LIBRARY, as a remote does while its
+// key is down: the frame, then repeats a protocol period apart until B
+void MenuSystem::infraredRepeatSend() {
+  LOG_INFO(LOG_MSG_IR_REPEAT_SEND);
+  startAction(ACTION_REPEAT_SEND);
+
+  IrMacro hold;
+  hold.stepCount = 0;
+  if (irLibrary.list(takeKey, &hold.steps[0].key, nullptr, nullptr, libraryCursor, 1) == 0) {
+    return;
+  }
+  irCodeKeyField(hold.steps[0].key.function, IR_KEY_FUNCTION, hold.name);
+  hold.steps[0].repeats = IR_SEQUENCE_HOLD;
+  hold.steps[0].gapUs = 0;
+  hold.steps[0].carrierKHz = 0;
+  hold.steps[0].duty = 0;
+  hold.stepCount = 1;
+  irSequencer.start(hold);
+}
+
+// Macros from IR_MACRO_FILE; UP/DOWN pick one, A plays it
+void MenuSystem::infraredBurstSend() {
+  LOG_INFO(LOG_MSG_IR_BURST_SEND);
+  macroCount = irMacroLoad(IR_MACRO_FILE, 0, nullptr);
+  if (macroCursor >= macroCount) {
+    macroCursor = 0;
+  }
+  selectMacro();
+  startAction(ACTION_BURST_SEND);
+}
+
+// Only the name is kept; the steps are read again when it plays
+void MenuSystem::selectMacro() {
+  IrMacro macro;
+  macroName[0] = '\0';
+  if (irMacroLoad(IR_MACRO_FILE, macroCursor, &macro) > macroCursor) {
+    strcpy(macroName, macro.name);
+  }
+}
+
+void MenuSystem::playMacro() {
+  IrMacro macro;
+  if (irSequencer.isPlaying() || macroCount <= 0 || irMacroLoad(IR_MACRO_FILE, macroCursor, &macro) <= macroCursor) {
+    return;
+  }
+  irSequencer.start(macro);
+}
+
+// Tunes the code last selected in LIBRARY against the onboard receiver;
+// A runs it again once it is over
+void MenuSystem::infraredAdaptiveSend() {
+  LOG_INFO(LOG_MSG_IR_ADAPTIVE_SEND);
+  startAction(ACTION_ADAPTIVE_SEND);
+  irAdaptive.start(libraryCursor);
+}
+
+// GPIO function implementations
+void MenuSystem::gpioRead() {
+  LOG_INFO(LOG_MSG_GPIO_READ);
+  
+  // Specific digital pins to monitor: 6, 1, 9, 7, 8
+  const int pinCount = 5;
+  const int digitalPins[pinCount] = {6, 1, 9, 7, 8};
+  
+  beginScreen(LAYER_WINDOW);
+  display->setFont(u8g2_font_6x10_tf);
+  
+  // Read and display GPIO pin states
+  display->drawLabel(10, 15, "GPIO PIN STATES:");
+  
+  // Read the specific pins
+  for (int i = 0; i < pinCount; i++) {
+    char pinInfo[20];
+    int pinNumber = digitalPins[i];
+    int pinState = digitalRead(pinNumber);
+    snprintf(pinInfo, sizeof(pinInfo), "PIN %d: %s", pinNumber, pinState == HIGH ? "HIGH" : "LOW");
+    display->drawStr(10, 25 + (i * 10), pinInfo);
+  }
+  
+  display->drawLabel(10, 60, "Press B to return");
+  display->sendBuffer();
+}
+
+// Drives the pattern generator's pins by hand. The five pins READ and
+// MONITOR show are buttons and the panel bus on this board, so they
+// are only ever read.
+void MenuSystem::gpioWrite() {
+  LOG_INFO(LOG_MSG_GPIO_WRITE);
+  startAction(ACTION_GPIO_WRITE);
+}
+
+// A pin becomes an output the first time it is written, driven high,
+// and keeps its level after the screen is left
+void MenuSystem::flipGpio() {
+  uint8_t pin = PatternGenerator::getPin(gpioWriteCursor);
+  uint8_t bit = 1 << gpioWriteCursor;
+  bool high = (gpioWriteDriven & bit) == 0 || (gpioWriteLevels & bit) == 0;
+  gpioWritePort(1UL << pin, high ? 1UL << pin : 0);
+  pinMode(pin, OUTPUT);
+  gpioWriteDriven |= bit;
+  gpioWriteLevels = high ? (gpioWriteLevels | bit) : (gpioWriteLevels & ~bit);
+  LOG_INFO(LOG_MSG_GPIO_WRITE_PIN, pin, high ? "HIGH" : "LOW");
+}
+
+// Flips the pins GPIO WRITE drives, all at once, for the same reason
+// only those
+void MenuSystem::gpioToggle() {
+  LOG_INFO(LOG_MSG_GPIO_TOGGLE);
+  
+  beginScreen(LAYER_WINDOW);
+  display->setFont(u8g2_font_6x10_tf);
+  
+  display->drawLabel(10, 15, "GPIO TOGGLE MODE");
+  display->drawLabel(10, 25, "Toggling pattern pins...");
+  
+  // Read every pin first, then flip them all with one port write; GPIO
+  // WRITE shows the levels left behind
+  int states[PATTERN_CHANNELS];
+  uint32_t mask = 0;
+  uint32_t levels = 0;
+  gpioWriteLevels = 0;
+  for (uint8_t c = 0; c < PATTERN_CHANNELS; c++) {
+    uint8_t pin = PatternGenerator::getPin(c);
+    states[c] = digitalRead(pin);
+    mask |= 1UL << pin;
+    if (states[c] == LOW) {
+      levels |= 1UL << pin;
+      gpioWriteLevels |= 1 << c;
+    }
+  }
+  gpioWritePort(mask, levels);
+  for (uint8_t c = 0; c < PATTERN_CHANNELS; c++) {
+    pinMode(PatternGenerator::getPin(c), OUTPUT);
+  }
+  gpioWriteDriven = (1 << PATTERN_CHANNELS) - 1;
+  
+  for (uint8_t i = 0; i < PATTERN_CHANNELS; i++) {
+    uint8_t pinNumber = PatternGenerator::getPin(i);
+    int currentState = states[i];
+    
+    // Display toggle result for each pin
+    char pinInfo[24];
+    snprintf(pinInfo, sizeof(pinInfo), "PIN %d: %s -> %s", 
+            pinNumber, 
+            currentState == HIGH ? "HIGH" : "LOW", 
+            currentState == HIGH ? "LOW" : "HIGH");
+    display->drawStr(10, 35 + (i * 8), pinInfo);
+  }
+  
+  display->drawLabel(10, 60, "Press B to return");
+  display->sendBuffer();
+}
+
+void MenuSystem::gpioMonitor() {
+  LOG_INFO(LOG_MSG_GPIO_MONITOR);
+  
+  // Specific digital pins: 6, 1, 9, 7, 8
+  const int pinCount = 5;
+  const int digitalPins[pinCount] = {6, 1, 9, 7, 8};
+  
+  beginScreen(LAYER_WINDOW);
+  display->setFont(u8g2_font_6x10_tf);
+  
+  display->drawLabel(10, 15, "GPIO MONITOR (LIVE)");
+  
+  // Show real-time state for specific pins
+  for (int i = 0; i < pinCount; i++) {
+    char pinInfo[20];
+    int pinNumber = digitalPins[i];
+    int pinState = digitalRead(pinNumber);
+    
+    // Draw pin number and state
+    snprintf(pinInfo, sizeof(pinInfo), "PIN %d: %s", pinNumber, pinState == HIGH ? "HIGH" : "LOW");
+    display->drawStr(10, 25 + (i * 10), pinInfo);
+    
+    // Draw visual indicator using text instead of graphics
+    if (pinState == HIGH) {
+      display->drawLabel(100, 25 + (i * 10), "[ON]");
+    } else {
+      display->drawLabel(100, 25 + (i * 10), "[OFF]");
+    }
+  }
+  
+  display->drawLabel(10, 60, "Press B to return");
+  display->sendBuffer();
+}
+
+// Logic analyzer screens
+#define LOGIC_SETUP_ROWS (2 + LOGIC_CHANNELS)  // rate, pre-trigger, one per channel
+#define LOGIC_WAVE_X 10                        // traces start right of the pin labels
+#define LOGIC_WAVE_WIDTH (DISPLAY_WIDTH - LOGIC_WAVE_X)
+#define LOGIC_LANE_TOP 8
+#define LOGIC_LANE_HEIGHT 10
+#define LOGIC_ZOOM_MAX 7                       // 128 samples per column fits a whole capture
+
+static void formatRate(char* text, size_t size, uint32_t hz) {
+  if (hz >= 1000000) {
+    snprintf(text, size, "%luMHz", (unsigned long)(hz / 1000000));
+  } else {
+    snprintf(text, size, "%lukHz", (unsigned long)(hz / 1000));
+  }
+}
+
+// samples at hz as a duration, signed when negative is allowed
+static void formatSpan(char* text, size_t size, int32_t samples, uint32_t hz, bool sign) {
+  uint64_t ns = (uint64_t)(samples < 0 ? -(int64_t)samples : samples) * 1000000000ULL / hz;
+  const char* prefix = !sign ? "" : samples < 0 ? "-" : "+";
+  if (ns >= 1000000) {
+    snprintf(text, size, "%s%lu.%lums", prefix, (unsigned long)(ns / 1000000), (unsigned long)(ns % 1000000 / 100000));
+  } else if (ns >= 1000) {
+    snprintf(text, size, "%s%luus", prefix, (unsigned long)(ns / 1000));
+  } else {
+    snprintf(text, size, "%s%luns", prefix, (unsigned long)ns);
+  }
+}
+
+// Samples the GPIO pins into RAM and shows them as a waveform; UP/DOWN
+// pick a setting, LEFT/RIGHT change it, A arms
+void MenuSystem::gpioLogic() {
+  LOG_INFO(LOG_MSG_GPIO_LOGIC);
+  logicRow = 0;
+  logicAnalyzer.cancel();
+  startAction(ACTION_LOGIC);
+}
+
+// A arms from the settings, forces the trigger while armed and saves the
+// capture on view
+void MenuSystem::selectLogic() {
+  switch (logicAnalyzer.getState()) {
+    case LOGIC_IDLE:
+      logicAnalyzer.arm();
+      scheduler->start(actionTaskId);
+      break;
+    case LOGIC_ARMED:
+      logicAnalyzer.force();
+      break;
+    case LOGIC_DONE:
+      actionCounter = logicAnalyzer.save() ? 1 : -1;
+      break;
+  }
+}
+
+// Settings: UP/DOWN pick a row, LEFT/RIGHT change it. Capture: LEFT/RIGHT
+// pan by a quarter screen, UP/DOWN zoom in and out around the middle.
+void MenuSystem::moveLogic(int dx, int dy) {
+  LogicState state = logicAnalyzer.getState();
+  if (state == LOGIC_DONE) {
+    int32_t window = (int32_t)LOGIC_WAVE_WIDTH << logicZoom;
+    int32_t scroll = logicScroll + dx * window / 4;
+    if (dy != 0) {
+      int32_t middle = logicScroll + min<int32_t>(window, LOGIC_DEPTH - logicScroll) / 2;
+      logicZoom = constrain(logicZoom + dy, 0, LOGIC_ZOOM_MAX);
+      window = (int32_t)LOGIC_WAVE_WIDTH << logicZoom;
+      scroll = middle - window / 2;
+    }
+    logicScroll = constrain(scroll, 0, max<int32_t>(LOGIC_DEPTH - window, 0));
+    return;
+  }
+  if (state != LOGIC_IDLE) {
+    return;
+  }
+  if (dy != 0) {
+    logicRow = (logicRow + LOGIC_SETUP_ROWS + dy) % LOGIC_SETUP_ROWS;
+    return;
+  }
+  LogicSettings& settings = logicAnalyzer.getSettings();
+  if (logicRow == 0) {
+    uint8_t count = LogicAnalyzer::getRateCount();
+    settings.rate = (settings.rate + count + dx) % count;
+  } else if (logicRow == 1) {
+    settings.pretrigger = (settings.pretrigger + 100 + dx * 10) % 100;
+  } else {
+    LogicCondition& condition = settings.conditions[logicRow - 2];
+    condition = (LogicCondition)((condition + LOGIC_CONDITION_COUNT + dx) % LOGIC_CONDITION_COUNT);
+  }
+}
+
+// A new capture opens whole on screen
+void MenuSystem::showLogicCapture() {
+  logicZoom = LOGIC_ZOOM_MAX;
+  logicScroll = 0;
+  actionCounter = 0;
+}
+
+void MenuSystem::drawLogicScreen() {
+  LogicState state = logicAnalyzer.getState();
+  if (state == LOGIC_DONE) {
+    drawLogicWaveform();
+    return;
+  }
+  const LogicSettings& settings = logicAnalyzer.getSettings();
+  char text[48];
+  char rate[24];
+  formatRate(rate, sizeof(rate), LogicAnalyzer::getRate(settings.rate));
+
+  beginScreen(LAYER_WINDOW);
+  display->setFont(u8g2_font_6x10_tf);
+  display->drawLabel(10, 12, "LOGIC ANALYZER");
+  display->setFont(u8g2_font_4x6_tr);
+
+  if (state == LOGIC_ARMED) {
+    snprintf(text, sizeof(text), "Armed at %s, %u%% before", rate, settings.pretrigger);
+    display->drawStr(10, 26, text);
+    display->drawLabel(10, 34, "Waiting for trigger");
+    snprintf(text, sizeof(text), "Bursts: %lu", (unsigned long)logicAnalyzer.getBursts());
+    display->drawStr(10, 42, text);
+    display->drawLabel(10, 58, "A force, B stop");
+  } else {
+    // Sample rate and pre-trigger on the left, a condition per channel
+    // on the right
+    snprintf(text, sizeof(text), "Rate %s", rate);
+    display->drawStr(10, 24, text);
+    snprintf(text, sizeof(text), "Pre  %u%%", settings.pretrigger);
+    display->drawStr(10, 31, text);
+    for (uint8_t c = 0; c < LOGIC_CHANNELS; c++) {
+      snprintf(text, sizeof(text), "GPIO%u %s", LogicAnalyzer::getPin(c),
+               LogicAnalyzer::getConditionName(settings.conditions[c]));
+      display->drawStr(70, 24 + c * 7, text);
+    }
+    display->drawLabel(logicRow < 2 ? 5 : 65, 24 + (logicRow < 2 ? logicRow : logicRow - 2) * 7, ">");
+    display->drawLabel(10, 60, "A arm, B exit");
+  }
+  display->sendBuffer();
+}
+
+// Five lanes of trace. Each column covers 2^logicZoom samples and shows
+// the channel high, low, or both when it changed within them; the
+// dotted line is the trigger.
+void MenuSystem::drawLogicWaveform() {
+  uint32_t rate = logicAnalyzer.getCaptureRate();
+  uint32_t trigger = logicAnalyzer.getTriggerIndex();
+  uint32_t perColumn = 1UL << logicZoom;
+  char text[64];
+  char at[24];
+  char step[24];
+
+  display->clearBuffer();
+  display->setFont(u8g2_font_4x6_tr);
+  formatSpan(at, sizeof(at), (int32_t)logicScroll - (int32_t)trigger, rate, true);
+  formatSpan(step, sizeof(step), perColumn, rate, false);
+  snprintf(text, sizeof(text), "T%s %s/px", at, step);
+  display->drawStr(0, 6, text);
+  if (logicAnalyzer.getLateSamples() > 0) {
+    snprintf(text, sizeof(text), "%lu late", (unsigned long)logicAnalyzer.getLateSamples());
+    display->drawStr(DISPLAY_WIDTH - display->getStrWidth(text), 6, text);
+  }
+  for (uint8_t c = 0; c < LOGIC_CHANNELS; c++) {
+    snprintf(text, sizeof(text), "%u", LogicAnalyzer::getPin(c));
+    display->drawStr(0, LOGIC_LANE_TOP + c * LOGIC_LANE_HEIGHT + 7, text);
+  }
+
+  U8G2* u8g2 = display->getU8g2();
+  uint8_t previousHigh = 0;
+  uint8_t previousLow = 0;
+  for (int x = 0; x < LOGIC_WAVE_WIDTH; x++) {
+    uint32_t first = logicScroll + ((uint32_t)x << logicZoom);
+    if (first >= LOGIC_DEPTH) {
+      break;
+    }
+    uint8_t high;
+    uint8_t low;
+    logicAnalyzer.summarize(first, perColumn, high, low);
+    for (uint8_t c = 0; c < LOGIC_CHANNELS; c++) {
+      int top = LOGIC_LANE_TOP + c * LOGIC_LANE_HEIGHT;
+      uint8_t bit = 1U << c;
+      // Both levels in the column, or a change since the last one
+      bool edge = (high & bit) && (low & bit);
+      edge |= x > 0 && (((high & bit) && (previousLow & bit)) || ((low & bit) && (previousHigh & bit)));
+      if (edge) {
+        u8g2->drawVLine(LOGIC_WAVE_X + x, top + 1, 7);
+      } else {
+        u8g2->drawPixel(LOGIC_WAVE_X + x, (high & bit) ? top + 1 : top + 7);
+      }
+    }
+    previousHigh = high;
+    previousLow = low;
+  }
+  if (trigger >= logicScroll && ((trigger - logicScroll) >> logicZoom) < LOGIC_WAVE_WIDTH) {
+    int x = LOGIC_WAVE_X + ((trigger - logicScroll) >> logicZoom);
+    for (int y = LOGIC_LANE_TOP; y < LOGIC_LANE_TOP + LOGIC_CHANNELS * LOGIC_LANE_HEIGHT; y += 2) {
+      u8g2->drawPixel(x, y);
+    }
+  }
+
+  if (actionCounter > 0) {
+    display->drawLabel(0, 63, "Saved " LOGIC_EXPORT_FILE);
+  } else if (actionCounter < 0) {
+    display->drawLabel(0, 63, "Cannot write " LOGIC_EXPORT_FILE);
+  } else {
+    display->drawLabel(0, 63, "</> pan  ^/v zoom  A save");
+  }
+  display->sendBuffer();
+}
+
+// Built-in waveforms and the patterns of PATTERN_FILE; UP/DOWN pick one,
+// LEFT/RIGHT switch between its own loop count and until B, A plays it
+void MenuSystem::gpioPattern() {
+  LOG_INFO(LOG_MSG_GPIO_PATTERN);
+  patternCount = gpioPatternLoad(PATTERN_FILE, 0, nullptr);
+  if (patternCursor >= patternCount) {
+    patternCursor = 0;
+  }
+  selectPattern();
+  startAction(ACTION_PATTERN);
+}
+
+void MenuSystem::selectPattern() {
+  if (gpioPatternLoad(PATTERN_FILE, patternCursor, &pattern) <= patternCursor) {
+    pattern.stepCount = 0;
+  }
+}
+
+void MenuSystem::playPattern() {
+  if (patternGenerator.isRunning() || pattern.stepCount == 0) {
+    return;
+  }
+  patternGenerator.start(pattern, patternForever ? PATTERN_FOREVER : pattern.loops);
+  scheduler->start(actionTaskId);
+}
+
+void MenuSystem::drawPatternScreen() {
+  char text[48];
+  beginScreen(LAYER_WINDOW);
+  display->setFont(u8g2_font_6x10_tf);
+  display->drawLabel(10, 12, "PATTERN GEN");
+  display->setFont(u8g2_font_4x6_tr);
+
+  if (patternGenerator.isRunning()) {
+    snprintf(text, sizeof(text), "Playing %s", patternGenerator.getName());
+    display->drawStr(10, 24, text);
+    if (patternGenerator.getLoops() == PATTERN_FOREVER) {
+      snprintf(text, sizeof(text), "Loop %lu, until B", (unsigned long)patternGenerator.getLoopsDone() + 1);
+    } else {
+      // The last step of the last loop plays with every loop counted
+      snprintf(text, sizeof(text), "Loop %lu/%u",
+               (unsigned long)min<uint32_t>(patternGenerator.getLoopsDone() + 1, patternGenerator.getLoops()),
+               patternGenerator.getLoops());
+    }
+    display->drawStr(10, 31, text);
+    snprintf(text, sizeof(text), "Steps %lu, %lu late", (unsigned long)patternGenerator.getStepsDone(),
+             (unsigned long)patternGenerator.getLateSteps());
+    display->drawStr(10, 38, text);
+  } else if (pattern.stepCount == 0) {
+    display->drawLabel(10, 24, "No patterns");
+  } else {
+    uint32_t period = 0;
+    for (uint8_t i = 0; i < pattern.stepCount; i++) {
+      period += pattern.steps[i].us;
+    }
+    char span[24];
+    formatSpan(span, sizeof(span), period, 1000000, false);
+    snprintf(text, sizeof(text), "%u/%d %s", patternCursor + 1, patternCount, pattern.name);
+    display->drawStr(10, 24, text);
+    snprintf(text, sizeof(text), "%u steps, %s period", pattern.stepCount, span);
+    display->drawStr(10, 31, text);
+    if (patternForever) {
+      display->drawLabel(10, 38, "Loop until B");
+    } else {
+      snprintf(text, sizeof(text), "Loop x%u", pattern.loops);
+      display->drawStr(10, 38, text);
+    }
+  }
+
+  int x = 10;
+  for (uint8_t c = 0; c < PATTERN_CHANNELS; c++) {
+    snprintf(text, sizeof(text), "GPIO%u", PatternGenerator::getPin(c));
+    display->drawStr(x, 46, text);
+    x += display->getStrWidth(text) + 6;
+  }
+  display->drawLabel(10, 60, patternGenerator.isRunning() ? "B stop" : "A play, <> loop, B exit");
+  display->sendBuffer();
+}
+
+// Oscilloscope screen
+#define SCOPE_TRACE_TOP 8       // below the status line
+#define SCOPE_TRACE_HEIGHT (DISPLAY_HEIGHT - SCOPE_TRACE_TOP)
+#define SCOPE_LEVEL_STEP 256    // ADC counts per UP/DOWN press
+#define SCOPE_GRID_ROWS 4
+
+static int scopeRow(uint16_t value) {
+  return SCOPE_TRACE_TOP + SCOPE_TRACE_HEIGHT - 1 - (int)value * (SCOPE_TRACE_HEIGHT - 1) / SCOPE_MAX_VALUE;
+}
+
+static uint32_t scopeMillivolts(uint16_t value) {
+  return (uint32_t)value * SCOPE_FULL_SCALE_MV / SCOPE_MAX_VALUE;
+}
+
+// Live trace of SCOPE_PIN; LEFT/RIGHT set the timebase, UP/DOWN the
+// trigger level, A holds the trace
+void MenuSystem::gpioScope() {
+  LOG_INFO(LOG_MSG_GPIO_SCOPE);
+  if (!adcScope.start()) {
+    LOG_WARN(LOG_MSG_SCOPE_FAILED, SCOPE_PIN);
+  }
+  adcScope.setHold(false);
+  startAction(ACTION_SCOPE);
+}
+
+void MenuSystem::moveScope(int dx, int dy) {
+  int timebase = constrain(adcScope.getTimebase() + dx, 0, AdcScope::getTimebaseCount() - 1);
+  if (timebase != adcScope.getTimebase()) {
+    adcScope.setTimebase(timebase);
+  }
+  int level = constrain((int)adcScope.getTriggerLevel() + dy * SCOPE_LEVEL_STEP, 0, SCOPE_MAX_VALUE);
+  adcScope.setTriggerLevel(level);
+}
+
+// The sweep being filled is drawn over the last whole one, left of its
+// write position, so slow timebases still move every frame. Each column
+// is a line from its min to its max, stretched to meet the previous
+// column so steep edges stay joined.
+void MenuSystem::drawScopeScreen() {
+  char text[48];
+  char span[24];
+  display->clearBuffer();
+  display->setFont(u8g2_font_4x6_tr);
+  if (!adcScope.isRunning()) {
+    snprintf(text, sizeof(text), "SCOPE: no ADC on GPIO%u", SCOPE_PIN);
+    display->drawStr(0, 6, text);
+    display->drawLabel(0, 63, "B exit");
+    display->sendBuffer();
+    return;
+  }
+
+  uint16_t progress;
+  const ScopeColumn* fresh = adcScope.getProgress(progress);
+  const ScopeColumn* last = adcScope.getSweep();
+  uint16_t low = SCOPE_MAX_VALUE;
+  uint16_t high = 0;
+  for (int x = 0; x < SCOPE_COLUMNS; x++) {
+    const ScopeColumn& column = x < progress ? fresh[x] : last[x];
+    low = min(low, column.low);
+    high = max(high, column.high);
+  }
+
+  formatSpan(span, sizeof(span), AdcScope::getTimebaseUs(adcScope.getTimebase()), 1000000, false);
+  snprintf(text, sizeof(text), "%s/div %s %lu-%lumV", span,
+           adcScope.isHeld() ? "HOLD" : adcScope.wasTriggered() ? "Trig" : "Auto",
+           (unsigned long)scopeMillivolts(low), (unsigned long)scopeMillivolts(high));
+  display->drawStr(0, 6, text);
+
+  U8G2* u8g2 = display->getU8g2();
+  for (int x = 0; x < DISPLAY_WIDTH; x += SCOPE_DIV_COLUMNS) {
+    for (int row = 0; row <= SCOPE_GRID_ROWS; row++) {
+      u8g2->drawPixel(x, SCOPE_TRACE_TOP + row * (SCOPE_TRACE_HEIGHT - 1) / SCOPE_GRID_ROWS);
+    }
+  }
+  int levelRow = scopeRow(adcScope.getTriggerLevel());
+  u8g2->drawHLine(0, levelRow, 3);
+  u8g2->drawPixel(3, levelRow - 1);
+  u8g2->drawPixel(3, levelRow + 1);
+
+  for (int x = 0; x < SCOPE_COLUMNS; x++) {
+    const ScopeColumn& column = x < progress ? fresh[x] : last[x];
+    uint16_t top = column.high;
+    uint16_t bottom = column.low;
+    if (x > 0 && x != progress) {
+      const ScopeColumn& previous = x - 1 < progress ? fresh[x - 1] : last[x - 1];
+      top = max(top, previous.low);
+      bottom = min(bottom, previous.high);
+    }
+    int y = scopeRow(top);
+    u8g2->drawVLine(x, y, scopeRow(bottom) - y + 1);
+  }
+  if (progress > 0 && progress < SCOPE_COLUMNS) {
+    // Gap at the write position
+    u8g2->setDrawColor(0);
+    u8g2->drawVLine(progress, SCOPE_TRACE_TOP, SCOPE_TRACE_HEIGHT);
+    u8g2->setDrawColor(1);
+  }
+  display->sendBuffer();
 }
\ No newline at end of file
@@ -1,123 +1,207 @@
-#ifndef MENUSYSTEM_H
-#define MENUSYSTEM_H
-
-#include <Arduino.h>
-#include "Display.h"
-#include "ButtonHandler.h"
-
-#define MAIN_MENU_COUNT 6  // Increased from 5 to 6 to add GPIO menu
-#define SUB_MENU_COUNT 5
-#define TRANSMISSION_SUB_MENU_COUNT 5
-
-class MenuSystem {
-  public:
-    MenuSystem();
-    void init(DisplayManager* displayManager, ButtonHandler* buttonHandler);
-    void update();
-    
-    // Button handlers
-    void handleSelectButton();
-    void handleBackButton();
-    void handleLeftButton();
-    void handleRightButton();
-    void handleUpButton();
-    void handleDownButton();
-    void handleBButton();  // New handler specifically for B button
-    
-    // Drawing methods (made public to allow direct access if needed)
-    void drawMainMenu();
-    void drawSubMenu();
-    void drawFunctionScreen();  // New function to draw the function execution screen
-    void drawTransmissionSubMenu();  // New method for transmission submenu
-    
-  private:
-    DisplayManager* display;  // Using DisplayManager
-    ButtonHandler* buttons;
-    
-    int currentMenu;      // 0 = main menu, 1 = submenu
-    int mainMenuIndex;    // Current selected main menu option
-    int subMenuIndex;     // Current selected submenu option
-    int transmissionSubMenuIndex;  // New index for transmission submenu
-    bool functionScreen;  // Flag to indicate function screen is active
-    bool isTransmissionSubMenu;  // Flag to track transmission submenu
-    
-    // Main menu options
-    const char* mainMenuOptions[MAIN_MENU_COUNT] = {
-      "WIFI", "BLE", "INFRARED", "NEOKIN", "GPIO", "SETTINGS"
-    };
-    
-    // Menu icons (using ASCII art as placeholder)
-    const char* menuIcons[MAIN_MENU_COUNT] = {
-      "-}", "{}", "} ~", "^.^", "<>", "#"
-    };
-    
-    // Submenu options for each main menu
-    const char* wifiSubMenuOptions[SUB_MENU_COUNT] = {
-      "ATTACKS", "SCAN", "SELECT", "STATUS", "BACK"
-    };
-    
-    const char* bleSubMenuOptions[SUB_MENU_COUNT] = {
-      "ATTACKS", "SCAN", "STATUS", "CONFIG", "BACK"
-    };
-    
-    const char* infraredSubMenuOptions[SUB_MENU_COUNT] = {
-      "TRANSMISSION", "RECIEVE", "LIBRARY", "BOMBARDMENT", "BACK"
-    };
-    
-    // New transmission submenu options
-    const char* transmissionSubMenuOptions[TRANSMISSION_SUB_MENU_COUNT] = {
-      "DIRECT SEND", 
-      "REPEAT SEND", 
-      "BURST SEND", 
-      "ADAPTIVE SEND", 
-      "BACK"
-    };
-    
-    const char* neokinSubMenuOptions[SUB_MENU_COUNT] = {
-      "STATUS", "VITALS", "LEVEL", "PLAY", "BACK"
-    };
-    
-    // New GPIO submenu options
-    const char* gpioSubMenuOptions[SUB_MENU_COUNT] = {
-      "READ", "WRITE", "TOGGLE", "MONITOR", "BACK"
-    };
-    
-    const char* settingsSubMenuOptions[SUB_MENU_COUNT] = {
-      "GENERAL", "APPEARANCE", "DISPLAY", "OTHER", "BACK"
-    };
-    
-    // Function execution
-    void executeFunctionAction();  // New method to execute function actions
-    
-    // Module action functions
-    void wifiScan();
-    void wifiConnect();
-    void wifiDeauth();
-    void wifiRickroll();
-    void wifiapSpam();
-    void wifiSelect();
-    void bleConnect();
-    void bleSpamIos();
-    void bleSpamAndroid();
-    void bleSpamWindows();
-    void bleSpamAll();
-    void infraredTvbgone();
-    void infraredReceive();
-    void infraredSpam();
-    void infraredPlayback();
-    void infraredATKmenu();
-    
-    // Transmission specific methods
-    void infraredDirectSend();
-    void infraredRepeatSend();
-    void infraredBurstSend();
-    void infraredAdaptiveSend();
-    
-    // New GPIO action functions
-    void gpioRead();
-    void gpioWrite();
-    void gpioToggle();
-    void gpioMonitor();
-};
-
+#ifndef MENUSYSTEM_H
+#define MENUSYSTEM_H
+
+#include <Arduino.h>
+#include "Display.h"
+#include "ButtonHandler.h"
+#include "Scheduler.h"
+#include "MenuTree.h"
+#include "IrCapture.h"
+#include "IrCode.h"
+#include "IrTxQueue.h"
+#include "IrSequencer.h"
+#include "PatternGenerator.h"
+#include "ListView.h"
+
+#define ACTION_STEP_INTERVAL 100  // ms between steps of a transmission mode
+#define ACTION_TASK_PRIORITY 1    // below input and rendering
+#define IR_BOMBARD_GAP 100000UL   // us between codes in BOMBARDMENT
+
+// Long-running transmission modes, stepped by the scheduler
+enum MenuAction : uint8_t {
+  ACTION_NONE,
+  ACTION_DIRECT_SEND,  // send the code selected in LIBRARY, again on A
+  ACTION_REPEAT_SEND,
+  ACTION_BURST_SEND,
+  ACTION_ADAPTIVE_SEND,
+  ACTION_RECEIVE,  // raw IR capture, A replays the last frame, RIGHT saves it
+  ACTION_LIBRARY,  // browse the IR library, A sends the selected code
+  ACTION_BOMBARD,  // send every library code in turn
+  ACTION_LEARN,    // capture key after key into the library
+  ACTION_LOGIC,    // GPIO logic analyzer: settings, armed, capture on view
+  ACTION_PATTERN,  // GPIO pattern generator, A plays the selected pattern
+  ACTION_SCOPE,    // ADC oscilloscope, A holds the trace
+  ACTION_GPIO_WRITE  // drive the pattern pins by hand, A flips the selected one
+};
+
+// Asks for a frame when the screen changed without input
+typedef void (*MenuRedrawHook)(void* context);
+
+// Window chrome shared by the screens, cached as display layers
+enum MenuLayer : uint8_t {
+  LAYER_MAIN_MENU,  // frame, title bar, "NEOos V.1.0", "- X", "<" and ">"
+  LAYER_SUB_MENU,   // frame, title bar and "- X"
+  LAYER_FUNCTION,   // frame, slim title bar and "- X"
+  LAYER_WINDOW      // outer frame of the action and GPIO screens
+};
+
+class MenuSystem {
+  public:
+    MenuSystem();
+    void init(DisplayManager* displayManager, ButtonHandler* buttonHandler, Scheduler* taskScheduler);
+    void update();
+    
+    // Button handlers
+    void handleSelectButton();
+    void handleBackButton();
+    void handleLeftButton();
+    void handleRightButton();
+    void handleUpButton();
+    void handleDownButton();
+    void handleBButton();  // New handler specifically for B button
+    void handleButtonEvent(const ButtonEvent& event);
+
+    // Input-to-photon latency: from the first unhandled button edge to the
+    // frame that reflects it being queued for the panel, in microseconds
+    uint32_t getInputLatency() const;
+    uint32_t getMaxInputLatency() const;
+
+    // A button has been handled since the last update(), so the screen
+    // is out of date
+    bool hasPendingInput() const;
+    // The screen changes without input: a send, capture or trace in
+    // progress, or a list still scrolling
+    bool isAnimating() const;
+    // Called when a mode's screen changes once, outside a button handler
+    void setRedrawHook(MenuRedrawHook hook, void* context);
+    
+    // Drawing methods (made public to allow direct access if needed)
+    void drawMainMenu();
+    void drawSubMenu();
+    void drawFunctionScreen();  // New function to draw the function execution screen
+    
+  private:
+    DisplayManager* display;  // Using DisplayManager
+    ButtonHandler* buttons;
+    Scheduler* scheduler;
+    
+    // Navigation path through menuRoot: menuStack[d] is the node whose
+    // children are listed at depth d, menuIndex[d] the selected child
+    const MenuNode* menuStack[MENU_MAX_DEPTH];
+    uint8_t menuIndex[MENU_MAX_DEPTH];
+    uint8_t depth;        // 0 = main menu
+    bool functionScreen;  // Flag to indicate function screen is active
+
+    bool inputPending;        // an input has not been rendered yet
+    uint32_t inputTimestamp;  // edge time of the oldest unrendered input
+    uint32_t lastInputLatency;
+    uint32_t maxInputLatency;
+    MenuRedrawHook redrawHook;
+    void* redrawContext;
+
+    ListView subMenuList;
+    const MenuNode* listedMenu;  // the one subMenuList shows
+    ListView libraryList;
+
+    int actionTaskId;
+    MenuAction activeAction;  // transmission mode in progress, if any
+    int actionCounter;        // per-mode progress shown on screen
+    IrRawFrame capturedFrame; // last frame seen in ACTION_RECEIVE
+    IrCode capturedCode;      // capturedFrame decoded, IR_PROTOCOL_RAW if no protocol fits
+    uint32_t libraryCursor;   // sorted position in the IR library
+    uint32_t bombardNext;     // sorted position of the next code to queue
+    uint8_t macroCursor;      // BURST SEND: selected line of IR_MACRO_FILE
+    int macroCount;           // macros in it, -1 if there is no file
+    char macroName[IR_MACRO_NAME + 1];  // of the selected one
+    uint8_t logicRow;         // LOGIC settings: selected row
+    uint8_t logicZoom;        // LOGIC capture view: log2 of samples per column
+    uint32_t logicScroll;     // LOGIC capture view: first sample shown
+    uint8_t patternCursor;    // PATTERN GEN: selected pattern, built-ins first
+    int patternCount;
+    bool patternForever;      // play until B instead of the pattern's loops
+    uint8_t gpioWriteCursor;  // GPIO WRITE: selected pattern channel
+    uint8_t gpioWriteDriven;  // GPIO WRITE: bit n set once channel n was written
+    uint8_t gpioWriteLevels;  // GPIO WRITE: bit n = level written to channel n
+    GpioPattern pattern;      // the selected one
+    
+    friend struct MenuTree;
+    friend class RenderBench;
+
+    // Starts a frame on a layer's chrome, drawing it if not cached
+    void beginScreen(MenuLayer layer);
+    static bool subMenuRow(uint32_t index, char* text, size_t size, void* context);
+
+    void invalidate();
+
+    const MenuNode& currentItem() const;
+    void enterMenu(const MenuNode* node);
+    void leaveMenu();
+    void moveSelection(int delta);
+
+    // Function execution
+    void executeFunctionAction();  // New method to execute function actions
+    
+    // Module action functions
+    void wifiScan();
+    void wifiConnect();
+    void wifiDeauth();
+    void wifiRickroll();
+    void wifiapSpam();
+    void wifiSelect();
+    void bleConnect();
+    void bleSpamIos();
+    void bleSpamAndroid();
+    void bleSpamWindows();
+    void bleSpamAll();
+    void infraredTvbgone();
+    void infraredReceive();
+    void infraredSpam();
+    void infraredPlayback();
+    void infraredLibrary();
+    void infraredLearn();
+    
+    // Transmission specific methods
+    void startAction(MenuAction action);
+    void stopAction();
+    uint32_t stepAction();
+    static uint32_t actionTask(void* context);
+    void drawActionScreen();
+    void pollCapture();
+    void replayCapture();
+    void saveCapture();
+    bool queueLibraryCode(uint32_t position, uint32_t gapUs, IrTxCallback callback);
+    void sendLibraryCode();
+    void stepBombard();
+    void selectMacro();
+    void playMacro();
+    static void onReplayDone(uint32_t tag, IrTxEvent event, void* context);
+    static void onBombardSent(uint32_t tag, IrTxEvent event, void* context);
+    static void onDirectSent(uint32_t tag, IrTxEvent event, void* context);
+    void drawLibraryRows();
+    void infraredDirectSend();
+    void infraredRepeatSend();
+    void infraredBurstSend();
+    void infraredAdaptiveSend();
+    
+    // New GPIO action functions
+    void gpioRead();
+    void gpioWrite();
+    void flipGpio();
+    void gpioToggle();
+    void gpioMonitor();
+    void gpioLogic();
+    void selectLogic();
+    void moveLogic(int dx, int dy);
+    void showLogicCapture();
+    void drawLogicScreen();
+    void drawLogicWaveform();
+    void gpioPattern();
+    void selectPattern();
+    void playPattern();
+    void drawPatternScreen();
+    void gpioScope();
+    void moveScope(int dx, int dy);
+    void drawScopeScreen();
+};
+
 #endif
\ No newline at end of file
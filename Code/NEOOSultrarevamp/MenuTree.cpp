@@ -0,0 +1,91 @@
+#include "MenuTree.h"
+#include "MenuSystem.h"
+
+// The tables are members of a friend of MenuSystem so the leaves can
+// point at its private action methods. Children are declared before the
+// node that lists them.
+struct MenuTree {
+  static constexpr MenuNode wifi[] = {
+    menuLeaf("ATTACKS", &MenuSystem::wifiScan),
+    menuLeaf("SCAN", &MenuSystem::wifiConnect),
+    menuLeaf("SELECT"),
+    menuLeaf("STATUS"),
+    menuBack()
+  };
+
+  static constexpr MenuNode ble[] = {
+    menuLeaf("ATTACKS", &MenuSystem::bleConnect),
+    menuLeaf("SCAN"),
+    menuLeaf("STATUS"),
+    menuLeaf("CONFIG"),
+    menuBack()
+  };
+
+  static constexpr MenuNode transmission[] = {
+    menuLeaf("DIRECT SEND", &MenuSystem::infraredDirectSend, MENU_IMMEDIATE),
+    menuLeaf("REPEAT SEND", &MenuSystem::infraredRepeatSend, MENU_IMMEDIATE),
+    menuLeaf("BURST SEND", &MenuSystem::infraredBurstSend, MENU_IMMEDIATE),
+    menuLeaf("ADAPTIVE SEND", &MenuSystem::infraredAdaptiveSend, MENU_IMMEDIATE),
+    menuBack()
+  };
+
+  static constexpr MenuNode infrared[] = {
+    menuBranch("TRANSMISSION", nullptr, transmission),
+    menuLeaf("RECIEVE", &MenuSystem::infraredReceive),
+    menuLeaf("LIBRARY", &MenuSystem::infraredLibrary, MENU_IMMEDIATE),
+    menuLeaf("BOMBARDMENT", &MenuSystem::infraredTvbgone, MENU_IMMEDIATE),
+    menuLeaf("LEARN REMOTE", &MenuSystem::infraredLearn, MENU_IMMEDIATE),
+    menuBack()
+  };
+
+  static constexpr MenuNode neokin[] = {
+    menuLeaf("STATUS"),
+    menuLeaf("VITALS"),
+    menuLeaf("LEVEL"),
+    menuLeaf("PLAY"),
+    menuBack()
+  };
+
+  static constexpr MenuNode gpio[] = {
+    menuLeaf("READ", &MenuSystem::gpioRead),
+    menuLeaf("WRITE", &MenuSystem::gpioWrite, MENU_IMMEDIATE),
+    menuLeaf("TOGGLE", &MenuSystem::gpioToggle),
+    menuLeaf("MONITOR", &MenuSystem::gpioMonitor),
+    menuLeaf("LOGIC ANALYZER", &MenuSystem::gpioLogic, MENU_IMMEDIATE),
+    menuLeaf("PATTERN GEN", &MenuSystem::gpioPattern, MENU_IMMEDIATE),
+    menuLeaf("SCOPE", &MenuSystem::gpioScope, MENU_IMMEDIATE),
+    menuBack()
+  };
+
+  static constexpr MenuNode settings[] = {
+    menuLeaf("GENERAL"),
+    menuLeaf("APPEARANCE"),
+    menuLeaf("DISPLAY"),
+    menuLeaf("OTHER"),
+    menuBack()
+  };
+
+  // Main menu, icons are ASCII art placeholders
+  static constexpr MenuNode mainMenu[] = {
+    menuBranch("WIFI", "-}", wifi),
+    menuBranch("BLE", "{}", ble),
+    menuBranch("INFRARED", "} ~", infrared),
+    menuBranch("NEOKIN", "^.^", neokin),
+    menuBranch("GPIO", "<>", gpio),
+    menuBranch("SETTINGS", "#", settings)
+  };
+
+  static constexpr MenuNode root = menuBranch("NEOos", nullptr, mainMenu);
+};
+
+constexpr MenuNode MenuTree::wifi[];
+constexpr MenuNode MenuTree::ble[];
+constexpr MenuNode MenuTree::transmission[];
+constexpr MenuNode MenuTree::infrared[];
+constexpr MenuNode MenuTree::neokin[];
+constexpr MenuNode MenuTree::gpio[];
+constexpr MenuNode MenuTree::settings[];
+constexpr MenuNode MenuTree::mainMenu[];
+constexpr MenuNode MenuTree::root;
+
+const MenuNode menuRoot = MenuTree::root;
\ No newline at end of file
@@ -0,0 +1,46 @@
+#ifndef MENU_TREE_H
+#define MENU_TREE_H
+
+#include <Arduino.h>
+
+class MenuSystem;
+
+// Called when a leaf is executed
+typedef void (MenuSystem::*MenuHandler)();
+
+// Node flags
+#define MENU_BACK 0x01       // selecting the node returns to the parent menu
+#define MENU_IMMEDIATE 0x02  // run the action on select, no function screen
+
+#define MENU_MAX_DEPTH 4
+
+// One entry of the menu hierarchy. The whole tree is constexpr data, so it
+// is laid out at compile time and lives in flash rather than RAM.
+struct MenuNode {
+  const char* label;
+  const char* icon;
+  const MenuNode* children;
+  uint8_t childCount;
+  MenuHandler action;
+  uint8_t flags;
+};
+
+// A node that opens a list of children
+template <uint8_t N>
+constexpr MenuNode menuBranch(const char* label, const char* icon, const MenuNode (&children)[N]) {
+  return MenuNode{label, icon, children, N, nullptr, 0};
+}
+
+// A node that runs an action (or nothing yet) when executed
+constexpr MenuNode menuLeaf(const char* label, MenuHandler action = nullptr, uint8_t flags = 0) {
+  return MenuNode{label, nullptr, nullptr, 0, action, flags};
+}
+
+constexpr MenuNode menuBack() {
+  return MenuNode{"BACK", nullptr, nullptr, 0, nullptr, MENU_BACK};
+}
+
+// Root of the NEOos menu, defined in MenuTree.cpp
+extern const MenuNode menuRoot;
+
+#endif
\ No newline at end of file
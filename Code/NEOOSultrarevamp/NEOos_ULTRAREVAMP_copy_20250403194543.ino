@@ -3,6 +3,23 @@
 #include "Display.h"
 #include "MenuSystem.h"
 #include "ButtonHandler.h"
+#include "Scheduler.h"
+#include "FramePacer.h"
+#include "RenderBench.h"
+#include "Profiler.h"
+#include "Log.h"
+#include "IrTxQueue.h"
+#include "IrLibrary.h"
+#include "LogicAnalyzer.h"
+
+// Task periods and priorities (higher runs first when both are due);
+// frames are paced by FramePacer
+#define INPUT_PERIOD 5     // ms
+#define INPUT_PRIORITY 3
+#define RENDER_PRIORITY 2
+
+// Uncomment to print the render benchmark over Serial at boot
+// #define RENDER_BENCH
 
 // Initialize display
 DisplayManager display;
@@ -13,6 +30,61 @@ MenuSystem menuSystem;
 // Initialize button handler
 ButtonHandler buttonHandler;
 
+// Initialize cooperative scheduler
+Scheduler scheduler;
+
+// Renders only when the screen changes
+FramePacer framePacer;
+
+uint32_t inputTask(void* context) {
+  PROFILE_SCOPE(SPAN_INPUT);
+
+  // Check button inputs
+  buttonHandler.checkButtons(&menuSystem);
+  if (menuSystem.hasPendingInput()) {
+    framePacer.invalidate();
+  }
+
+  // Send 'P' over Serial to get the recorded spans, 'L' for the last
+  // logic analyzer capture as VCD
+  while (Serial.available() > 0) {
+    int command = Serial.read();
+#if PROFILER_ENABLED
+    if (command == PROFILER_DUMP_COMMAND) {
+      profiler.dump(Serial);
+    }
+#endif
+    if (command == LOGIC_DUMP_COMMAND) {
+      logicAnalyzer.exportVcd(Serial);
+    }
+  }
+  return INPUT_PERIOD;
+}
+
+// Log frames go out only while the scheduler has nothing due
+void drainLog() {
+  logger.drain(Serial);
+}
+
+// BUTTON_B is wired to GPIO6, which is also the panel's SDA: ignore it
+// while a flush is clocking data out, or redraws would read as presses
+void maskSharedButton(bool busy, void* context) {
+  buttonHandler.maskPin(ButtonHandler::BUTTON_B, busy);
+}
+
+// A mode's screen changed without a button press
+void redrawMenu(void* context) {
+  framePacer.invalidate();
+}
+
+bool renderFrame(void* context) {
+  PROFILE_SCOPE(SPAN_RENDER);
+
+  // Update menu display
+  menuSystem.update();
+  return menuSystem.isAnimating();
+}
+
 void setup() {
   Serial.begin(115200);
   
@@ -24,20 +96,38 @@ void setup() {
   Wire.setClock(100000);
   
   // Initialize components
+#if PROFILER_ENABLED
+  profiler.init();
+#endif
   display.init();
+
+#if defined(RENDER_BENCH)
+  // One block per draw path, u8g2 first
+  RenderBench bench(&display);
+  display.setBlitter(false);
+  bench.run(Serial, RENDER_BENCH_DEVICE_ITERATIONS);
+  display.setBlitter(true);
+  bench.run(Serial, RENDER_BENCH_DEVICE_ITERATIONS);
+#endif
+
   buttonHandler.init();
-  menuSystem.init(&display, &buttonHandler);
+  display.setBusHook(maskSharedButton, nullptr);
+  irTxQueue.begin(&scheduler);
+  if (!irLibrary.begin()) {
+    LOG_WARN(LOG_MSG_IR_LIBRARY_UNAVAILABLE);
+  }
+  menuSystem.init(&display, &buttonHandler, &scheduler);
+
+  scheduler.addTask("input", inputTask, nullptr, INPUT_PRIORITY);
+  framePacer.begin(&scheduler, renderFrame, nullptr, RENDER_PRIORITY);
+  menuSystem.setRedrawHook(redrawMenu, nullptr);
+  scheduler.setIdleHook(drainLog);
   
   // Show main menu initially
   menuSystem.drawMainMenu();
 }
 
 void loop() {
-  // Check button inputs
-  buttonHandler.checkButtons(&menuSystem);
-  
-  // Update menu display
-  menuSystem.update();
-  
-  delay(25);  // Standard delay for reasonable performance
-}
\ No newline at end of file
+  // Run whatever is due, then sleep until the next deadline
+  scheduler.run();
+}
@@ -0,0 +1,344 @@
+#include "PatternGenerator.h"
+#include "Log.h"
+#include <LittleFS.h>
+
+#if !defined(ARDUINO)
+#include "HostHal.h"
+#endif
+
+// The step clock: a 1 MHz hardware timer with a one-shot alarm on the
+// ESP32, the virtual clock and its timer alarm on the host, and micros()
+// polled from the scheduler elsewhere. On the ESP32 the output register
+// is read, masked and written back under a spinlock, so a write from a
+// task and one from the interrupt can't undo each other.
+#if defined(ARDUINO_ARCH_ESP32)
+#include "soc/gpio_reg.h"
+static portMUX_TYPE portMux = portMUX_INITIALIZER_UNLOCKED;
+static hw_timer_t* patternTimer = nullptr;
+#define PATTERN_RAM_ATTR IRAM_ATTR
+
+static void IRAM_ATTR onTimer() {
+  patternGenerator.tick();
+}
+
+static inline void PATTERN_RAM_ATTR writePort(uint32_t mask, uint32_t levels) {
+  portENTER_CRITICAL_SAFE(&portMux);
+  REG_WRITE(GPIO_OUT_REG, (REG_READ(GPIO_OUT_REG) & ~mask) | levels);
+  portEXIT_CRITICAL_SAFE(&portMux);
+}
+
+static inline uint64_t PATTERN_RAM_ATTR timerNow() {
+  return timerRead(patternTimer);
+}
+
+static inline void PATTERN_RAM_ATTR setAlarm(uint64_t at) {
+  timerAlarm(patternTimer, at, false, 0);
+}
+#else
+#define PATTERN_RAM_ATTR
+
+#if defined(ARDUINO)
+static void writePort(uint32_t mask, uint32_t levels) {
+  for (uint8_t pin = 0; pin < 32; pin++) {
+    if (mask & (1UL << pin)) {
+      digitalWrite(pin, (levels >> pin) & 1 ? HIGH : LOW);
+    }
+  }
+}
+
+// micros() widened so due times don't wrap
+static uint64_t timerNow() {
+  static uint32_t last = 0;
+  static uint64_t high = 0;
+  uint32_t now = micros();
+  if (now < last) {
+    high += 1ULL << 32;
+  }
+  last = now;
+  return high | now;
+}
+
+static void setAlarm(uint64_t) {
+  // poll() finds the step due
+}
+#else
+static void onTimer() {
+  patternGenerator.tick();
+}
+
+static void writePort(uint32_t mask, uint32_t levels) {
+  hostHal.writePort(mask, levels);
+}
+
+static uint64_t timerNow() {
+  return hostHal.now();
+}
+
+static void setAlarm(uint64_t at) {
+  hostHal.setTimerAlarm(at, onTimer);
+}
+#endif
+#endif
+
+PatternGenerator patternGenerator;
+
+static const uint8_t patternPins[PATTERN_CHANNELS] = PATTERN_PINS;
+
+// Built-in waveforms, in the pattern file syntax
+static const char* const builtinPatterns[] = {
+  "SQUARE 1KHZ: 111/500 000/500",
+  "PWM 25%: 111/250 000/750",
+  "QUADRATURE: 000/250 100/250 110/250 010/250",
+  "WALK: 100/100 010/100 001/100",
+  "COUNTER: 000/100 100/100 010/100 110/100 001/100 101/100 011/100 111/100"
+};
+
+#define BUILTIN_PATTERN_COUNT (sizeof(builtinPatterns) / sizeof(builtinPatterns[0]))
+
+// One LEVELS/us token
+static bool parseStep(const char* token, size_t length, PatternStep& step) {
+  if (length < PATTERN_CHANNELS + 2 || token[PATTERN_CHANNELS] != '/') {
+    return false;
+  }
+  step.levels = 0;
+  for (uint8_t c = 0; c < PATTERN_CHANNELS; c++) {
+    if (token[c] == '1') {
+      step.levels |= 1U << c;
+    } else if (token[c] != '0') {
+      return false;
+    }
+  }
+  step.us = 0;
+  for (size_t i = PATTERN_CHANNELS + 1; i < length; i++) {
+    if (token[i] < '0' || token[i] > '9') {
+      return false;
+    }
+    step.us = step.us * 10 + (token[i] - '0');
+  }
+  return true;
+}
+
+bool gpioPatternParse(const char* line, GpioPattern& pattern) {
+  const char* colon = strchr(line, ':');
+  if (colon == nullptr) {
+    return false;
+  }
+  while (*line == ' ' || *line == '\t') {
+    line++;
+  }
+  const char* end = colon;
+  pattern.loops = 1;
+  const char* star = (const char*)memchr(line, '*', colon - line);
+  if (star != nullptr) {
+    pattern.loops = min<unsigned long>(strtoul(star + 1, nullptr, 10), 0xFFFF);
+    end = star;
+  }
+  size_t nameLength = min<size_t>(end - line, PATTERN_NAME);
+  while (nameLength > 0 && (line[nameLength - 1] == ' ' || line[nameLength - 1] == '\t')) {
+    nameLength--;
+  }
+  memcpy(pattern.name, line, nameLength);
+  pattern.name[nameLength] = '\0';
+
+  pattern.stepCount = 0;
+  const char* cursor = colon + 1;
+  while (*cursor != '\0' && *cursor != '#') {
+    if (*cursor == ' ' || *cursor == '\t' || *cursor == '\r' || *cursor == '\n') {
+      cursor++;
+      continue;
+    }
+    size_t length = strcspn(cursor, " \t\r\n#");
+    if (pattern.stepCount == PATTERN_MAX_STEPS || !parseStep(cursor, length, pattern.steps[pattern.stepCount])) {
+      return false;
+    }
+    pattern.stepCount++;
+    cursor += length;
+  }
+  return pattern.stepCount > 0;
+}
+
+int gpioPatternLoad(const char* path, uint8_t index, GpioPattern* pattern) {
+  if (pattern != nullptr && index < BUILTIN_PATTERN_COUNT) {
+    gpioPatternParse(builtinPatterns[index], *pattern);
+  }
+  int count = BUILTIN_PATTERN_COUNT;
+  File file = LittleFS.open(path, "r");
+  if (!file) {
+    return count;
+  }
+  GpioPattern scratch;
+  char line[PATTERN_LINE];
+  size_t length = 0;
+  bool more = true;
+  while (more) {
+    uint8_t c;
+    more = file.read(&c, 1) == 1;
+    if (more && c != '\n') {
+      if (length < sizeof(line) - 1) {
+        line[length++] = c;
+      }
+      continue;
+    }
+    line[length] = '\0';
+    length = 0;
+    char* hash = strchr(line, '#');
+    if (hash != nullptr) {
+      *hash = '\0';
+    }
+    GpioPattern& target = (pattern != nullptr && count == index) ? *pattern : scratch;
+    if (gpioPatternParse(line, target)) {
+      count++;
+    }
+  }
+  file.close();
+  return count;
+}
+
+void gpioWritePort(uint32_t mask, uint32_t levels) {
+  writePort(mask, levels & mask);
+}
+
+PatternGenerator::PatternGenerator()
+  : mask(0), stepCount(0), loops(1), running(false), step(0), loopsDone(0), stepsDone(0), late(0), due(0) {
+  name[0] = '\0';
+}
+
+bool PatternGenerator::start(const GpioPattern& pattern, uint16_t count) {
+  stop();
+  if (pattern.stepCount == 0) {
+    return false;
+  }
+  mask = 0;
+  for (uint8_t c = 0; c < PATTERN_CHANNELS; c++) {
+    mask |= 1UL << patternPins[c];
+  }
+  for (uint8_t i = 0; i < pattern.stepCount; i++) {
+    if (pattern.steps[i].us < PATTERN_MIN_STEP) {
+      return false;
+    }
+    ports[i] = 0;
+    for (uint8_t c = 0; c < PATTERN_CHANNELS; c++) {
+      if (pattern.steps[i].levels & (1U << c)) {
+        ports[i] |= 1UL << patternPins[c];
+      }
+    }
+    durations[i] = pattern.steps[i].us;
+  }
+  stepCount = pattern.stepCount;
+  loops = count;
+  strcpy(name, pattern.name);
+  for (uint8_t c = 0; c < PATTERN_CHANNELS; c++) {
+    pinMode(patternPins[c], OUTPUT);
+  }
+  LOG_INFO(LOG_MSG_PATTERN_START, name, (unsigned)stepCount, (unsigned)loops);
+
+#if defined(ARDUINO_ARCH_ESP32)
+  if (patternTimer == nullptr) {
+    patternTimer = timerBegin(1000000);
+    if (patternTimer == nullptr) {
+      return false;
+    }
+    timerAttachInterrupt(patternTimer, onTimer);
+  }
+  // From 0 with the timer held, so the first steps go out back to back
+  timerStop(patternTimer);
+  timerWrite(patternTimer, 0);
+#endif
+  step = 0;
+  loopsDone = 0;
+  stepsDone = 0;
+  late = 0;
+  running = true;
+  due = timerNow();
+  tick();
+#if defined(ARDUINO_ARCH_ESP32)
+  timerStart(patternTimer);
+#endif
+  return true;
+}
+
+void PatternGenerator::stop() {
+#if defined(ARDUINO_ARCH_ESP32)
+  if (patternTimer != nullptr) {
+    timerStop(patternTimer);
+  }
+#elif !defined(ARDUINO)
+  hostHal.setTimerAlarm(0, nullptr);
+#endif
+  if (running) {
+    running = false;
+    step = 0;  // poll() has no end to report
+    LOG_INFO(LOG_MSG_PATTERN_END, name, (unsigned)stepsDone, (unsigned)late);
+  }
+}
+
+bool PatternGenerator::isRunning() const {
+  return running;
+}
+
+uint32_t PatternGenerator::poll() {
+#if defined(ARDUINO) && !defined(ARDUINO_ARCH_ESP32)
+  if (running && (int64_t)(due - timerNow()) <= 0) {
+    tick();
+  }
+  if (running) {
+    return PATTERN_POLL_INTERVAL;
+  }
+#endif
+  if (!running && stepCount > 0 && step == stepCount) {
+    // Ran out on its own
+    LOG_INFO(LOG_MSG_PATTERN_END, name, (unsigned)stepsDone, (unsigned)late);
+    step = 0;
+  }
+  return PATTERN_REPORT_INTERVAL;
+}
+
+// Writes the step that is due, and any after it that are due already,
+// then sets the alarm for the next. The write comes first so the edge is
+// a fixed interrupt latency after the alarm.
+void PATTERN_RAM_ATTR PatternGenerator::tick() {
+  while (running) {
+    if (step == stepCount) {
+      running = false;  // the last step has had its time
+      return;
+    }
+    writePort(mask, ports[step]);
+    due += durations[step];
+    stepsDone++;
+    if (++step == stepCount) {
+      loopsDone++;
+      if (loops == PATTERN_FOREVER || loopsDone < loops) {
+        step = 0;
+      }
+    }
+    if ((int64_t)(due - timerNow()) > 0) {
+      setAlarm(due);
+      return;
+    }
+    late++;
+  }
+}
+
+const char* PatternGenerator::getName() const {
+  return name;
+}
+
+uint16_t PatternGenerator::getLoops() const {
+  return loops;
+}
+
+uint32_t PatternGenerator::getLoopsDone() const {
+  return loopsDone;
+}
+
+uint32_t PatternGenerator::getStepsDone() const {
+  return stepsDone;
+}
+
+uint32_t PatternGenerator::getLateSteps() const {
+  return late;
+}
+
+uint8_t PatternGenerator::getPin(uint8_t channel) {
+  return patternPins[channel];
+}
\ No newline at end of file
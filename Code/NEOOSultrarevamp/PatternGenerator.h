@@ -0,0 +1,98 @@
+#ifndef PATTERN_GENERATOR_H
+#define PATTERN_GENERATOR_H
+
+#include <Arduino.h>
+
+// Pins driven, in channel order: XIAO D7, D6 and D9, the header pins no
+// button, the panel or IR use. D6/D7 are UART0, free while Serial is the
+// USB CDC port. All below 32, so one write of the output register sets
+// every channel at once.
+#define PATTERN_CHANNELS 3
+#define PATTERN_PINS {20, 21, 9}
+
+#define PATTERN_FILE "/gpio/patterns.txt"
+#define PATTERN_MAX_STEPS 64
+#define PATTERN_NAME 15          // characters kept of a pattern's name
+#define PATTERN_LINE 512         // longest line read from a pattern file
+#define PATTERN_MIN_STEP 20      // us; shorter steps would outrun the timer interrupt
+#define PATTERN_FOREVER 0        // GpioPattern::loops: until stop()
+#define PATTERN_POLL_INTERVAL 1  // ms between polls where there is no hardware timer
+#define PATTERN_REPORT_INTERVAL 100  // ms between polls that only look for the end
+
+// Channel levels, bit n = channel n, held for us
+struct PatternStep {
+  uint8_t levels;
+  uint32_t us;
+};
+
+struct GpioPattern {
+  char name[PATTERN_NAME + 1];
+  uint16_t loops;  // times through the steps, PATTERN_FOREVER = until stop()
+  uint8_t stepCount;
+  PatternStep steps[PATTERN_MAX_STEPS];
+};
+
+// One pattern per line, # comments:
+//   NAME[*loops]: LEVELS/us ...
+// LEVELS has a 0 or 1 per channel, channel 0 first, e.g. a 1 kHz clock
+// on channel 0 with channel 1 as its inverse: "CLK*100: 100/500 010/500".
+// Without *loops a pattern plays once.
+bool gpioPatternParse(const char* line, GpioPattern& pattern);
+
+// Pattern number index into pattern (if not null): the built-in
+// waveforms first, then the lines of path. Returns how many patterns
+// there are in all.
+int gpioPatternLoad(const char* path, uint8_t index, GpioPattern* pattern);
+
+// Sets the pins in mask (bit n = GPIOn) to their bit of levels, all with
+// one register write on the ESP32
+void gpioWritePort(uint32_t mask, uint32_t levels);
+
+// Plays patterns on the output pins. Each step is compiled to an output
+// register value and a duration up front; a one-shot hardware timer
+// alarm at the step's absolute due time writes the register and sets
+// the alarm for the next, so steps are timed by the timer's 1 us clock
+// and never drift, whatever the scheduler or the UI is doing. Steps the
+// interrupt comes too late for are written at once and counted.
+class PatternGenerator {
+  public:
+    PatternGenerator();
+
+    // Plays pattern from the top, loops times (PATTERN_FOREVER until
+    // stop()); false if it has no steps or one is under PATTERN_MIN_STEP
+    bool start(const GpioPattern& pattern, uint16_t loops);
+    // The outputs keep the levels of the step playing
+    void stop();
+    bool isRunning() const;
+    // Runs due steps on boards without a hardware timer and logs the end
+    // of a pattern; returns ms until it wants to run again
+    uint32_t poll();
+
+    const char* getName() const;
+    uint16_t getLoops() const;
+    uint32_t getLoopsDone() const;
+    uint32_t getStepsDone() const;
+    uint32_t getLateSteps() const;  // written after the next was already due
+    static uint8_t getPin(uint8_t channel);
+
+    void tick();  // the timer interrupt
+
+  private:
+    uint32_t ports[PATTERN_MAX_STEPS];      // output register per step
+    uint32_t durations[PATTERN_MAX_STEPS];  // us
+    uint32_t mask;                          // output register bits of the channels
+    uint8_t stepCount;
+    uint16_t loops;
+    char name[PATTERN_NAME + 1];
+
+    volatile bool running;
+    volatile uint8_t step;  // next to write; stepCount once the last is playing
+    volatile uint32_t loopsDone;
+    volatile uint32_t stepsDone;
+    volatile uint32_t late;
+    uint64_t due;           // timer us the next step is due at
+};
+
+extern PatternGenerator patternGenerator;
+
+#endif
\ No newline at end of file
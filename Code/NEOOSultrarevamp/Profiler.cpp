@@ -0,0 +1,130 @@
+#include "Profiler.h"
+
+#if PROFILER_ENABLED
+
+#if !defined(ARDUINO)
+#include <chrono>
+#endif
+
+Profiler profiler;
+
+static const char* const spanNames[SPAN_COUNT] = {
+  "input",
+  "render",
+  "flush",
+  "action",
+  "idle"
+};
+
+Profiler::Profiler() : head(0), paused(false) {
+#if defined(ARDUINO_ARCH_ESP32)
+  loopTask = nullptr;
+#endif
+}
+
+void Profiler::init() {
+#if defined(ARDUINO_ARCH_ESP32)
+  loopTask = xTaskGetCurrentTaskHandle();
+#endif
+  clear();
+}
+
+uint32_t Profiler::ticks() {
+#if defined(ARDUINO_ARCH_ESP32)
+  return ESP.getCycleCount();
+#elif defined(ARDUINO)
+  return micros();
+#else
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+uint32_t Profiler::tickRate() {
+#if defined(ARDUINO_ARCH_ESP32)
+  return getCpuFrequencyMhz() * 1000000UL;
+#elif defined(ARDUINO)
+  return 1000000UL;
+#else
+  return 1000000000UL;
+#endif
+}
+
+const char* Profiler::spanName(uint8_t span) {
+  return span < SPAN_COUNT ? spanNames[span] : "?";
+}
+
+void Profiler::record(uint8_t tag) {
+  if (paused) {
+    return;
+  }
+#if defined(ARDUINO_ARCH_ESP32)
+  if (xTaskGetCurrentTaskHandle() != loopTask) {
+    tag |= PROFILER_TAG_TASK;
+  }
+#endif
+  uint32_t slot = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED) & (PROFILER_RING_SIZE - 1);
+  stamps[slot] = ticks();
+  tags[slot] = tag;
+}
+
+void Profiler::clear() {
+  __atomic_store_n(&head, 0, __ATOMIC_RELAXED);
+}
+
+static void putU16(uint8_t* out, uint16_t value) {
+  out[0] = value;
+  out[1] = value >> 8;
+}
+
+static void putU32(uint8_t* out, uint32_t value) {
+  out[0] = value;
+  out[1] = value >> 8;
+  out[2] = value >> 16;
+  out[3] = value >> 24;
+}
+
+void Profiler::dump(Print& out) {
+  paused = true;
+
+  uint32_t written = __atomic_load_n(&head, __ATOMIC_RELAXED);
+  uint16_t count = min<uint32_t>(written, PROFILER_RING_SIZE);
+  uint32_t first = written - count;
+
+  uint8_t header[PROFILER_HEADER_SIZE];
+  memcpy(header, PROFILER_MAGIC, 4);
+  header[4] = PROFILER_VERSION;
+  header[5] = SPAN_COUNT;
+  putU16(header + 6, count);
+  putU32(header + 8, tickRate());
+  putU32(header + 12, first);
+  out.write(header, sizeof(header));
+
+  for (uint8_t i = 0; i < SPAN_COUNT; i++) {
+    uint8_t length = strlen(spanNames[i]);
+    out.write(&length, 1);
+    out.write(reinterpret_cast<const uint8_t*>(spanNames[i]), length);
+  }
+
+  // Batched so the UART driver gets a few large writes
+  uint8_t chunk[PROFILER_RECORD_SIZE * 32];
+  size_t used = 0;
+  for (uint32_t i = first; i < written; i++) {
+    uint32_t slot = i & (PROFILER_RING_SIZE - 1);
+    putU32(chunk + used, stamps[slot]);
+    chunk[used + 4] = tags[slot];
+    used += PROFILER_RECORD_SIZE;
+    if (used == sizeof(chunk)) {
+      out.write(chunk, used);
+      used = 0;
+    }
+  }
+  if (used > 0) {
+    out.write(chunk, used);
+  }
+
+  clear();
+  paused = false;
+}
+
+#endif
\ No newline at end of file
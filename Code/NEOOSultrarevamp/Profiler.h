@@ -0,0 +1,96 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+
+// Build with -DPROFILER_ENABLED=0 to compile the spans out entirely
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+#define PROFILER_RING_SIZE 1024    // records kept, power of two
+#define PROFILER_DUMP_COMMAND 'P'  // Serial byte that requests a dump
+
+// Dump stream, little-endian:
+//   "NPRF" u8 version, u8 spanCount, u16 recordCount, u32 tickRate (Hz),
+//   u32 overwritten records
+//   spanCount x { u8 length, name bytes }
+//   recordCount x { u32 ticks, u8 tag }, oldest first
+#define PROFILER_MAGIC "NPRF"
+#define PROFILER_VERSION 1
+#define PROFILER_HEADER_SIZE 16
+#define PROFILER_RECORD_SIZE 5
+
+// Record tag layout
+#define PROFILER_TAG_END 0x80   // span ends here (else begins)
+#define PROFILER_TAG_TASK 0x40  // recorded outside the loop task
+#define PROFILER_TAG_SPAN 0x3F
+
+// Instrumented hot paths
+enum ProfileSpan : uint8_t {
+  SPAN_INPUT,   // button polling and event dispatch
+  SPAN_RENDER,  // menu redraw, including sendBuffer()
+  SPAN_FLUSH,   // tiles clocked out to the panel
+  SPAN_ACTION,  // one step of a transmission mode
+  SPAN_IDLE,    // scheduler sleeping until the next deadline
+  SPAN_COUNT
+};
+
+// Begin/end records stamped with the CPU cycle counter, kept in a RAM
+// ring that overwrites the oldest entries. Recording is a counter read,
+// an atomic increment and two stores, so it is safe from any task.
+class Profiler {
+  public:
+    Profiler();
+    void init();  // call from the loop task; others get PROFILER_TAG_TASK
+
+    void begin(ProfileSpan span) { record(span); }
+    void end(ProfileSpan span) { record(span | PROFILER_TAG_END); }
+
+    // Write the ring as a binary stream and start over
+    void dump(Print& out);
+    void clear();
+
+    static uint32_t ticks();
+    static uint32_t tickRate();
+    static const char* spanName(uint8_t span);
+
+  private:
+    uint32_t stamps[PROFILER_RING_SIZE];
+    uint8_t tags[PROFILER_RING_SIZE];
+    uint32_t head;  // total records written; slot is head % size
+    volatile bool paused;
+
+#if defined(ARDUINO_ARCH_ESP32)
+    TaskHandle_t loopTask;
+#endif
+
+    void record(uint8_t tag);
+};
+
+extern Profiler profiler;
+
+// Ends the span when it goes out of scope
+class ProfileScope {
+  public:
+    ProfileScope(ProfileSpan span) : span(span) { profiler.begin(span); }
+    ~ProfileScope() { profiler.end(span); }
+
+  private:
+    ProfileSpan span;
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+
+#if PROFILER_ENABLED
+#define PROFILE_BEGIN(span) profiler.begin(span)
+#define PROFILE_END(span) profiler.end(span)
+#define PROFILE_SCOPE(span) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(span)
+#else
+#define PROFILE_BEGIN(span) do {} while (0)
+#define PROFILE_END(span) do {} while (0)
+#define PROFILE_SCOPE(span) do {} while (0)
+#endif
+
+#endif
\ No newline at end of file
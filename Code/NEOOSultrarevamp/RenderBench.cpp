@@ -0,0 +1,232 @@
+#include "RenderBench.h"
+
+#if !defined(ARDUINO)
+#include <chrono>
+#endif
+
+// Free-running counter in RENDER_BENCH_UNIT; only differences are used
+static inline uint32_t benchTicks() {
+#if defined(ARDUINO_ARCH_ESP32)
+  return ESP.getCycleCount();
+#elif defined(ARDUINO)
+  return micros();
+#else
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+static uint32_t countPixels(const uint8_t* frame) {
+  uint32_t count = 0;
+  for (int i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
+    count += __builtin_popcount(frame[i]);
+  }
+  return count;
+}
+
+static uint32_t countChanged(const uint8_t* before, const uint8_t* after) {
+  uint32_t count = 0;
+  for (int i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
+    count += __builtin_popcount(before[i] ^ after[i]);
+  }
+  return count;
+}
+
+// Static screens measure the steady state (mostly skipped flushes), the
+// cycling ones a selection change every frame
+const RenderBenchCase RenderBench::cases[] = {
+  {"main_menu", &RenderBench::prepareMainMenu, &RenderBench::frameMainMenu},
+  {"main_menu_cycle", &RenderBench::prepareMainMenu, &RenderBench::frameMainMenuCycle},
+  {"sub_menu", &RenderBench::prepareInfrared, &RenderBench::frameSubMenu},
+  {"sub_menu_scroll", &RenderBench::prepareInfrared, &RenderBench::frameSubMenuScroll},
+  {"transmission_menu", &RenderBench::prepareTransmission, &RenderBench::frameSubMenu},
+  {"transmission_scroll", &RenderBench::prepareTransmission, &RenderBench::frameSubMenuScroll},
+  {"function_screen", &RenderBench::prepareFunctionScreen, &RenderBench::frameFunctionScreen},
+  {"action_screen", &RenderBench::prepareActionScreen, &RenderBench::frameActionScreen},
+  {"set_font_pair", &RenderBench::prepareNothing, &RenderBench::frameSetFont}
+};
+
+RenderBench::RenderBench(DisplayManager* displayManager) : display(displayManager) {
+  resetMenu();
+}
+
+uint8_t RenderBench::getCaseCount() {
+  return sizeof(cases) / sizeof(cases[0]);
+}
+
+void RenderBench::run(Print& out, uint32_t iterations) {
+  char line[200];
+  snprintf(line, sizeof(line), "# render-bench v1 unit=%s iterations=%lu path=%s",
+           RENDER_BENCH_UNIT, (unsigned long)iterations, display->isBlitterEnabled() ? "blit" : "u8g2");
+  out.println(line);
+
+  for (uint8_t i = 0; i < getCaseCount(); i++) {
+    RenderBenchResult result;
+    if (!runCase(i, iterations, result)) {
+      continue;
+    }
+    snprintf(line, sizeof(line),
+             "bench=%s iterations=%lu time_per_frame=%lu unit=%s pixels_lit=%lu "
+             "pixels_changed=%lu bytes_first=%lu bytes_per_frame=%lu",
+             result.name, (unsigned long)result.iterations, (unsigned long)result.timePerFrame,
+             RENDER_BENCH_UNIT, (unsigned long)result.pixelsLit, (unsigned long)result.pixelsChanged,
+             (unsigned long)result.firstFrameBytes, (unsigned long)result.bytesPerFrame);
+    out.println(line);
+  }
+  out.println("# end");
+}
+
+bool RenderBench::runCase(uint8_t index, uint32_t iterations, RenderBenchResult& result) {
+  if (index >= getCaseCount() || iterations == 0) {
+    return false;
+  }
+  const RenderBenchCase& benchCase = cases[index];
+
+  resetMenu();
+  (this->*benchCase.prepare)();
+
+  // Untimed warm-up so caches and branch history settle
+  for (uint32_t i = 0; i < RENDER_BENCH_WARMUP; i++) {
+    (this->*benchCase.frame)(i);
+    display->waitForFlush();
+  }
+
+  // Start every case from a blank panel so the first frame is a full draw
+  display->clearBuffer();
+  display->sendBuffer();
+  display->waitForFlush();
+  memcpy(previousFrame, display->getPanelFrame(), DISPLAY_BUFFER_SIZE);
+
+  // Frames are timed in batches and the fastest batch mean is reported,
+  // which keeps preemption and interrupts out of the figure
+  uint32_t batchSize = max<uint32_t>(iterations / RENDER_BENCH_BATCHES, 1);
+  uint64_t batchTicks = 0;
+  uint32_t batchFrames = 0;
+  uint32_t bestPerFrame = 0xFFFFFFFFUL;
+  uint64_t lit = 0;
+  uint64_t changed = 0;
+  uint64_t bytes = 0;
+  uint32_t firstBytes = 0;
+  uint32_t framesBefore = display->getStats().frames;
+
+  for (uint32_t i = 0; i < iterations; i++) {
+    uint32_t start = benchTicks();
+    (this->*benchCase.frame)(i);
+    batchTicks += (uint32_t)(benchTicks() - start);
+    if (++batchFrames == batchSize || i + 1 == iterations) {
+      bestPerFrame = min<uint32_t>(bestPerFrame, batchTicks / batchFrames);
+      batchTicks = 0;
+      batchFrames = 0;
+    }
+
+    // Bookkeeping stays outside the timed region
+    display->waitForFlush();
+    const uint8_t* frame = display->getPanelFrame();
+    lit += countPixels(frame);
+    changed += countChanged(previousFrame, frame);
+    memcpy(previousFrame, frame, DISPLAY_BUFFER_SIZE);
+
+    // Paths that don't flush leave the stats untouched
+    bool flushed = display->getStats().frames != framesBefore;
+    framesBefore = display->getStats().frames;
+    uint32_t frameBytes = flushed ? display->getStats().lastFrameBytes : 0;
+    if (i == 0) {
+      firstBytes = frameBytes;
+    } else {
+      bytes += frameBytes;
+    }
+  }
+
+  result.name = benchCase.name;
+  result.iterations = iterations;
+  result.timePerFrame = bestPerFrame;
+  result.pixelsLit = lit / iterations;
+  result.pixelsChanged = changed / iterations;
+  result.firstFrameBytes = firstBytes;
+  result.bytesPerFrame = iterations > 1 ? bytes / (iterations - 1) : 0;
+  return true;
+}
+
+// ---- Menu states ----
+
+void RenderBench::resetMenu() {
+  menu = MenuSystem();
+  menu.display = display;
+}
+
+// Descend into the child of the current list with this label
+void RenderBench::openMenu(const char* label) {
+  const MenuNode* list = menu.menuStack[menu.depth];
+  for (uint8_t i = 0; i < list->childCount; i++) {
+    if (strcmp(list->children[i].label, label) == 0) {
+      menu.menuIndex[menu.depth] = i;
+      if (list->children[i].childCount > 0) {
+        menu.enterMenu(&list->children[i]);
+      }
+      return;
+    }
+  }
+}
+
+void RenderBench::prepareMainMenu() {
+}
+
+void RenderBench::prepareInfrared() {
+  openMenu("INFRARED");
+}
+
+void RenderBench::prepareTransmission() {
+  openMenu("INFRARED");
+  openMenu("TRANSMISSION");
+}
+
+void RenderBench::prepareFunctionScreen() {
+  openMenu("INFRARED");
+  openMenu("RECIEVE");
+  menu.functionScreen = true;
+}
+
+void RenderBench::prepareActionScreen() {
+  prepareTransmission();
+  openMenu("REPEAT SEND");
+  menu.activeAction = ACTION_REPEAT_SEND;
+}
+
+void RenderBench::prepareNothing() {
+}
+
+// ---- Frames ----
+
+void RenderBench::frameMainMenu(uint32_t iteration) {
+  menu.drawMainMenu();
+}
+
+void RenderBench::frameMainMenuCycle(uint32_t iteration) {
+  menu.menuIndex[0] = iteration % menuRoot.childCount;
+  menu.drawMainMenu();
+}
+
+void RenderBench::frameSubMenu(uint32_t iteration) {
+  menu.drawSubMenu();
+}
+
+void RenderBench::frameSubMenuScroll(uint32_t iteration) {
+  menu.menuIndex[menu.depth] = iteration % menu.menuStack[menu.depth]->childCount;
+  menu.drawSubMenu();
+}
+
+void RenderBench::frameFunctionScreen(uint32_t iteration) {
+  menu.drawFunctionScreen();
+}
+
+void RenderBench::frameActionScreen(uint32_t iteration) {
+  // The repeat counter ticks every frame, as it would at full speed
+  menu.actionCounter = iteration;
+  menu.drawActionScreen();
+}
+
+// The font switch drawSubMenu does for every selected row
+void RenderBench::frameSetFont(uint32_t iteration) {
+  display->setFont(u8g2_font_4x6_tf);
+  display->setFont(u8g2_font_6x10_tf);
+}
\ No newline at end of file
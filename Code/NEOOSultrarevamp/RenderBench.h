@@ -0,0 +1,81 @@
+#ifndef RENDER_BENCH_H
+#define RENDER_BENCH_H
+
+#include <Arduino.h>
+#include "Display.h"
+#include "MenuSystem.h"
+
+#define RENDER_BENCH_HOST_ITERATIONS 5000
+#define RENDER_BENCH_DEVICE_ITERATIONS 200
+#define RENDER_BENCH_WARMUP 16  // untimed frames before each case
+#define RENDER_BENCH_BATCHES 8  // timing batches per case
+
+// Timing column: CPU cycles on the ESP32, wall-clock elsewhere
+#if defined(ARDUINO_ARCH_ESP32)
+#define RENDER_BENCH_UNIT "cycles"
+#elif defined(ARDUINO)
+#define RENDER_BENCH_UNIT "us"
+#else
+#define RENDER_BENCH_UNIT "ns"
+#endif
+
+// Averages over one case; "frame" is one call of the draw path including
+// its sendBuffer(), not the flush that follows on async transports
+struct RenderBenchResult {
+  const char* name;
+  uint32_t iterations;
+  uint32_t timePerFrame;     // RENDER_BENCH_UNIT, mean of the fastest batch
+  uint32_t pixelsLit;        // lit pixels in the frame
+  uint32_t pixelsChanged;    // pixels that differ from the previous frame
+  uint32_t firstFrameBytes;  // bytes flushed drawing onto a blank panel
+  uint32_t bytesPerFrame;    // bytes flushed by the frames after that
+};
+
+class RenderBench;
+
+struct RenderBenchCase {
+  const char* name;
+  void (RenderBench::*prepare)();
+  void (RenderBench::*frame)(uint32_t iteration);
+};
+
+// Runs the menu draw paths against a DisplayManager. run() prints one
+// line per case, fields always in this order:
+//   bench=<case> iterations=<n> time_per_frame=<t> unit=<unit>
+//   pixels_lit=<n> pixels_changed=<n> bytes_first=<n> bytes_per_frame=<n>
+// between a "# render-bench v1" header, which names the draw path, and
+// a "# end" line.
+class RenderBench {
+  public:
+    RenderBench(DisplayManager* displayManager);
+    void run(Print& out, uint32_t iterations);
+    bool runCase(uint8_t index, uint32_t iterations, RenderBenchResult& result);
+    static uint8_t getCaseCount();
+
+  private:
+    DisplayManager* display;
+    MenuSystem menu;
+    uint8_t previousFrame[DISPLAY_BUFFER_SIZE];
+
+    static const RenderBenchCase cases[];
+
+    void resetMenu();
+    void openMenu(const char* label);
+
+    void prepareMainMenu();
+    void prepareInfrared();
+    void prepareTransmission();
+    void prepareFunctionScreen();
+    void prepareActionScreen();
+    void prepareNothing();
+
+    void frameMainMenu(uint32_t iteration);
+    void frameMainMenuCycle(uint32_t iteration);
+    void frameSubMenu(uint32_t iteration);
+    void frameSubMenuScroll(uint32_t iteration);
+    void frameFunctionScreen(uint32_t iteration);
+    void frameActionScreen(uint32_t iteration);
+    void frameSetFont(uint32_t iteration);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,74 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <Arduino.h>
+
+// Fixed-size single-producer/single-consumer queue. Only the producer
+// writes head and only the consumer writes tail, so an ISR can push while
+// the main loop pops without any locking. N must be a power of two.
+template <typename T, uint16_t N>
+class RingBuffer {
+  static_assert(N > 0 && (N & (N - 1)) == 0, "RingBuffer size must be a power of two");
+
+  public:
+    RingBuffer() : head(0), tail(0) {}
+
+    // Producer side
+    bool push(const T& item) {
+      uint16_t h = __atomic_load_n(&head, __ATOMIC_RELAXED);
+      uint16_t t = __atomic_load_n(&tail, __ATOMIC_ACQUIRE);
+      if ((uint16_t)(h - t) == N) {
+        return false;
+      }
+      items[h & (N - 1)] = item;
+      __atomic_store_n(&head, (uint16_t)(h + 1), __ATOMIC_RELEASE);
+      return true;
+    }
+
+    // Consumer side
+    bool pop(T& item) {
+      uint16_t t = __atomic_load_n(&tail, __ATOMIC_RELAXED);
+      uint16_t h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+      if (h == t) {
+        return false;
+      }
+      item = items[t & (N - 1)];
+      __atomic_store_n(&tail, (uint16_t)(t + 1), __ATOMIC_RELEASE);
+      return true;
+    }
+
+    // Consumer side: look at the oldest item without removing it
+    bool peek(T& item) const {
+      uint16_t t = __atomic_load_n(&tail, __ATOMIC_RELAXED);
+      uint16_t h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+      if (h == t) {
+        return false;
+      }
+      item = items[t & (N - 1)];
+      return true;
+    }
+
+    // Consumer side: drop everything queued so far
+    void clear() {
+      __atomic_store_n(&tail, __atomic_load_n(&head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+    }
+
+    uint16_t size() const {
+      return (uint16_t)(__atomic_load_n(&head, __ATOMIC_ACQUIRE) - __atomic_load_n(&tail, __ATOMIC_ACQUIRE));
+    }
+
+    bool isEmpty() const {
+      return size() == 0;
+    }
+
+    static uint16_t capacity() {
+      return N;
+    }
+
+  private:
+    T items[N];
+    uint16_t head;
+    uint16_t tail;
+};
+
+#endif
\ No newline at end of file
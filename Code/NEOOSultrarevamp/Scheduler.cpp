@@ -0,0 +1,138 @@
+#include "Scheduler.h"
+#include "Profiler.h"
+
+Scheduler::Scheduler() : taskCount(0), idleTime(0), idleHook(nullptr) {
+  // Constructor
+}
+
+int Scheduler::addTask(const char* name, TaskFunction function, void* context,
+                       uint8_t priority, bool running) {
+  if (taskCount >= SCHEDULER_MAX_TASKS) {
+    return -1;
+  }
+
+  Task& task = tasks[taskCount];
+  task.name = name;
+  task.function = function;
+  task.context = context;
+  task.priority = priority;
+  task.running = running;
+  task.ranThisPass = false;
+  task.deadline = millis();
+  memset(&task.stats, 0, sizeof(task.stats));
+  return taskCount++;
+}
+
+void Scheduler::start(int id, uint32_t delayMs) {
+  if (id < 0 || id >= taskCount) {
+    return;
+  }
+  tasks[id].running = true;
+  tasks[id].deadline = millis() + delayMs;
+}
+
+void Scheduler::stop(int id) {
+  if (id < 0 || id >= taskCount) {
+    return;
+  }
+  tasks[id].running = false;
+}
+
+bool Scheduler::isRunning(int id) const {
+  return id >= 0 && id < taskCount && tasks[id].running;
+}
+
+// Highest-priority task that is due and has not run in this pass;
+// ties go to the earliest deadline
+int Scheduler::nextDue(uint32_t now) {
+  int best = -1;
+  for (int i = 0; i < taskCount; i++) {
+    const Task& task = tasks[i];
+    if (!task.running || task.ranThisPass || (int32_t)(now - task.deadline) < 0) {
+      continue;
+    }
+    if (best < 0 || task.priority > tasks[best].priority ||
+        (task.priority == tasks[best].priority &&
+         (int32_t)(task.deadline - tasks[best].deadline) < 0)) {
+      best = i;
+    }
+  }
+  return best;
+}
+
+uint32_t Scheduler::runDue() {
+  for (int i = 0; i < taskCount; i++) {
+    tasks[i].ranThisPass = false;
+  }
+
+  // Re-pick after every step: a step may start or stop other tasks
+  int id;
+  while ((id = nextDue(millis())) >= 0) {
+    Task& task = tasks[id];
+    uint32_t started = millis();
+
+    task.ranThisPass = true;
+    task.stats.runs++;
+    task.stats.maxLateness = max(task.stats.maxLateness, started - task.deadline);
+
+    uint32_t next = task.function(task.context);
+
+    uint32_t finished = millis();
+    task.stats.maxRunTime = max(task.stats.maxRunTime, finished - started);
+
+    // The step may have stopped or restarted itself through stop()/start()
+    if (next == TASK_STOP) {
+      task.running = false;
+    } else if (task.running && (int32_t)(task.deadline - started) <= 0) {
+      // Schedule from the old deadline so periodic tasks don't drift,
+      // unless that would leave the task behind already
+      task.deadline += next;
+      if ((int32_t)(finished - task.deadline) > 0) {
+        task.deadline = finished;
+      }
+    }
+  }
+
+  uint32_t now = millis();
+  uint32_t wait = SCHEDULER_MAX_SLEEP;
+  for (int i = 0; i < taskCount; i++) {
+    if (!tasks[i].running) {
+      continue;
+    }
+    int32_t until = (int32_t)(tasks[i].deadline - now);
+    if (until <= 0) {
+      return 0;
+    }
+    wait = min(wait, (uint32_t)until);
+  }
+  return wait;
+}
+
+void Scheduler::run() {
+  uint32_t wait = runDue();
+  if (wait > 0) {
+    if (idleHook != nullptr) {
+      idleHook();
+    }
+    // delay() yields to the RTOS idle task on ESP32, so this is real sleep
+    PROFILE_BEGIN(SPAN_IDLE);
+    delay(wait);
+    PROFILE_END(SPAN_IDLE);
+    idleTime += wait;
+  }
+}
+
+const TaskStats* Scheduler::getTaskStats(int id) const {
+  if (id < 0 || id >= taskCount) {
+    return nullptr;
+  }
+  return &tasks[id].stats;
+}
+
+uint32_t Scheduler::getIdleTime() const {
+  return idleTime;
+}
+
+void Scheduler::setIdleHook(IdleHook hook) {
+  idleHook = hook;
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+#define SCHEDULER_MAX_TASKS 8
+#define SCHEDULER_MAX_SLEEP 100  // ms, upper bound on one idle sleep
+
+// Returned by a task function to stop itself until start() is called again
+#define TASK_STOP 0xFFFFFFFFUL
+
+// A task is one step of a resumable state machine. It does a bounded
+// amount of work, keeps its progress in its context, and returns the
+// number of ms until it wants to run again (or TASK_STOP).
+typedef uint32_t (*TaskFunction)(void* context);
+
+// Called once per pass, just before the scheduler goes to sleep
+typedef void (*IdleHook)();
+
+struct TaskStats {
+  uint32_t runs;
+  uint32_t maxLateness;  // ms between a deadline and the step actually running
+  uint32_t maxRunTime;   // ms spent in the longest single step
+};
+
+// Cooperative run-to-completion scheduler driven from loop(). Due tasks run
+// highest priority first, each at most once per pass, and the loop sleeps
+// until the earliest deadline instead of a fixed delay.
+class Scheduler {
+  public:
+    Scheduler();
+
+    // Returns the task id, or -1 when the table is full
+    int addTask(const char* name, TaskFunction function, void* context,
+                uint8_t priority, bool running = true);
+    void start(int id, uint32_t delayMs = 0);
+    void stop(int id);
+    bool isRunning(int id) const;
+
+    // Run every task whose deadline has passed. Returns ms until the next
+    // deadline (SCHEDULER_MAX_SLEEP if nothing is scheduled sooner).
+    uint32_t runDue();
+
+    // One pass of runDue(), then sleep until the next deadline
+    void run();
+
+    const TaskStats* getTaskStats(int id) const;
+    uint32_t getIdleTime() const;  // total ms spent sleeping in run()
+
+    // Background work that must never delay a task, e.g. draining logs
+    void setIdleHook(IdleHook hook);
+
+  private:
+    struct Task {
+      const char* name;
+      TaskFunction function;
+      void* context;
+      uint8_t priority;
+      bool running;
+      bool ranThisPass;
+      uint32_t deadline;
+      TaskStats stats;
+    };
+
+    Task tasks[SCHEDULER_MAX_TASKS];
+    int taskCount;
+    uint32_t idleTime;
+    IdleHook idleHook;
+
+    int nextDue(uint32_t now);
+};
+
+#endif
\ No newline at end of file
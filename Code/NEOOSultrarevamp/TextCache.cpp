@@ -0,0 +1,216 @@
+#include "TextCache.h"
+#include "Blitter.h"
+
+// Page holding row y, for negative y as well
+static inline int pageOf(int y) {
+  return y >= 0 ? y / 8 : -((7 - y) / 8);
+}
+
+// FNV-1a
+static uint32_t hashText(const char* text, size_t length) {
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ (uint8_t)text[i]) * 16777619UL;
+  }
+  return hash;
+}
+
+TextCache::TextCache() : entryCount(0), clock(0) {
+  memset(&stats, 0, sizeof(stats));
+}
+
+int TextCache::draw(uint8_t* buffer, const uint8_t* font, int x, int y, const char* text) {
+  size_t length = blitStrLength(text);
+  if (length > 0xFF) {
+    stats.uncached++;
+    return blitStr(buffer, font, x, y, text);
+  }
+  uint8_t phase = y & 7;
+  uint32_t hash = hashText(text, length);
+  TextCacheEntry* entry = find(font, text, hash, length, phase);
+  if (entry != nullptr) {
+    stats.hits++;
+  } else {
+    entry = insert(font, text, hash, length, phase);
+    if (entry == nullptr) {
+      stats.uncached++;
+      return blitStr(buffer, font, x, y, text);
+    }
+    stats.misses++;
+  }
+  entry->lastUsed = ++clock;
+  blit(buffer, *entry, x, y);
+  return entry->advance;
+}
+
+void TextCache::clear() {
+  entryCount = 0;
+  stats.entries = 0;
+  stats.bytes = 0;
+}
+
+const TextCacheStats& TextCache::getStats() const {
+  return stats;
+}
+
+void TextCache::resetStats() {
+  stats.hits = 0;
+  stats.misses = 0;
+  stats.evictions = 0;
+  stats.uncached = 0;
+}
+
+// Texts that share a hash are told apart by the copy after the bitmap
+TextCacheEntry* TextCache::find(const uint8_t* font, const char* text, uint32_t hash, uint8_t length,
+                                uint8_t phase) {
+  for (uint8_t i = 0; i < entryCount; i++) {
+    TextCacheEntry& entry = entries[i];
+    if (entry.hash == hash && entry.font == font && entry.length == length && entry.phase == phase &&
+        memcmp(pool + entry.offset + entry.size - length, text, length) == 0) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+// Rasterises text as blitStr() would draw it with the baseline on row
+// phase of page 0, then stores it and the text in the pool, evicting for
+// room. Returns nullptr if the two are over TEXT_CACHE_MAX_ENTRY.
+TextCacheEntry* TextCache::insert(const uint8_t* font, const char* text, uint32_t hash, uint8_t length,
+                                  uint8_t phase) {
+  BlitGlyph glyph;
+  int pen = 0;
+  int left = 0;
+  int right = 0;
+  int top = 0;
+  int bottom = 0;
+  bool inked = false;
+  bool solid = false;
+  for (uint8_t i = 0; i < length; i++) {
+    blitDecodeGlyph(font, (uint8_t)text[i], glyph);
+    if (glyph.width > 0) {
+      int glyphLeft = pen + glyph.x;
+      int glyphTop = phase + glyph.top;
+      left = inked ? min(left, glyphLeft) : glyphLeft;
+      right = inked ? max(right, glyphLeft + glyph.width) : glyphLeft + glyph.width;
+      top = inked ? min(top, glyphTop) : glyphTop;
+      bottom = inked ? max(bottom, glyphTop + glyph.height) : glyphTop + glyph.height;
+      inked = true;
+      solid |= glyph.solid;
+    }
+    pen += glyph.advance;
+  }
+
+  int firstPage = inked ? pageOf(top) : 0;
+  int pages = inked ? pageOf(bottom - 1) - firstPage + 1 : 0;
+  int width = right - left;
+  int bitmapSize = width * pages * (solid ? 2 : 1);
+  int size = bitmapSize + length;
+  if (width > 0xFF || size > TEXT_CACHE_MAX_ENTRY) {
+    return nullptr;
+  }
+
+  // Evict the least recently drawn until the entry fits
+  while (entryCount == TEXT_CACHE_ENTRIES || stats.bytes + size > TEXT_CACHE_BYTES) {
+    uint8_t oldest = 0;
+    for (uint8_t i = 1; i < entryCount; i++) {
+      if (entries[i].lastUsed < entries[oldest].lastUsed) {
+        oldest = i;
+      }
+    }
+    evict(oldest);
+  }
+
+  TextCacheEntry& entry = entries[entryCount++];
+  entry.font = font;
+  entry.hash = hash;
+  entry.length = length;
+  entry.phase = phase;
+  entry.firstPage = firstPage;
+  entry.pages = pages;
+  entry.left = left;
+  entry.width = width;
+  entry.solid = solid;
+  entry.advance = pen;
+  entry.offset = stats.bytes;
+  entry.size = size;
+  stats.bytes += size;
+  stats.entries = entryCount;
+
+  // Glyph by glyph, so a solid glyph's box clears what the one before
+  // left under it, as drawing them one after the other would
+  uint8_t* ink = pool + entry.offset;
+  uint8_t* cover = ink + width * pages;
+  memset(ink, 0, bitmapSize);
+  memcpy(ink + bitmapSize, text, length);
+  pen = 0;
+  for (uint8_t i = 0; i < length; i++) {
+    blitDecodeGlyph(font, (uint8_t)text[i], glyph);
+    uint32_t box = 0;
+    if (glyph.solid) {
+      box = glyph.height >= 32 ? 0xFFFFFFFFUL : (1UL << glyph.height) - 1;
+    }
+    int row = phase + glyph.top - firstPage * 8;
+    for (uint8_t c = 0; c < glyph.width; c++) {
+      int column = pen + glyph.x + c - left;
+      uint64_t inkBits = (uint64_t)glyph.columns[c] << row;
+      uint64_t coverBits = (uint64_t)box << row;
+      for (int page = 0; page < pages; page++) {
+        uint8_t* cell = ink + page * width + column;
+        *cell = (*cell & ~(uint8_t)coverBits) | (uint8_t)inkBits;
+        if (solid) {
+          cover[page * width + column] |= (uint8_t)coverBits;
+        }
+        inkBits >>= 8;
+        coverBits >>= 8;
+      }
+    }
+    pen += glyph.advance;
+  }
+  return &entry;
+}
+
+// Drops an entry and closes the gap it leaves in the pool
+void TextCache::evict(uint8_t index) {
+  TextCacheEntry& entry = entries[index];
+  uint16_t end = entry.offset + entry.size;
+  memmove(pool + entry.offset, pool + end, stats.bytes - end);
+  stats.bytes -= entry.size;
+  for (uint8_t i = index + 1; i < entryCount; i++) {
+    entries[i].offset -= entry.size;
+  }
+  entryCount--;
+  memmove(&entries[index], &entries[index + 1], (entryCount - index) * sizeof(entries[0]));
+  stats.entries = entryCount;
+  stats.evictions++;
+}
+
+void TextCache::blit(uint8_t* buffer, const TextCacheEntry& entry, int x, int y) const {
+  int left = x + entry.left;
+  int from = max(0, -left);
+  int to = min((int)entry.width, DISPLAY_WIDTH - left);
+  if (from >= to) {
+    return;
+  }
+  int firstPage = pageOf(y) + entry.firstPage;
+  const uint8_t* ink = pool + entry.offset;
+  const uint8_t* cover = ink + entry.width * entry.pages;
+  for (uint8_t page = 0; page < entry.pages; page++) {
+    int target = firstPage + page;
+    if (target < 0 || target >= DISPLAY_PAGES) {
+      continue;
+    }
+    uint8_t* row = buffer + target * DISPLAY_WIDTH;
+    const uint8_t* inkRow = ink + page * entry.width;
+    if (entry.solid) {
+      const uint8_t* coverRow = cover + page * entry.width;
+      for (int i = from; i < to; i++) {
+        row[left + i] = (row[left + i] & ~coverRow[i]) | inkRow[i];
+      }
+    } else {
+      for (int i = from; i < to; i++) {
+        row[left + i] |= inkRow[i];
+      }
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef TEXT_CACHE_H
+#define TEXT_CACHE_H
+
+#include <Arduino.h>
+
+#define TEXT_CACHE_ENTRIES 32
+#define TEXT_CACHE_BYTES 4096                         // bitmap budget for all entries
+#define TEXT_CACHE_MAX_ENTRY (TEXT_CACHE_BYTES / 4)  // larger strings are drawn uncached
+
+// Counters, reset only by resetStats()
+struct TextCacheStats {
+  uint32_t hits;
+  uint32_t misses;     // rasterised and stored
+  uint32_t evictions;  // least recently drawn entries dropped for room
+  uint32_t uncached;   // over TEXT_CACHE_MAX_ENTRY, drawn with blitStr()
+  uint16_t entries;
+  uint16_t bytes;      // of TEXT_CACHE_BYTES in use
+};
+
+// One rasterised string. The bitmap is whole pages as they sit in the
+// framebuffer for a baseline at this row within its page, so drawing
+// it copies bytes without shifting. The text follows it in the pool.
+struct TextCacheEntry {
+  const uint8_t* font;
+  uint32_t hash;      // of the text
+  uint8_t length;
+  uint8_t phase;      // baseline row within its page
+  int8_t firstPage;   // of the bitmap, relative to the baseline's page
+  uint8_t pages;
+  int16_t left;       // first column, relative to the pen
+  uint8_t width;      // columns
+  bool solid;         // a cover bitmap follows the ink
+  int16_t advance;
+  uint16_t offset;    // into the pool
+  uint16_t size;      // bitmap and text
+  uint32_t lastUsed;
+};
+
+// LRU cache of strings rasterised with the Blitter, for text that is
+// drawn the same way frame after frame: menu labels, titles, hints.
+// Entries are keyed by font, baseline phase and the text, found by a
+// hash of it and compared in full on a hit. Bitmaps and texts are packed
+// into one pool that is compacted on eviction, so the cache never holds
+// more than TEXT_CACHE_BYTES.
+class TextCache {
+  public:
+    TextCache();
+
+    // blitStr() through the cache, for a font the Blitter supports
+    int draw(uint8_t* buffer, const uint8_t* font, int x, int y, const char* text);
+    void clear();
+
+    const TextCacheStats& getStats() const;
+    void resetStats();
+
+  private:
+    TextCacheEntry entries[TEXT_CACHE_ENTRIES];
+    uint8_t entryCount;
+    uint8_t pool[TEXT_CACHE_BYTES];
+    uint32_t clock;
+    TextCacheStats stats;
+
+    TextCacheEntry* find(const uint8_t* font, const char* text, uint32_t hash, uint8_t length, uint8_t phase);
+    TextCacheEntry* insert(const uint8_t* font, const char* text, uint32_t hash, uint8_t length, uint8_t phase);
+    void evict(uint8_t index);
+    void blit(uint8_t* buffer, const TextCacheEntry& entry, int x, int y) const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,244 @@
+#include "Arduino.h"
+#include "HostHal.h"
+
+#include <stdarg.h>
+
+HardwareSerial Serial;
+
+// ---- Time ----
+
+unsigned long millis() {
+  return (unsigned long)(hostHal.now() / 1000);
+}
+
+unsigned long micros() {
+  // Wraps at 32 bits like the device
+  return (unsigned long)(uint32_t)hostHal.now();
+}
+
+void delay(unsigned long ms) {
+  hostHal.advance((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us) {
+  hostHal.advance(us);
+}
+
+void yield() {
+  // Nothing else to run on the host
+}
+
+// ---- GPIO ----
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  hostHal.pinMode(pin, mode);
+}
+
+int digitalRead(uint8_t pin) {
+  return hostHal.digitalRead(pin);
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+  hostHal.digitalWrite(pin, level);
+}
+
+uint16_t analogRead(uint8_t pin) {
+  return hostHal.analogRead(pin);
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode) {
+  hostHal.attachInterrupt(pin, isr, mode);
+}
+
+void detachInterrupt(uint8_t pin) {
+  hostHal.detachInterrupt(pin);
+}
+
+void noInterrupts() {
+  hostHal.setInterruptsEnabled(false);
+}
+
+void interrupts() {
+  hostHal.setInterruptsEnabled(true);
+}
+
+// ---- Math ----
+
+// Deterministic generator so host runs are repeatable
+static uint32_t randomState = 1;
+
+void randomSeed(unsigned long seed) {
+  randomState = seed ? (uint32_t)seed : 1;
+}
+
+long random(long howBig) {
+  if (howBig <= 0) {
+    return 0;
+  }
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return (long)(randomState % (uint32_t)howBig);
+}
+
+long random(long howSmall, long howBig) {
+  if (howSmall >= howBig) {
+    return howSmall;
+  }
+  return random(howBig - howSmall) + howSmall;
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// ---- Print ----
+
+size_t Print::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    n += write(*buffer++);
+  }
+  return n;
+}
+
+size_t Print::write(const char* text) {
+  return write(reinterpret_cast<const uint8_t*>(text), strlen(text));
+}
+
+size_t Print::printNumber(unsigned long value, int base, bool negative) {
+  char buffer[8 * sizeof(long) + 2];
+  char* p = &buffer[sizeof(buffer) - 1];
+  *p = '\0';
+  if (base < 2) {
+    base = 10;
+  }
+  do {
+    int digit = value % base;
+    *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    value /= base;
+  } while (value);
+  if (negative) {
+    *--p = '-';
+  }
+  return write(p);
+}
+
+size_t Print::print(const char* text) {
+  return write(text);
+}
+
+size_t Print::print(char c) {
+  return write((uint8_t)c);
+}
+
+size_t Print::print(int value, int base) {
+  return print((long)value, base);
+}
+
+size_t Print::print(unsigned int value, int base) {
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(long value, int base) {
+  if (base == DEC && value < 0) {
+    return printNumber((unsigned long)(-value), base, true);
+  }
+  return printNumber((unsigned long)value, base, false);
+}
+
+size_t Print::print(unsigned long value, int base) {
+  return printNumber(value, base, false);
+}
+
+size_t Print::print(double value, int digits) {
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.*f", digits, value);
+  return write(buffer);
+}
+
+size_t Print::println() {
+  return write("\r\n");
+}
+
+size_t Print::println(const char* text) {
+  return print(text) + println();
+}
+
+size_t Print::println(char c) {
+  return print(c) + println();
+}
+
+size_t Print::println(int value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(unsigned int value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(long value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(unsigned long value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(double value, int digits) {
+  return print(value, digits) + println();
+}
+
+size_t Print::printf(const char* format, ...) {
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (length < 0) {
+    return 0;
+  }
+  return write(reinterpret_cast<const uint8_t*>(buffer), min((size_t)length, sizeof(buffer) - 1));
+}
+
+// ---- Serial ----
+
+void HardwareSerial::begin(unsigned long baud) {
+  // Baud rate is irrelevant on the host
+}
+
+void HardwareSerial::end() {
+}
+
+int HardwareSerial::available() {
+  return hostHal.serialAvailable();
+}
+
+int HardwareSerial::read() {
+  return hostHal.serialRead();
+}
+
+void HardwareSerial::flush() {
+}
+
+int HardwareSerial::availableForWrite() {
+  return 128;
+}
+
+HardwareSerial::operator bool() const {
+  return true;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  hostHal.serialWrite(&c, 1);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+  hostHal.serialWrite(buffer, size);
+  return size;
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include "FS.h"
+#include "LittleFS.h"
+#include "HostHal.h"
+
+#include <stdio.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+LittleFSFS LittleFS;
+
+namespace fs {
+
+uint32_t File::writes = 0;
+uint32_t File::flushes = 0;
+
+File::File() {
+}
+
+File::File(FILE* file) : handle(file, fclose) {
+}
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+  writes++;
+  return handle ? fwrite(buffer, 1, size, handle.get()) : 0;
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+  return handle ? fread(buffer, 1, size, handle.get()) : 0;
+}
+
+bool File::seek(uint32_t position, SeekMode mode) {
+  int whence = mode == SeekCur ? SEEK_CUR : (mode == SeekEnd ? SEEK_END : SEEK_SET);
+  return handle && fseek(handle.get(), position, whence) == 0;
+}
+
+size_t File::position() const {
+  return handle ? ftell(handle.get()) : 0;
+}
+
+size_t File::size() const {
+  if (!handle) {
+    return 0;
+  }
+  long at = ftell(handle.get());
+  fseek(handle.get(), 0, SEEK_END);
+  long end = ftell(handle.get());
+  fseek(handle.get(), at, SEEK_SET);
+  return end;
+}
+
+void File::flush() {
+  flushes++;
+  if (handle) {
+    fflush(handle.get());
+  }
+}
+
+void File::close() {
+  handle.reset();
+}
+
+File::operator bool() const {
+  return (bool)handle;
+}
+
+uint32_t File::getWrites() {
+  return writes;
+}
+
+uint32_t File::getFlushes() {
+  return flushes;
+}
+
+static std::string hostPath(const char* path) {
+  return std::string(hostHal.getFlashDir()) + path;
+}
+
+// Arduino modes map onto stdio ones; always binary
+File FS::open(const char* path, const char* mode, bool create) {
+  std::string full = hostPath(path);
+  std::string stdioMode = std::string(mode) + "b";
+  FILE* file = fopen(full.c_str(), stdioMode.c_str());
+  if (file == nullptr && create && mode[0] == 'r') {
+    FILE* created = fopen(full.c_str(), "wb");
+    if (created != nullptr) {
+      fclose(created);
+      file = fopen(full.c_str(), stdioMode.c_str());
+    }
+  }
+  return file != nullptr ? File(file) : File();
+}
+
+bool FS::exists(const char* path) {
+  struct stat info;
+  return stat(hostPath(path).c_str(), &info) == 0;
+}
+
+bool FS::remove(const char* path) {
+  return ::remove(hostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const char* from, const char* to) {
+  return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+}
+
+bool FS::mkdir(const char* path) {
+  return ::mkdir(hostPath(path).c_str(), 0777) == 0 || exists(path);
+}
+
+bool FS::rmdir(const char* path) {
+  return ::rmdir(hostPath(path).c_str()) == 0;
+}
+
+}  // namespace fs
+
+bool LittleFSFS::begin(bool formatOnFail) {
+  struct stat info;
+  const char* dir = hostHal.getFlashDir();
+  return dir[0] != '\0' && stat(dir, &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+void LittleFSFS::end() {
+}
\ No newline at end of file
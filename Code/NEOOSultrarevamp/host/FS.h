@@ -0,0 +1,63 @@
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+// Host stand-in for the arduino-esp32 FS API. Paths are rooted in a host
+// directory (HostHal::setFlashDir), so a library written by the simulator
+// or a benchmark is just a set of ordinary files.
+
+#include "Arduino.h"
+
+#include <memory>
+
+namespace fs {
+
+enum SeekMode {
+  SeekSet = 0,
+  SeekCur = 1,
+  SeekEnd = 2
+};
+
+class File : public Print {
+  public:
+    File();
+    explicit File(FILE* handle);
+
+    using Print::write;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    size_t read(uint8_t* buffer, size_t size);
+    bool seek(uint32_t position, SeekMode mode = SeekSet);
+    size_t position() const;
+    size_t size() const;
+    void flush();
+    void close();
+    operator bool() const;
+
+    // Host only: calls of write() and flush() on any file, for benchmarks
+    static uint32_t getWrites();
+    static uint32_t getFlushes();
+
+  private:
+    std::shared_ptr<FILE> handle;
+    static uint32_t writes;
+    static uint32_t flushes;
+};
+
+class FS {
+  public:
+    File open(const char* path, const char* mode = "r", bool create = false);
+    bool exists(const char* path);
+    bool remove(const char* path);
+    bool rename(const char* from, const char* to);
+    bool mkdir(const char* path);
+    bool rmdir(const char* path);
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,703 @@
+#include "HostHal.h"
+#include "Arduino.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+HostHal hostHal;
+
+HostHal::HostHal()
+  : clock(0), timeLimit(0), quit(false), timerAt(0), timerIsr(nullptr), interruptsEnabled(true), pinWrites(0),
+    portTap(nullptr),
+    serialOut(stdout), serialTap(nullptr), serialInHead(0), serialInTail(0), serialBytes(0),
+    panelBytes(0), snapshotDir("."), flashDir(""), frameDump(false), frameNumber(0),
+    irFrameCount(0), irFrameCapacity(64), irBusyUntil(0), irLoopPin(0), irLoopCenter(0), irLoopReach(0),
+    irLoopSeed(1), eventCount(0), nextEvent(0), pinNameCount(0) {
+  memset(modes, INPUT, sizeof(modes));
+  memset(outputs, LOW, sizeof(outputs));
+  memset(driven, 0, sizeof(driven));
+  memset(analog, 0, sizeof(analog));  // HOST_WAVE_DC at 0
+  memset(isrs, 0, sizeof(isrs));
+  memset(isrModes, 0, sizeof(isrModes));
+  memset(panel, 0, sizeof(panel));
+  irFrames = static_cast<HostIrFrame*>(calloc(irFrameCapacity, sizeof(HostIrFrame)));
+  events = static_cast<HostEvent*>(calloc(HOST_MAX_EVENTS, sizeof(HostEvent)));
+}
+
+// ---- Time ----
+
+uint64_t HostHal::now() const {
+  return clock;
+}
+
+void HostHal::advance(uint64_t micros) {
+  uint64_t target = clock + micros;
+  while (!quit) {
+    bool eventDue = nextEvent < eventCount && events[nextEvent].atMicros <= target;
+    bool alarmDue = timerIsr != nullptr && timerAt <= target;
+    if (!eventDue && !alarmDue) {
+      break;
+    }
+    if (alarmDue && (!eventDue || timerAt < events[nextEvent].atMicros)) {
+      // One-shot; the isr sets the next alarm itself
+      HostIsr isr = timerIsr;
+      timerIsr = nullptr;
+      if (timerAt > clock) {
+        clock = timerAt;
+      }
+      isr();
+      continue;
+    }
+    const HostEvent& event = events[nextEvent++];
+    if (event.atMicros > clock) {
+      clock = event.atMicros;
+    }
+    apply(event);
+  }
+  clock = target;
+  if (timeLimit != 0 && clock >= timeLimit) {
+    quit = true;
+  }
+}
+
+void HostHal::setTimeLimit(uint64_t micros) {
+  timeLimit = micros;
+}
+
+bool HostHal::finished() const {
+  return quit;
+}
+
+void HostHal::setTimerAlarm(uint64_t atMicros, HostIsr isr) {
+  timerAt = atMicros;
+  timerIsr = isr;
+}
+
+// ---- GPIO ----
+
+int HostHal::readLevel(uint8_t pin) const {
+  if (modes[pin] == OUTPUT) {
+    return outputs[pin];
+  }
+  if (driven[pin]) {
+    return driven[pin] - 1;
+  }
+  return modes[pin] == INPUT_PULLUP ? HIGH : LOW;
+}
+
+// Fire the pin's interrupt if the level change matches its trigger
+void HostHal::setLevel(uint8_t pin, int before) {
+  int after = readLevel(pin);
+  if (before == after || isrs[pin] == nullptr || !interruptsEnabled) {
+    return;
+  }
+  int mode = isrModes[pin];
+  if (mode == CHANGE || (mode == RISING && after == HIGH) || (mode == FALLING && after == LOW)) {
+    isrs[pin]();
+  }
+}
+
+void HostHal::pinMode(uint8_t pin, uint8_t mode) {
+  if (pin >= HOST_PIN_COUNT) {
+    return;
+  }
+  int before = readLevel(pin);
+  modes[pin] = mode;
+  setLevel(pin, before);
+}
+
+int HostHal::digitalRead(uint8_t pin) const {
+  return pin < HOST_PIN_COUNT ? readLevel(pin) : LOW;
+}
+
+void HostHal::digitalWrite(uint8_t pin, uint8_t level) {
+  if (pin >= HOST_PIN_COUNT) {
+    return;
+  }
+  int before = readLevel(pin);
+  outputs[pin] = level ? HIGH : LOW;
+  pinWrites++;
+  setLevel(pin, before);
+}
+
+void HostHal::attachInterrupt(uint8_t pin, HostIsr isr, int mode) {
+  if (pin < HOST_PIN_COUNT) {
+    isrs[pin] = isr;
+    isrModes[pin] = mode;
+  }
+}
+
+void HostHal::detachInterrupt(uint8_t pin) {
+  if (pin < HOST_PIN_COUNT) {
+    isrs[pin] = nullptr;
+  }
+}
+
+void HostHal::setInterruptsEnabled(bool enabled) {
+  interruptsEnabled = enabled;
+}
+
+void HostHal::drivePin(uint8_t pin, uint8_t level) {
+  if (pin >= HOST_PIN_COUNT) {
+    return;
+  }
+  int before = readLevel(pin);
+  driven[pin] = (level ? HIGH : LOW) + 1;
+  setLevel(pin, before);
+}
+
+void HostHal::releasePin(uint8_t pin) {
+  if (pin >= HOST_PIN_COUNT) {
+    return;
+  }
+  int before = readLevel(pin);
+  driven[pin] = 0;
+  setLevel(pin, before);
+}
+
+void HostHal::setAnalog(uint8_t pin, uint16_t value) {
+  setAnalogWave(pin, HOST_WAVE_DC, 0, value, value);
+}
+
+uint16_t HostHal::analogRead(uint8_t pin) const {
+  return analogAt(pin, clock);
+}
+
+void HostHal::setAnalogWave(uint8_t pin, uint8_t shape, uint32_t periodUs, uint16_t low, uint16_t high,
+                            uint8_t duty) {
+  if (pin >= HOST_PIN_COUNT) {
+    return;
+  }
+  AnalogWave& wave = analog[pin];
+  wave.shape = periodUs > 0 ? shape : HOST_WAVE_DC;
+  wave.duty = std::min<uint8_t>(duty, 100);
+  wave.periodUs = periodUs;
+  wave.low = low;
+  wave.high = high;
+  wave.startedAt = clock;
+}
+
+uint16_t HostHal::analogAt(uint8_t pin, double atMicros) const {
+  if (pin >= HOST_PIN_COUNT) {
+    return 0;
+  }
+  const AnalogWave& wave = analog[pin];
+  if (wave.shape == HOST_WAVE_DC) {
+    return wave.low;
+  }
+  // Phase in [0, 1) since the wave was set
+  double phase = fmod(atMicros - (double)wave.startedAt, wave.periodUs) / wave.periodUs;
+  if (phase < 0) {
+    phase += 1;
+  }
+  double level;
+  switch (wave.shape) {
+    case HOST_WAVE_SINE:
+      level = 0.5 + 0.5 * sin(2 * M_PI * phase);
+      break;
+    case HOST_WAVE_SQUARE:
+      level = phase * 100 < wave.duty ? 1 : 0;
+      break;
+    default:
+      level = phase < 0.5 ? 2 * phase : 2 - 2 * phase;
+      break;
+  }
+  return (uint16_t)lround(wave.low + level * ((int)wave.high - (int)wave.low));
+}
+
+uint32_t HostHal::getPinWrites() const {
+  return pinWrites;
+}
+
+void HostHal::writePort(uint32_t mask, uint32_t levels) {
+  pinWrites++;
+  for (uint8_t pin = 0; pin < 32; pin++) {
+    if (mask & (1UL << pin)) {
+      int before = readLevel(pin);
+      outputs[pin] = (levels >> pin) & 1 ? HIGH : LOW;
+      setLevel(pin, before);
+    }
+  }
+  if (portTap != nullptr) {
+    portTap(clock, mask, levels);
+  }
+}
+
+void HostHal::setPortTap(HostPortTap tap) {
+  portTap = tap;
+}
+
+// ---- Serial ----
+
+void HostHal::setSerialOutput(FILE* out) {
+  serialOut = out;
+}
+
+void HostHal::setSerialTap(HostSerialTap tap) {
+  serialTap = tap;
+}
+
+void HostHal::serialWrite(const uint8_t* data, size_t length) {
+  serialBytes += length;
+  if (serialTap != nullptr) {
+    serialTap(data, length);
+  }
+  if (serialOut != nullptr) {
+    fwrite(data, 1, length, serialOut);
+  }
+}
+
+void HostHal::serialInject(const char* data) {
+  while (*data && (serialInHead + 1) % sizeof(serialIn) != serialInTail) {
+    serialIn[serialInHead] = *data++;
+    serialInHead = (serialInHead + 1) % sizeof(serialIn);
+  }
+}
+
+int HostHal::serialAvailable() const {
+  return (int)((serialInHead + sizeof(serialIn) - serialInTail) % sizeof(serialIn));
+}
+
+int HostHal::serialRead() {
+  if (serialInHead == serialInTail) {
+    return -1;
+  }
+  int c = (uint8_t)serialIn[serialInTail];
+  serialInTail = (serialInTail + 1) % sizeof(serialIn);
+  return c;
+}
+
+uint32_t HostHal::getSerialBytes() const {
+  return serialBytes;
+}
+
+// ---- Display panel ----
+
+void HostHal::panelWriteTiles(uint8_t tileX, uint8_t page, uint8_t count, const uint8_t* tiles) {
+  if (page >= HOST_PANEL_HEIGHT / 8 || tileX >= HOST_PANEL_WIDTH / 8) {
+    return;
+  }
+  count = std::min<uint8_t>(count, HOST_PANEL_WIDTH / 8 - tileX);
+  memcpy(panel + page * HOST_PANEL_WIDTH + tileX * 8, tiles, count * 8);
+  panelBytes += count * 8;
+}
+
+void HostHal::panelRefresh() {
+  frameNumber++;
+  if (frameDump) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/frame_%05u.pbm", snapshotDir, (unsigned)frameNumber);
+    writePanelPbm(path);
+  }
+}
+
+void HostHal::chargeBus(uint32_t bytes, uint32_t bitsPerSecond) {
+  // 9 clocks per byte on I2C (8 data bits + ACK)
+  if (bitsPerSecond != 0) {
+    advance((uint64_t)bytes * 9 * 1000000 / bitsPerSecond);
+  }
+}
+
+const uint8_t* HostHal::getPanel() const {
+  return panel;
+}
+
+// Binary PBM (P4): rows of packed pixels, MSB first, 1 = black
+bool HostHal::writePanelPbm(const char* path) const {
+  FILE* file = fopen(path, "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  fprintf(file, "P4\n%d %d\n", HOST_PANEL_WIDTH, HOST_PANEL_HEIGHT);
+  for (int y = 0; y < HOST_PANEL_HEIGHT; y++) {
+    uint8_t row[HOST_PANEL_WIDTH / 8];
+    memset(row, 0, sizeof(row));
+    for (int x = 0; x < HOST_PANEL_WIDTH; x++) {
+      if (panel[(y / 8) * HOST_PANEL_WIDTH + x] & (1 << (y & 7))) {
+        row[x / 8] |= 0x80 >> (x & 7);
+      }
+    }
+    fwrite(row, 1, sizeof(row), file);
+  }
+  fclose(file);
+  return true;
+}
+
+void HostHal::setSnapshotDir(const char* dir) {
+  snapshotDir = dir;
+}
+
+void HostHal::setFrameDump(bool enabled) {
+  frameDump = enabled;
+}
+
+uint32_t HostHal::getPanelBytes() const {
+  return panelBytes;
+}
+
+// ---- IR ----
+
+void HostHal::irTransmit(const uint16_t* durations, uint16_t count, uint32_t carrierHz) {
+  irStart(durations, count, carrierHz);
+  advance(irBusyUntil - clock);
+}
+
+// Logged when it starts; the transmitter stays busy for the frame's airtime
+bool HostHal::irStart(const uint16_t* durations, uint16_t count, uint32_t carrierHz, float dutyFraction) {
+  if (!(dutyFraction > 0 && dutyFraction <= 1)) {
+    return false;
+  }
+  uint8_t duty = (uint8_t)(dutyFraction * 100 + 0.5f);
+  if (irFrameCount == irFrameCapacity) {
+    irFrameCapacity *= 2;
+    irFrames = static_cast<HostIrFrame*>(realloc(irFrames, irFrameCapacity * sizeof(HostIrFrame)));
+  }
+  HostIrFrame& frame = irFrames[irFrameCount++];
+  frame.atMicros = clock;
+  frame.carrierHz = carrierHz;
+  frame.duty = duty;
+  frame.count = std::min<uint16_t>(count, HOST_IR_LOG_SIZE);
+  memcpy(frame.durations, durations, frame.count * sizeof(uint16_t));
+
+  uint64_t total = 0;
+  for (uint16_t i = 0; i < frame.count; i++) {
+    total += durations[i];
+  }
+  irBusyUntil = clock + total;
+
+  if (irLoopReach == 0) {
+    return true;
+  }
+  // The receiver sees each frame of the timeline on its own, split at
+  // idle line as it would; a 0 mark joins the spaces either side of it
+  uint16_t received[HOST_IR_LOG_SIZE];
+  uint16_t length = 0;
+  uint64_t at = clock;
+  uint64_t frameAt = clock;
+  uint32_t idle = 0;
+  for (uint16_t i = 0; i < frame.count; i++) {
+    if (i % 2 == 1) {
+      idle += durations[i];
+    } else if (durations[i] > 0) {
+      if (length > 0 && idle >= HOST_IR_LOOP_GAP) {
+        irLoopFrame(frameAt, received, length, carrierHz, duty);
+        length = 0;
+      }
+      if (length == 0) {
+        frameAt = at;
+      } else {
+        received[length++] = std::min<uint32_t>(idle, 0xFFFF);
+      }
+      received[length++] = durations[i];
+      idle = 0;
+    }
+    at += durations[i];
+  }
+  if (length > 0) {
+    irLoopFrame(frameAt, received, length, carrierHz, duty);
+  }
+  return true;
+}
+
+void HostHal::setIrLoopback(uint8_t pin, uint32_t centerHz, uint8_t reach) {
+  irLoopPin = pin;
+  irLoopCenter = centerHz;
+  irLoopReach = reach;
+}
+
+// Signal strength in percent: reach, scaled by the receiver's band-pass
+// response (half at 5% off centre) and by duty, as energy per carrier
+// pulse, which stops helping past 50%. From 50 on every frame arrives,
+// below 30 none; in between it is a coin toss from a fixed seed. Marks
+// stretch by up to HOST_IR_LOOP_EXCESS, and shrink on a weak signal.
+void HostHal::irLoopFrame(uint64_t atMicros, uint16_t* durations, uint16_t count, uint32_t carrierHz, uint8_t duty) {
+  double offset = ((double)carrierHz - irLoopCenter) / irLoopCenter / 0.05;
+  double strength = irLoopReach / (1 + offset * offset) * std::min<uint8_t>(duty, 50) / 33.0;
+  irLoopSeed = irLoopSeed * 1103515245UL + 12345UL;
+  double chance = (strength - 30) / 20;
+  if (chance < 1 && (irLoopSeed >> 16) % 1000 >= chance * 1000) {
+    return;
+  }
+  int excess = (int)(std::min(strength, 100.0) - 50);
+  excess = std::min(excess, HOST_IR_LOOP_EXCESS);
+  for (uint16_t i = 0; i < count; i++) {
+    int stretched = durations[i] + (i % 2 == 0 ? excess : -excess);
+    durations[i] = std::max(stretched, 1);
+  }
+  irInjectAt(atMicros, irLoopPin, durations, count);
+}
+
+bool HostHal::irBusy() const {
+  return clock < irBusyUntil;
+}
+
+void HostHal::irInject(uint8_t pin, const uint16_t* durations, uint16_t count) {
+  irInjectAt(clock, pin, durations, count);
+}
+
+// Schedule a demodulated receiver waveform: idle high, marks pull low
+void HostHal::irInjectAt(uint64_t atMicros, uint8_t pin, const uint16_t* durations, uint16_t count) {
+  HostEvent event;
+  memset(&event, 0, sizeof(event));
+  event.kind = HOST_EVENT_PIN;
+  event.pin = pin;
+  event.atMicros = atMicros;
+  for (uint16_t i = 0; i < count; i++) {
+    event.level = (i % 2 == 0) ? LOW : HIGH;
+    schedule(event);
+    event.atMicros += durations[i];
+  }
+  event.level = HIGH;
+  schedule(event);
+}
+
+uint16_t HostHal::getIrFrameCount() const {
+  return irFrameCount;
+}
+
+const HostIrFrame* HostHal::getIrFrame(uint16_t index) const {
+  return index < irFrameCount ? &irFrames[index] : nullptr;
+}
+
+// One transmitted frame per line: "<us> <carrier Hz> <mark> <space> ..."
+bool HostHal::writeIrLog(const char* path) const {
+  FILE* out = fopen(path, "w");
+  if (out == nullptr) {
+    return false;
+  }
+  fprintf(out, "# at_us carrier_hz durations_us...\n");
+  for (uint16_t i = 0; i < irFrameCount; i++) {
+    const HostIrFrame& frame = irFrames[i];
+    fprintf(out, "%llu %u", (unsigned long long)frame.atMicros, (unsigned)frame.carrierHz);
+    for (uint16_t j = 0; j < frame.count; j++) {
+      fprintf(out, " %u", (unsigned)frame.durations[j]);
+    }
+    fprintf(out, "\n");
+  }
+  fclose(out);
+  return true;
+}
+
+// Durations for the script's "ir" command; paths are relative to the script
+static uint16_t loadIrWaveform(const char* scriptPath, const char* name, uint16_t* durations, uint16_t capacity) {
+  char path[256];
+  const char* slash = strrchr(scriptPath, '/');
+  if (name[0] == '/' || slash == nullptr) {
+    snprintf(path, sizeof(path), "%s", name);
+  } else {
+    snprintf(path, sizeof(path), "%.*s/%s", (int)(slash - scriptPath), scriptPath, name);
+  }
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    return 0;
+  }
+  uint16_t count = 0;
+  char line[256];
+  while (fgets(line, sizeof(line), file)) {
+    char* hash = strchr(line, '#');
+    if (hash) {
+      *hash = '\0';
+    }
+    for (char* token = strtok(line, " \t\r\n,"); token && count < capacity; token = strtok(nullptr, " \t\r\n,")) {
+      durations[count++] = strtoul(token, nullptr, 10);
+    }
+  }
+  fclose(file);
+  return count;
+}
+
+// ---- Flash ----
+
+void HostHal::setFlashDir(const char* dir) {
+  flashDir = dir;
+}
+
+const char* HostHal::getFlashDir() const {
+  return flashDir;
+}
+
+// ---- Script ----
+
+void HostHal::definePinName(const char* name, uint8_t pin) {
+  if (pinNameCount < (int)(sizeof(pinNames) / sizeof(pinNames[0]))) {
+    strncpy(pinNames[pinNameCount].name, name, sizeof(pinNames[0].name) - 1);
+    pinNames[pinNameCount].name[sizeof(pinNames[0].name) - 1] = '\0';
+    pinNames[pinNameCount].pin = pin;
+    pinNameCount++;
+  }
+}
+
+int HostHal::lookupPin(const char* token) const {
+  for (int i = 0; i < pinNameCount; i++) {
+    if (strcmp(pinNames[i].name, token) == 0) {
+      return pinNames[i].pin;
+    }
+  }
+  char* end;
+  long pin = strtol(token, &end, 10);
+  return (*end == '\0' && pin >= 0 && pin < HOST_PIN_COUNT) ? (int)pin : -1;
+}
+
+// Insert keeping events ordered by time; equal times keep script order
+bool HostHal::schedule(const HostEvent& event) {
+  if (eventCount == HOST_MAX_EVENTS) {
+    return false;
+  }
+  size_t at = eventCount;
+  while (at > nextEvent && events[at - 1].atMicros > event.atMicros) {
+    events[at] = events[at - 1];
+    at--;
+  }
+  events[at] = event;
+  eventCount++;
+  return true;
+}
+
+bool HostHal::loadScript(const char* path) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    return false;
+  }
+
+  char line[128];
+  int lineNumber = 0;
+  bool ok = true;
+  while (fgets(line, sizeof(line), file)) {
+    lineNumber++;
+    char* hash = strchr(line, '#');
+    if (hash) {
+      *hash = '\0';
+    }
+
+    double ms;
+    char command[16] = "";
+    char arg1[32] = "";
+    char arg2[64] = "";
+    char arg3[16] = "";
+    int fields = sscanf(line, "%lf %15s %31s %63s %15s", &ms, command, arg1, arg2, arg3);
+    if (fields <= 0) {
+      continue;
+    }
+
+    HostEvent event;
+    memset(&event, 0, sizeof(event));
+    event.atMicros = (uint64_t)(ms * 1000);
+
+    int pin = fields >= 3 ? lookupPin(arg1) : -1;
+    if (strcmp(command, "press") == 0 && pin >= 0) {
+      event.kind = HOST_EVENT_PIN;
+      event.pin = pin;
+      event.level = LOW;
+      schedule(event);
+    } else if (strcmp(command, "release") == 0 && pin >= 0) {
+      event.kind = HOST_EVENT_PIN;
+      event.pin = pin;
+      event.level = 2;
+      schedule(event);
+    } else if (strcmp(command, "tap") == 0 && pin >= 0) {
+      event.kind = HOST_EVENT_PIN;
+      event.pin = pin;
+      event.level = LOW;
+      schedule(event);
+      event.atMicros += 60000;
+      event.level = 2;
+      schedule(event);
+    } else if (strcmp(command, "pin") == 0 && pin >= 0 && fields >= 4) {
+      event.kind = HOST_EVENT_PIN;
+      event.pin = pin;
+      event.level = atoi(arg2) ? HIGH : LOW;
+      schedule(event);
+    } else if (strcmp(command, "snapshot") == 0 && fields >= 3) {
+      event.kind = HOST_EVENT_SNAPSHOT;
+      snprintf(event.name, sizeof(event.name), "%s", arg1);
+      schedule(event);
+    } else if (strcmp(command, "serial") == 0 && fields >= 3) {
+      event.kind = HOST_EVENT_SERIAL;
+      snprintf(event.name, sizeof(event.name), "%s", arg1);
+      schedule(event);
+    } else if (strcmp(command, "ir") == 0 && pin >= 0 && fields >= 4) {
+      uint16_t durations[HOST_IR_LOG_SIZE];
+      uint16_t count = loadIrWaveform(path, arg2, durations, HOST_IR_LOG_SIZE);
+      if (count == 0) {
+        fprintf(stderr, "%s:%d: cannot read IR waveform '%s'\n", path, lineNumber, arg2);
+        ok = false;
+      }
+      irInjectAt(event.atMicros, pin, durations, count);
+    } else if (strcmp(command, "irloop") == 0 && pin >= 0 && fields == 5) {
+      event.kind = HOST_EVENT_IR_LOOP;
+      event.pin = pin;
+      event.value = strtoul(arg2, nullptr, 10);
+      event.level = std::min(atoi(arg3), 255);
+      schedule(event);
+    } else if (strcmp(command, "wave") == 0 && pin >= 0 && fields >= 4) {
+      static const char* const shapes[] = {"dc", "sine", "square", "triangle"};
+      unsigned period = 0;
+      unsigned low = 0;
+      unsigned high = 0;
+      unsigned duty = 50;
+      int values = sscanf(line, "%*f %*s %*s %*s %u %u %u %u", &period, &low, &high, &duty);
+      event.kind = HOST_EVENT_WAVE;
+      event.pin = pin;
+      event.level = 0xFF;
+      for (uint8_t i = 0; i < sizeof(shapes) / sizeof(shapes[0]); i++) {
+        if (strcmp(arg2, shapes[i]) == 0) {
+          event.level = i;
+        }
+      }
+      if (event.level == HOST_WAVE_DC && values >= 1) {
+        // "wave <pin> dc <value>"
+        low = high = period;
+        period = 0;
+      } else if (event.level == 0xFF || values < 3) {
+        fprintf(stderr, "%s:%d: cannot parse wave\n", path, lineNumber);
+        ok = false;
+        continue;
+      }
+      event.value = period;
+      event.low = std::min(low, 4095U);
+      event.high = std::min(high, 4095U);
+      event.duty = std::min(duty, 100U);
+      schedule(event);
+    } else if (strcmp(command, "quit") == 0) {
+      event.kind = HOST_EVENT_QUIT;
+      schedule(event);
+    } else {
+      fprintf(stderr, "%s:%d: cannot parse '%s'\n", path, lineNumber, command);
+      ok = false;
+    }
+  }
+  fclose(file);
+  return ok;
+}
+
+void HostHal::apply(const HostEvent& event) {
+  switch (event.kind) {
+    case HOST_EVENT_PIN:
+      if (event.level == 2) {
+        releasePin(event.pin);
+      } else {
+        drivePin(event.pin, event.level);
+      }
+      break;
+    case HOST_EVENT_SNAPSHOT: {
+      char path[256];
+      snprintf(path, sizeof(path), "%s/%s.pbm", snapshotDir, event.name);
+      writePanelPbm(path);
+      break;
+    }
+    case HOST_EVENT_SERIAL:
+      serialInject(event.name);
+      break;
+    case HOST_EVENT_IR_LOOP:
+      setIrLoopback(event.pin, event.value, event.level);
+      break;
+    case HOST_EVENT_WAVE:
+      setAnalogWave(event.pin, event.level, event.value, event.low, event.high, event.duty);
+      break;
+    case HOST_EVENT_QUIT:
+      quit = true;
+      break;
+  }
+}
\ No newline at end of file
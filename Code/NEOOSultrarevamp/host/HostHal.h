@@ -0,0 +1,221 @@
+#ifndef HOST_HAL_H
+#define HOST_HAL_H
+
+// Linux backend of the hardware abstraction layer behind the host
+// Arduino.h / U8g2lib.h / Wire.h shims. Time is virtual: it only moves
+// when the sketch sleeps (delay()) or a transfer is charged to the bus, so
+// runs are deterministic and as fast as the host allows.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#define HOST_PIN_COUNT 64
+#define HOST_PANEL_WIDTH 128
+#define HOST_PANEL_HEIGHT 64
+#define HOST_PANEL_SIZE (HOST_PANEL_WIDTH * HOST_PANEL_HEIGHT / 8)
+#define HOST_MAX_EVENTS 4096
+#define HOST_IR_LOG_SIZE 1024
+#define HOST_IR_LOOP_GAP 10000   // us of idle line between loopback frames, as IR_CAPTURE_GAP
+#define HOST_IR_LOOP_EXCESS 50   // us a receiver stretches marks by at full strength
+
+typedef void (*HostIsr)();
+typedef void (*HostSerialTap)(const uint8_t* data, size_t length);
+typedef void (*HostPortTap)(uint64_t atMicros, uint32_t mask, uint32_t levels);
+
+// One scripted action, applied when virtual time reaches atMicros
+struct HostEvent {
+  uint64_t atMicros;
+  uint8_t kind;
+  uint8_t pin;
+  uint8_t level;
+  uint32_t value;
+  uint16_t low;   // HOST_EVENT_WAVE: ADC counts
+  uint16_t high;
+  uint8_t duty;   // HOST_EVENT_WAVE: percent
+  char name[32];
+};
+
+enum HostEventKind : uint8_t {
+  HOST_EVENT_PIN,       // drive pin to level (level 2 = release to pull)
+  HOST_EVENT_SNAPSHOT,  // write the panel to <snapshot dir>/<name>.pbm
+  HOST_EVENT_SERIAL,    // queue name as input on the serial port
+  HOST_EVENT_IR_LOOP,   // receiver on pin sees the LED: centre value Hz, reach level %
+  HOST_EVENT_WAVE,      // analog signal on pin: shape level, period value us
+  HOST_EVENT_QUIT
+};
+
+// Periodic analog signals an ADC pin can carry
+enum HostWaveShape : uint8_t {
+  HOST_WAVE_DC,
+  HOST_WAVE_SINE,
+  HOST_WAVE_SQUARE,    // high for duty percent of the period
+  HOST_WAVE_TRIANGLE
+};
+
+// One frame handed to the IR transmitter
+struct HostIrFrame {
+  uint64_t atMicros;
+  uint32_t carrierHz;
+  uint8_t duty;     // percent
+  uint16_t count;
+  uint16_t durations[HOST_IR_LOG_SIZE];  // mark, space, mark, ... in us
+};
+
+class HostHal {
+  public:
+    HostHal();
+
+    // Time
+    uint64_t now() const;
+    void advance(uint64_t micros);   // runs every event that falls due
+    void setTimeLimit(uint64_t micros);
+    bool finished() const;
+    // The one hardware timer: isr runs when virtual time reaches atMicros,
+    // in order with the script's events. A null isr cancels it.
+    void setTimerAlarm(uint64_t atMicros, HostIsr isr);
+
+    // GPIO
+    void pinMode(uint8_t pin, uint8_t mode);
+    int digitalRead(uint8_t pin) const;
+    void digitalWrite(uint8_t pin, uint8_t level);
+    void attachInterrupt(uint8_t pin, HostIsr isr, int mode);
+    void detachInterrupt(uint8_t pin);
+    void setInterruptsEnabled(bool enabled);
+    void drivePin(uint8_t pin, uint8_t level);  // external signal on an input
+    void releasePin(uint8_t pin);               // back to pull-up / floating
+    void setAnalog(uint8_t pin, uint16_t value);
+    uint16_t analogRead(uint8_t pin) const;
+    // From now on pin carries a signal between low and high ADC counts;
+    // setAnalog() goes back to a constant
+    void setAnalogWave(uint8_t pin, uint8_t shape, uint32_t periodUs, uint16_t low, uint16_t high,
+                       uint8_t duty = 50);
+    // What the ADC reads at a given time, e.g. between two advance()s
+    uint16_t analogAt(uint8_t pin, double atMicros) const;
+    uint32_t getPinWrites() const;
+    void writePort(uint32_t mask, uint32_t levels);  // pins 0-31 at once, one write
+    void setPortTap(HostPortTap tap);                // sees every writePort()
+
+    // Serial
+    void setSerialOutput(FILE* out);
+    void setSerialTap(HostSerialTap tap);  // sees every byte written
+    void serialWrite(const uint8_t* data, size_t length);
+    void serialInject(const char* data);
+    int serialAvailable() const;
+    int serialRead();
+    uint32_t getSerialBytes() const;
+
+    // Display panel (SSD1306 page layout)
+    void panelWriteTiles(uint8_t tileX, uint8_t page, uint8_t count, const uint8_t* tiles);
+    void panelRefresh();  // end of a flush; dumps the frame when enabled
+    void chargeBus(uint32_t bytes, uint32_t bitsPerSecond);  // advance time for a transfer
+    const uint8_t* getPanel() const;
+    bool writePanelPbm(const char* path) const;
+    void setSnapshotDir(const char* dir);
+    void setFrameDump(bool enabled);
+    uint32_t getPanelBytes() const;
+
+    // IR
+    void irTransmit(const uint16_t* durations, uint16_t count, uint32_t carrierHz);  // blocks for its airtime
+    // Peripheral: returns at once. duty is a fraction, as rmtSetCarrier()
+    // takes it; outside (0, 1] the frame is refused and false returned.
+    bool irStart(const uint16_t* durations, uint16_t count, uint32_t carrierHz, float duty = 0.33f);
+    bool irBusy() const;  // a frame from irStart() is still on the air
+    void irInject(uint8_t pin, const uint16_t* durations, uint16_t count);
+    void irInjectAt(uint64_t atMicros, uint8_t pin, const uint16_t* durations, uint16_t count);
+    // Points the LED at the receiver on pin: every frame sent from then on
+    // reaches it, or not, depending on how far its carrier is from the
+    // receiver's band-pass centre, its duty cycle and reach (percent of
+    // the signal left at the receiver at 33% duty on centre frequency).
+    // reach 0 turns the loopback off.
+    void setIrLoopback(uint8_t pin, uint32_t centerHz, uint8_t reach);
+    bool writeIrLog(const char* path) const;
+    uint16_t getIrFrameCount() const;
+    const HostIrFrame* getIrFrame(uint16_t index) const;
+
+    // Flash: LittleFS paths live under this directory ("" = no flash)
+    void setFlashDir(const char* dir);
+    const char* getFlashDir() const;
+
+    // Script: one event per line, "<ms> <command> [args]"
+    //   press <pin> | release <pin> | tap <pin> | pin <pin> <0|1>
+    //   snapshot <name> | serial <text> | quit
+    //   ir <pin> <file>  receiver waveform, whitespace-separated mark/space
+    //                    us starting with a mark; relative to the script
+    //   irloop <pin> <centre Hz> <reach %>  see setIrLoopback()
+    //   wave <pin> <sine|square|triangle> <period us> <low> <high> [duty %]
+    //   wave <pin> dc <value>  analog signal in ADC counts, see setAnalogWave()
+    // Named pins can be registered with definePinName().
+    void definePinName(const char* name, uint8_t pin);
+    bool loadScript(const char* path);
+    bool schedule(const HostEvent& event);
+
+  private:
+    uint64_t clock;
+    uint64_t timeLimit;
+    bool quit;
+    uint64_t timerAt;
+    HostIsr timerIsr;
+
+    uint8_t modes[HOST_PIN_COUNT];
+    uint8_t outputs[HOST_PIN_COUNT];
+    uint8_t driven[HOST_PIN_COUNT];   // 0 = not driven, else level + 1
+    struct AnalogWave {
+      uint8_t shape;
+      uint8_t duty;
+      uint32_t periodUs;
+      uint16_t low;
+      uint16_t high;
+      uint64_t startedAt;
+    };
+    AnalogWave analog[HOST_PIN_COUNT];
+    HostIsr isrs[HOST_PIN_COUNT];
+    int isrModes[HOST_PIN_COUNT];
+    bool interruptsEnabled;
+    uint32_t pinWrites;
+    HostPortTap portTap;
+
+    FILE* serialOut;
+    HostSerialTap serialTap;
+    char serialIn[256];
+    size_t serialInHead;
+    size_t serialInTail;
+    uint32_t serialBytes;
+
+    uint8_t panel[HOST_PANEL_SIZE];
+    uint32_t panelBytes;
+    const char* snapshotDir;
+    const char* flashDir;
+    bool frameDump;
+    uint32_t frameNumber;
+
+    HostIrFrame* irFrames;
+    uint16_t irFrameCount;
+    uint16_t irFrameCapacity;
+    uint64_t irBusyUntil;
+    uint8_t irLoopPin;
+    uint32_t irLoopCenter;
+    uint8_t irLoopReach;
+    uint32_t irLoopSeed;
+
+    HostEvent* events;
+    size_t eventCount;
+    size_t nextEvent;
+
+    struct PinName {
+      char name[16];
+      uint8_t pin;
+    };
+    PinName pinNames[32];
+    int pinNameCount;
+
+    int readLevel(uint8_t pin) const;
+    void setLevel(uint8_t pin, int before);
+    void apply(const HostEvent& event);
+    void irLoopFrame(uint64_t atMicros, uint16_t* durations, uint16_t count, uint32_t carrierHz, uint8_t duty);
+    int lookupPin(const char* token) const;
+};
+
+extern HostHal hostHal;
+
+#endif
\ No newline at end of file
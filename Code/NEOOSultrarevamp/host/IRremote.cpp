@@ -0,0 +1,41 @@
+#include "IRremote.hpp"
+#include "HostHal.h"
+
+IRsend IrSender;
+
+IRsend::IRsend() : pin(0), carrierHz(38000), edgeCount(0) {
+}
+
+void IRsend::begin(uint_fast8_t sendPin) {
+  pin = sendPin;
+  pinMode(pin, OUTPUT);
+  digitalWrite(pin, LOW);
+}
+
+void IRsend::sendRaw(const uint16_t* buffer, uint_fast16_t length, uint_fast8_t kHz) {
+  hostHal.irTransmit(buffer, length, kHz * 1000UL);
+}
+
+void IRsend::enableIROut(uint_fast8_t kHz) {
+  carrierHz = kHz * 1000UL;
+  edgeCount = 0;
+}
+
+void IRsend::mark(unsigned int microseconds) {
+  if (edgeCount < HOST_IR_LOG_SIZE) {
+    edges[edgeCount++] = microseconds;
+  }
+}
+
+void IRsend::space(unsigned int microseconds) {
+  if (edgeCount < HOST_IR_LOG_SIZE) {
+    edges[edgeCount++] = microseconds;
+  }
+}
+
+void IRsend::IRLedOff() {
+  if (edgeCount > 0) {
+    hostHal.irTransmit(edges, edgeCount, carrierHz);
+    edgeCount = 0;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+#ifndef HOST_IRREMOTE_HPP
+#define HOST_IRREMOTE_HPP
+
+// Host stand-in for IRremote 4.x. Only raw sending is provided, whole or
+// edge by edge; each frame is logged by HostHal::irTransmit() and takes
+// its airtime. Edges sent with mark()/space() are logged as one frame
+// when the LED is switched off.
+
+#include "Arduino.h"
+#include "HostHal.h"
+
+class IRsend {
+  public:
+    IRsend();
+    void begin(uint_fast8_t sendPin);
+    void sendRaw(const uint16_t* buffer, uint_fast16_t length, uint_fast8_t kHz);
+
+    void enableIROut(uint_fast8_t kHz);
+    void mark(unsigned int microseconds);
+    void space(unsigned int microseconds);
+    void IRLedOff();
+
+  private:
+    uint8_t pin;
+    uint32_t carrierHz;
+    uint16_t edges[HOST_IR_LOG_SIZE];
+    uint16_t edgeCount;
+};
+
+extern IRsend IrSender;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "IrTrace.h"
+#include "IrCapture.h"
+
+#include <stdio.h>
+#include <string.h>
+
+IrTraceSplitter::IrTraceSplitter(std::vector<IrTraceFrame>& out)
+  : frames(out), clock(0), space(0), mark(true) {
+  frame.line = 0;
+  frame.atMicros = 0;
+}
+
+void IrTraceSplitter::restart(uint64_t atMicros) {
+  flush();
+  clock = atMicros;
+  space = 0;
+  mark = true;
+}
+
+void IrTraceSplitter::add(uint32_t duration, int line) {
+  clock += duration;
+  if (!mark) {
+    space += duration;
+    mark = true;
+    return;
+  }
+  mark = false;
+  if (duration == 0) {
+    return;
+  }
+  if (!frame.durations.empty() && space >= IR_CAPTURE_GAP) {
+    flush();
+  }
+  if (frame.durations.empty()) {
+    // Idle line before the first mark isn't part of the frame
+    frame.line = line;
+    frame.atMicros = clock - duration;
+  } else {
+    frame.durations.push_back(space > 0xFFFF ? 0xFFFF : space);
+  }
+  frame.durations.push_back(duration > 0xFFFF ? 0xFFFF : duration);
+  space = 0;
+}
+
+// Frames only ever take a space in front of a mark, so they end on one
+void IrTraceSplitter::flush() {
+  if (!frame.durations.empty()) {
+    frames.push_back(frame);
+  }
+  frame.durations.clear();
+  frame.expect.clear();
+}
+
+void IrTraceSplitter::setExpect(const std::string& expect) {
+  flush();
+  frame.expect = expect;
+}
+
+uint64_t IrTraceSplitter::getClock() const {
+  return clock;
+}
+
+bool irTraceLoad(const char* path, std::vector<IrTraceFrame>& frames, bool simLog) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    return false;
+  }
+  IrTraceSplitter splitter(frames);
+  char text[8192];
+  for (int line = 1; fgets(text, sizeof(text), file) != nullptr; line++) {
+    char* hash = strchr(text, '#');
+    if (hash != nullptr) {
+      if (strncmp(hash, "# expect ", 9) == 0) {
+        std::string expect = hash + 9;
+        expect.erase(expect.find_last_not_of(" \r\n") + 1);
+        splitter.setExpect(expect);
+      }
+      *hash = '\0';
+    }
+    int field = 0;
+    bool blank = true;
+    for (char* token = strtok(text, " \t\r\n"); token != nullptr; token = strtok(nullptr, " \t\r\n")) {
+      blank = false;
+      if (simLog && field++ < 2) {
+        if (field == 1) {
+          splitter.restart(strtoull(token, nullptr, 10));
+        }
+        continue;
+      }
+      splitter.add(strtoul(token, nullptr, 10), line);
+    }
+    if ((blank && hash == nullptr) || simLog) {
+      splitter.restart(splitter.getClock());
+    }
+  }
+  splitter.flush();
+  fclose(file);
+  return true;
+}
+
+std::string irTraceDescribe(const IrCode& code) {
+  char text[96];
+  if (code.protocol == IR_PROTOCOL_RAW) {
+    return "RAW";
+  }
+  if (code.flags & IR_CODE_FLAG_REPEAT) {
+    snprintf(text, sizeof(text), "%s repeat", irProtocolName(code.protocol));
+  } else {
+    snprintf(text, sizeof(text), "%s bits=%u address=0x%lX command=0x%lX", irProtocolName(code.protocol),
+             code.bits, (unsigned long)code.address, (unsigned long)code.command);
+  }
+  return text;
+}
\ No newline at end of file
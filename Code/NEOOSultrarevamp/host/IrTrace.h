@@ -0,0 +1,48 @@
+#ifndef IR_TRACE_H
+#define IR_TRACE_H
+
+#include "IrProtocols.h"
+
+#include <string>
+#include <vector>
+
+// One frame of a recorded IR trace
+struct IrTraceFrame {
+  std::vector<uint16_t> durations;  // mark, space, ... in us, ending on a mark
+  std::string expect;               // "# expect <description>" above it, if any
+  int line;                         // where it starts in the file
+  uint64_t atMicros;                // start of its first mark on the trace's clock
+};
+
+// Cuts an edge timeline into frames the way the receiver does: at idle
+// line of IR_CAPTURE_GAP or more. A 0 mark joins the spaces either side
+// of it, as IrTxQueue sends long idle line.
+class IrTraceSplitter {
+  public:
+    explicit IrTraceSplitter(std::vector<IrTraceFrame>& frames);
+
+    void restart(uint64_t atMicros);  // ends the frame; the next duration is a mark
+    void add(uint32_t duration, int line = 0);
+    void flush();                     // ends the frame in progress
+    void setExpect(const std::string& expect);  // for the next frame
+    uint64_t getClock() const;        // end of the last duration
+
+  private:
+    std::vector<IrTraceFrame>& frames;
+    IrTraceFrame frame;
+    uint64_t clock;
+    uint32_t space;  // idle line since the last mark
+    bool mark;       // the next duration is a mark
+};
+
+// Reads a trace in the `ir` script format: whitespace-separated mark and
+// space durations in us, # comments. Frames end at a blank line or at a
+// space of IR_CAPTURE_GAP or more, as the receiver splits them.
+// With simLog the file is neoos_sim --ir-log output instead: one frame
+// per line after the time and carrier fields, timed from the time field.
+bool irTraceLoad(const char* path, std::vector<IrTraceFrame>& frames, bool simLog = false);
+
+// "NEC bits=32 address=0x4 command=0x8", "NEC repeat" or "RAW"
+std::string irTraceDescribe(const IrCode& code);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,16 @@
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+#include "FS.h"
+
+// Mounts HostHal::getFlashDir(); fails when no flash directory is set
+
+class LittleFSFS : public fs::FS {
+  public:
+    bool begin(bool formatOnFail = false);
+    void end();
+};
+
+extern LittleFSFS LittleFS;
+
+#endif
\ No newline at end of file
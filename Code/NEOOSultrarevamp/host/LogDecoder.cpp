@@ -0,0 +1,181 @@
+#include "LogDecoder.h"
+#include "Profiler.h"
+
+#include <string>
+
+#define LOG_CATALOG_FORMAT(id, format) format,
+
+static const char* const formats[LOG_MESSAGE_COUNT] = {
+  LOG_CATALOG(LOG_CATALOG_FORMAT)
+};
+
+static const char levelNames[] = "-EWID";
+
+static uint32_t getU32(const uint8_t* in) {
+  return in[0] | (in[1] << 8) | (in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+LogDecoder::LogDecoder(FILE* out) : out(out), lineOpen(false), frames(0), badFrames(0) {
+}
+
+void LogDecoder::feed(const uint8_t* data, size_t length) {
+  pending.insert(pending.end(), data, data + length);
+  size_t at = 0;
+  while (at < pending.size()) {
+    size_t used = parse(at);
+    if (used == 0) {
+      break;
+    }
+    at += used;
+  }
+  pending.erase(pending.begin(), pending.begin() + at);
+}
+
+void LogDecoder::finish() {
+  if (lineOpen) {
+    fputc('\n', out);
+    lineOpen = false;
+  }
+}
+
+uint32_t LogDecoder::getFrames() const {
+  return frames;
+}
+
+uint32_t LogDecoder::getBadFrames() const {
+  return badFrames;
+}
+
+size_t LogDecoder::parse(size_t at) {
+  const uint8_t* data = &pending[at];
+  size_t available = pending.size() - at;
+  if (data[0] == PROFILER_MAGIC[0]) {
+    return skipProfile(data, available);
+  }
+  if (data[0] != LOG_SYNC) {
+    passThrough(data[0]);
+    return 1;
+  }
+  if (available < 2) {
+    return 0;
+  }
+  size_t size = LOG_FRAME_OVERHEAD + data[1];
+  if (data[1] > LOG_MAX_PAYLOAD) {
+    return 1;
+  }
+  if (available < size) {
+    return 0;
+  }
+
+  uint8_t sum = 0;
+  for (size_t i = 1; i < size - 1; i++) {
+    sum += data[i];
+  }
+  if (sum != data[size - 1] || !print(data)) {
+    badFrames++;
+    return 1;
+  }
+  frames++;
+  return size;
+}
+
+
+// Profiler dumps share the port; step over them whole so their records
+// aren't mistaken for text or frames
+size_t LogDecoder::skipProfile(const uint8_t* data, size_t available) {
+  size_t magic = strlen(PROFILER_MAGIC);
+  if (memcmp(data, PROFILER_MAGIC, min(available, magic)) != 0) {
+    passThrough(data[0]);
+    return 1;
+  }
+  if (available < PROFILER_HEADER_SIZE) {
+    return 0;
+  }
+  size_t size = PROFILER_HEADER_SIZE;
+  for (uint8_t i = 0; i < data[5]; i++) {
+    if (available <= size) {
+      return 0;
+    }
+    size += 1 + data[size];
+  }
+  size += (size_t)(data[6] | (data[7] << 8)) * PROFILER_RECORD_SIZE;
+  return available < size ? 0 : size;
+}
+
+bool LogDecoder::print(const uint8_t* frame) {
+  uint16_t id = frame[2] | (frame[3] << 8);
+  uint8_t level = frame[4];
+  uint32_t stamp = getU32(frame + 5);
+  const uint8_t* arg = frame + LOG_FRAME_HEADER;
+  const uint8_t* argEnd = arg + frame[1];
+
+  std::string text;
+  if (id >= LOG_MESSAGE_COUNT) {
+    // Newer firmware than this decoder
+    text = "message " + std::to_string(id);
+  } else {
+    for (const char* f = formats[id]; *f; f++) {
+      if (*f != '%') {
+        text += *f;
+        continue;
+      }
+      if (f[1] == '%') {
+        text += '%';
+        f++;
+        continue;
+      }
+      // Copy flags/width so the spec can go straight to snprintf
+      std::string spec = "%";
+      while (*++f && strchr("-+ #0123456789", *f)) {
+        spec += *f;
+      }
+      if (*f == '\0') {
+        break;
+      }
+      spec += *f;
+
+      char value[64];
+      if (*f == 's') {
+        if (argEnd - arg < 2 || arg[0] != LOG_ARG_STRING || argEnd - arg < 2 + arg[1]) {
+          return false;
+        }
+        std::string s(arg + 2, arg + 2 + arg[1]);
+        snprintf(value, sizeof(value), spec.c_str(), s.c_str());
+        arg += 2 + arg[1];
+      } else {
+        if (argEnd - arg < 5 || arg[0] != LOG_ARG_INT) {
+          return false;
+        }
+        uint32_t number = getU32(arg + 1);
+        if (*f == 'd' || *f == 'i') {
+          snprintf(value, sizeof(value), spec.c_str(), (int)number);
+        } else if (*f == 'u' || *f == 'x' || *f == 'X' || *f == 'c') {
+          snprintf(value, sizeof(value), spec.c_str(), (unsigned)number);
+        } else {
+          snprintf(value, sizeof(value), "?");
+        }
+        arg += 5;
+      }
+      text += value;
+    }
+  }
+
+  finish();
+  fprintf(out, "[%6u.%03u] %c %s\n", (unsigned)(stamp / 1000), (unsigned)(stamp % 1000),
+          level < sizeof(levelNames) - 1 ? levelNames[level] : '?', text.c_str());
+  return true;
+}
+
+// Text lines only; stray binary (e.g. profiler dumps) is dropped
+void LogDecoder::passThrough(uint8_t c) {
+  if (c == '\r') {
+    return;
+  }
+  if (c == '\n') {
+    fputc('\n', out);
+    lineOpen = false;
+  } else if (c >= 0x20 && c < 0x7F) {
+    fputc(c, out);
+    lineOpen = true;
+  }
+}
\ No newline at end of file
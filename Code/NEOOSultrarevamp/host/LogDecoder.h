@@ -0,0 +1,36 @@
+#ifndef LOG_DECODER_H
+#define LOG_DECODER_H
+
+#include "Log.h"
+
+#include <stdio.h>
+#include <vector>
+
+// Turns the binary Logger stream back into text using the format strings
+// in LogCatalog.h. Bytes outside frames (plain Serial.print output) are
+// passed through, profiler dumps are skipped, and corrupt frames are
+// dropped by resyncing on LOG_SYNC.
+class LogDecoder {
+  public:
+    LogDecoder(FILE* out);
+
+    void feed(const uint8_t* data, size_t length);
+    void finish();  // end any pass-through line left open
+
+    uint32_t getFrames() const;
+    uint32_t getBadFrames() const;  // checksum or argument errors
+
+  private:
+    FILE* out;
+    std::vector<uint8_t> pending;
+    bool lineOpen;
+    uint32_t frames;
+    uint32_t badFrames;
+
+    size_t parse(size_t at);  // bytes consumed at pending[at], 0 = need more
+    size_t skipProfile(const uint8_t* data, size_t available);
+    bool print(const uint8_t* frame);
+    void passThrough(uint8_t c);
+};
+
+#endif
\ No newline at end of file
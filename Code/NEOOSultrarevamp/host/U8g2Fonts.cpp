@@ -0,0 +1,580 @@
+// Generated by neoos_font_encode (font_encode.cpp); do not edit.
+// Stand-ins for the u8g2 fonts the sketch uses, in the u8g2 font
+// format, drawn from the 3x5 and 5x7 faces in font_encode.cpp.
+
+#include "U8g2lib.h"
+
+// 95 glyphs, ascent 5, descent 1, advance 4
+const uint8_t u8g2_font_4x6_tr[688] = {
+  0x5F, 0x00, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x04, 0x04, 0x06, 0x00, 0xFF, 0x05, 0xFF, 0x05,
+  0xFF, 0x00, 0xD7, 0x01, 0xB8, 0x02, 0x93, 0x20, 0x04, 0x40, 0x32, 0x21, 0x05, 0x75, 0x32, 0x2B,
+  0x22, 0x06, 0xCB, 0x33, 0x49, 0x05, 0x23, 0x08, 0x57, 0x32, 0x69, 0xA8, 0xA1, 0x02, 0x24, 0x08,
+  0x57, 0x72, 0x23, 0xC6, 0x91, 0x00, 0x25, 0x08, 0x57, 0x32, 0x19, 0xB5, 0x51, 0x00, 0x26, 0x06,
+  0x57, 0x72, 0x7D, 0x09, 0x27, 0x05, 0xE9, 0x33, 0x02, 0x28, 0x06, 0x76, 0x72, 0xAA, 0x0C, 0x29,
+  0x07, 0x56, 0x32, 0x31, 0x25, 0x05, 0x2A, 0x06, 0xCF, 0x32, 0xA9, 0x03, 0x2B, 0x07, 0xCF, 0x72,
+  0x69, 0x25, 0x00, 0x2C, 0x05, 0x4A, 0x72, 0x0A, 0x2D, 0x05, 0x47, 0x33, 0x03, 0x2E, 0x05, 0x65,
+  0x32, 0x01, 0x2F, 0x07, 0x57, 0xB2, 0x55, 0x19, 0x01, 0x30, 0x07, 0x57, 0x32, 0x23, 0x59, 0x23,
+  0x31, 0x07, 0x57, 0x72, 0x49, 0x56, 0x03, 0x32, 0x07, 0x57, 0x32, 0x73, 0xC8, 0x01, 0x33, 0x07,
+  0x57, 0x32, 0x33, 0xC9, 0x11, 0x34, 0x07, 0x57, 0x32, 0x49, 0x8D, 0x58, 0x35, 0x07, 0x57, 0x32,
+  0x23, 0x1E, 0x01, 0x36, 0x08, 0x57, 0x32, 0x23, 0x8E, 0x34, 0x02, 0x37, 0x07, 0x57, 0x32, 0x33,
+  0xC5, 0x0A, 0x38, 0x08, 0x57, 0x32, 0x23, 0x0D, 0x35, 0x02, 0x39, 0x08, 0x57, 0x32, 0x23, 0x8D,
+  0x38, 0x02, 0x3A, 0x05, 0xED, 0x32, 0x29, 0x3B, 0x06, 0x52, 0x72, 0x59, 0x01, 0x3C, 0x06, 0x57,
+  0xB2, 0xA9, 0x2E, 0x3D, 0x05, 0xCF, 0x32, 0x7B, 0x3E, 0x07, 0x57, 0x32, 0xB9, 0x2A, 0x01, 0x3F,
+  0x08, 0x57, 0x32, 0x33, 0x65, 0x98, 0x00, 0x40, 0x07, 0x57, 0x72, 0xD5, 0xD0, 0x02, 0x41, 0x07,
+  0x57, 0x72, 0xD5, 0x50, 0x2A, 0x42, 0x08, 0x57, 0x32, 0x2A, 0xAD, 0xB4, 0x00, 0x43, 0x06, 0x57,
+  0x72, 0xB3, 0x16, 0x44, 0x07, 0x57, 0x32, 0x2A, 0x59, 0x0B, 0x45, 0x07, 0x57, 0x32, 0x23, 0xAA,
+  0x38, 0x46, 0x08, 0x57, 0x32, 0x23, 0xAA, 0x18, 0x01, 0x47, 0x07, 0x57, 0x72, 0x33, 0xA9, 0x24,
+  0x48, 0x08, 0x57, 0x32, 0x49, 0x0D, 0xA5, 0x02, 0x49, 0x07, 0x57, 0x32, 0x2B, 0x56, 0x03, 0x4A,
+  0x07, 0x57, 0xB2, 0xA5, 0xAA, 0x00, 0x4B, 0x08, 0x57, 0x32, 0x49, 0xAD, 0xA4, 0x02, 0x4C, 0x06,
+  0x57, 0x32, 0xB1, 0x39, 0x4D, 0x08, 0x57, 0x32, 0x69, 0x0C, 0xA5, 0x02, 0x4E, 0x07, 0x57, 0x32,
+  0x69, 0x1C, 0x2A, 0x4F, 0x07, 0x57, 0x72, 0x95, 0x55, 0x01, 0x50, 0x08, 0x57, 0x32, 0x2A, 0xAD,
+  0x18, 0x01, 0x51, 0x07, 0x57, 0x72, 0x95, 0x1A, 0x49, 0x52, 0x08, 0x57, 0x32, 0x2A, 0xAD, 0xA4,
+  0x02, 0x53, 0x07, 0x57, 0x72, 0x3B, 0x2F, 0x00, 0x54, 0x07, 0x57, 0x32, 0x2B, 0xB6, 0x00, 0x55,
+  0x07, 0x57, 0x32, 0xC9, 0x95, 0x04, 0x56, 0x08, 0x57, 0x32, 0xC9, 0x2A, 0x13, 0x00, 0x57, 0x08,
+  0x57, 0x32, 0x49, 0x8D, 0xA1, 0x02, 0x58, 0x08, 0x57, 0x32, 0x49, 0xB5, 0x54, 0x00, 0x59, 0x08,
+  0x57, 0x32, 0x49, 0x95, 0x15, 0x00, 0x5A, 0x07, 0x57, 0x32, 0x33, 0x95, 0x03, 0x5B, 0x06, 0x56,
+  0x32, 0xAB, 0x12, 0x5C, 0x07, 0x57, 0x32, 0x31, 0x97, 0x01, 0x5D, 0x06, 0x76, 0x32, 0xAA, 0x1A,
+  0x5E, 0x05, 0xCB, 0x73, 0x0D, 0x5F, 0x05, 0x47, 0x32, 0x03, 0x60, 0x05, 0xCA, 0x33, 0x31, 0x61,
+  0x07, 0x57, 0x72, 0xD5, 0x50, 0x2A, 0x62, 0x08, 0x57, 0x32, 0x2A, 0xAD, 0xB4, 0x00, 0x63, 0x06,
+  0x57, 0x72, 0xB3, 0x16, 0x64, 0x07, 0x57, 0x32, 0x2A, 0x59, 0x0B, 0x65, 0x07, 0x57, 0x32, 0x23,
+  0xAA, 0x38, 0x66, 0x08, 0x57, 0x32, 0x23, 0xAA, 0x18, 0x01, 0x67, 0x07, 0x57, 0x72, 0x33, 0xA9,
+  0x24, 0x68, 0x08, 0x57, 0x32, 0x49, 0x0D, 0xA5, 0x02, 0x69, 0x07, 0x57, 0x32, 0x2B, 0x56, 0x03,
+  0x6A, 0x07, 0x57, 0xB2, 0xA5, 0xAA, 0x00, 0x6B, 0x08, 0x57, 0x32, 0x49, 0xAD, 0xA4, 0x02, 0x6C,
+  0x06, 0x57, 0x32, 0xB1, 0x39, 0x6D, 0x08, 0x57, 0x32, 0x69, 0x0C, 0xA5, 0x02, 0x6E, 0x07, 0x57,
+  0x32, 0x69, 0x1C, 0x2A, 0x6F, 0x07, 0x57, 0x72, 0x95, 0x55, 0x01, 0x70, 0x08, 0x57, 0x32, 0x2A,
+  0xAD, 0x18, 0x01, 0x71, 0x07, 0x57, 0x72, 0x95, 0x1A, 0x49, 0x72, 0x08, 0x57, 0x32, 0x2A, 0xAD,
+  0xA4, 0x02, 0x73, 0x07, 0x57, 0x72, 0x3B, 0x2F, 0x00, 0x74, 0x07, 0x57, 0x32, 0x2B, 0xB6, 0x00,
+  0x75, 0x07, 0x57, 0x32, 0xC9, 0x95, 0x04, 0x76, 0x08, 0x57, 0x32, 0xC9, 0x2A, 0x13, 0x00, 0x77,
+  0x08, 0x57, 0x32, 0x49, 0x8D, 0xA1, 0x02, 0x78, 0x08, 0x57, 0x32, 0x49, 0xB5, 0x54, 0x00, 0x79,
+  0x08, 0x57, 0x32, 0x49, 0x95, 0x15, 0x00, 0x7A, 0x07, 0x57, 0x32, 0x33, 0x95, 0x03, 0x7B, 0x07,
+  0x57, 0x72, 0x2A, 0xC9, 0x28, 0x7C, 0x05, 0x75, 0x32, 0x43, 0x7D, 0x08, 0x57, 0x32, 0x32, 0xAA,
+  0xA4, 0x00, 0x7E, 0x06, 0x4B, 0x73, 0x23, 0x01, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00
+};
+
+// 95 glyphs, ascent 5, descent 1, advance 4
+const uint8_t u8g2_font_4x6_tf[688] = {
+  0x5F, 0x00, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x04, 0x04, 0x06, 0x00, 0xFF, 0x05, 0xFF, 0x05,
+  0xFF, 0x00, 0xD7, 0x01, 0xB8, 0x02, 0x93, 0x20, 0x04, 0x40, 0x32, 0x21, 0x05, 0x75, 0x32, 0x2B,
+  0x22, 0x06, 0xCB, 0x33, 0x49, 0x05, 0x23, 0x08, 0x57, 0x32, 0x69, 0xA8, 0xA1, 0x02, 0x24, 0x08,
+  0x57, 0x72, 0x23, 0xC6, 0x91, 0x00, 0x25, 0x08, 0x57, 0x32, 0x19, 0xB5, 0x51, 0x00, 0x26, 0x06,
+  0x57, 0x72, 0x7D, 0x09, 0x27, 0x05, 0xE9, 0x33, 0x02, 0x28, 0x06, 0x76, 0x72, 0xAA, 0x0C, 0x29,
+  0x07, 0x56, 0x32, 0x31, 0x25, 0x05, 0x2A, 0x06, 0xCF, 0x32, 0xA9, 0x03, 0x2B, 0x07, 0xCF, 0x72,
+  0x69, 0x25, 0x00, 0x2C, 0x05, 0x4A, 0x72, 0x0A, 0x2D, 0x05, 0x47, 0x33, 0x03, 0x2E, 0x05, 0x65,
+  0x32, 0x01, 0x2F, 0x07, 0x57, 0xB2, 0x55, 0x19, 0x01, 0x30, 0x07, 0x57, 0x32, 0x23, 0x59, 0x23,
+  0x31, 0x07, 0x57, 0x72, 0x49, 0x56, 0x03, 0x32, 0x07, 0x57, 0x32, 0x73, 0xC8, 0x01, 0x33, 0x07,
+  0x57, 0x32, 0x33, 0xC9, 0x11, 0x34, 0x07, 0x57, 0x32, 0x49, 0x8D, 0x58, 0x35, 0x07, 0x57, 0x32,
+  0x23, 0x1E, 0x01, 0x36, 0x08, 0x57, 0x32, 0x23, 0x8E, 0x34, 0x02, 0x37, 0x07, 0x57, 0x32, 0x33,
+  0xC5, 0x0A, 0x38, 0x08, 0x57, 0x32, 0x23, 0x0D, 0x35, 0x02, 0x39, 0x08, 0x57, 0x32, 0x23, 0x8D,
+  0x38, 0x02, 0x3A, 0x05, 0xED, 0x32, 0x29, 0x3B, 0x06, 0x52, 0x72, 0x59, 0x01, 0x3C, 0x06, 0x57,
+  0xB2, 0xA9, 0x2E, 0x3D, 0x05, 0xCF, 0x32, 0x7B, 0x3E, 0x07, 0x57, 0x32, 0xB9, 0x2A, 0x01, 0x3F,
+  0x08, 0x57, 0x32, 0x33, 0x65, 0x98, 0x00, 0x40, 0x07, 0x57, 0x72, 0xD5, 0xD0, 0x02, 0x41, 0x07,
+  0x57, 0x72, 0xD5, 0x50, 0x2A, 0x42, 0x08, 0x57, 0x32, 0x2A, 0xAD, 0xB4, 0x00, 0x43, 0x06, 0x57,
+  0x72, 0xB3, 0x16, 0x44, 0x07, 0x57, 0x32, 0x2A, 0x59, 0x0B, 0x45, 0x07, 0x57, 0x32, 0x23, 0xAA,
+  0x38, 0x46, 0x08, 0x57, 0x32, 0x23, 0xAA, 0x18, 0x01, 0x47, 0x07, 0x57, 0x72, 0x33, 0xA9, 0x24,
+  0x48, 0x08, 0x57, 0x32, 0x49, 0x0D, 0xA5, 0x02, 0x49, 0x07, 0x57, 0x32, 0x2B, 0x56, 0x03, 0x4A,
+  0x07, 0x57, 0xB2, 0xA5, 0xAA, 0x00, 0x4B, 0x08, 0x57, 0x32, 0x49, 0xAD, 0xA4, 0x02, 0x4C, 0x06,
+  0x57, 0x32, 0xB1, 0x39, 0x4D, 0x08, 0x57, 0x32, 0x69, 0x0C, 0xA5, 0x02, 0x4E, 0x07, 0x57, 0x32,
+  0x69, 0x1C, 0x2A, 0x4F, 0x07, 0x57, 0x72, 0x95, 0x55, 0x01, 0x50, 0x08, 0x57, 0x32, 0x2A, 0xAD,
+  0x18, 0x01, 0x51, 0x07, 0x57, 0x72, 0x95, 0x1A, 0x49, 0x52, 0x08, 0x57, 0x32, 0x2A, 0xAD, 0xA4,
+  0x02, 0x53, 0x07, 0x57, 0x72, 0x3B, 0x2F, 0x00, 0x54, 0x07, 0x57, 0x32, 0x2B, 0xB6, 0x00, 0x55,
+  0x07, 0x57, 0x32, 0xC9, 0x95, 0x04, 0x56, 0x08, 0x57, 0x32, 0xC9, 0x2A, 0x13, 0x00, 0x57, 0x08,
+  0x57, 0x32, 0x49, 0x8D, 0xA1, 0x02, 0x58, 0x08, 0x57, 0x32, 0x49, 0xB5, 0x54, 0x00, 0x59, 0x08,
+  0x57, 0x32, 0x49, 0x95, 0x15, 0x00, 0x5A, 0x07, 0x57, 0x32, 0x33, 0x95, 0x03, 0x5B, 0x06, 0x56,
+  0x32, 0xAB, 0x12, 0x5C, 0x07, 0x57, 0x32, 0x31, 0x97, 0x01, 0x5D, 0x06, 0x76, 0x32, 0xAA, 0x1A,
+  0x5E, 0x05, 0xCB, 0x73, 0x0D, 0x5F, 0x05, 0x47, 0x32, 0x03, 0x60, 0x05, 0xCA, 0x33, 0x31, 0x61,
+  0x07, 0x57, 0x72, 0xD5, 0x50, 0x2A, 0x62, 0x08, 0x57, 0x32, 0x2A, 0xAD, 0xB4, 0x00, 0x63, 0x06,
+  0x57, 0x72, 0xB3, 0x16, 0x64, 0x07, 0x57, 0x32, 0x2A, 0x59, 0x0B, 0x65, 0x07, 0x57, 0x32, 0x23,
+  0xAA, 0x38, 0x66, 0x08, 0x57, 0x32, 0x23, 0xAA, 0x18, 0x01, 0x67, 0x07, 0x57, 0x72, 0x33, 0xA9,
+  0x24, 0x68, 0x08, 0x57, 0x32, 0x49, 0x0D, 0xA5, 0x02, 0x69, 0x07, 0x57, 0x32, 0x2B, 0x56, 0x03,
+  0x6A, 0x07, 0x57, 0xB2, 0xA5, 0xAA, 0x00, 0x6B, 0x08, 0x57, 0x32, 0x49, 0xAD, 0xA4, 0x02, 0x6C,
+  0x06, 0x57, 0x32, 0xB1, 0x39, 0x6D, 0x08, 0x57, 0x32, 0x69, 0x0C, 0xA5, 0x02, 0x6E, 0x07, 0x57,
+  0x32, 0x69, 0x1C, 0x2A, 0x6F, 0x07, 0x57, 0x72, 0x95, 0x55, 0x01, 0x70, 0x08, 0x57, 0x32, 0x2A,
+  0xAD, 0x18, 0x01, 0x71, 0x07, 0x57, 0x72, 0x95, 0x1A, 0x49, 0x72, 0x08, 0x57, 0x32, 0x2A, 0xAD,
+  0xA4, 0x02, 0x73, 0x07, 0x57, 0x72, 0x3B, 0x2F, 0x00, 0x74, 0x07, 0x57, 0x32, 0x2B, 0xB6, 0x00,
+  0x75, 0x07, 0x57, 0x32, 0xC9, 0x95, 0x04, 0x76, 0x08, 0x57, 0x32, 0xC9, 0x2A, 0x13, 0x00, 0x77,
+  0x08, 0x57, 0x32, 0x49, 0x8D, 0xA1, 0x02, 0x78, 0x08, 0x57, 0x32, 0x49, 0xB5, 0x54, 0x00, 0x79,
+  0x08, 0x57, 0x32, 0x49, 0x95, 0x15, 0x00, 0x7A, 0x07, 0x57, 0x32, 0x33, 0x95, 0x03, 0x7B, 0x07,
+  0x57, 0x72, 0x2A, 0xC9, 0x28, 0x7C, 0x05, 0x75, 0x32, 0x43, 0x7D, 0x08, 0x57, 0x32, 0x32, 0xAA,
+  0xA4, 0x00, 0x7E, 0x06, 0x4B, 0x73, 0x23, 0x01, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00
+};
+
+// 95 glyphs, ascent 7, descent 2, advance 6
+const uint8_t u8g2_font_6x10_tf[931] = {
+  0x5F, 0x00, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x06, 0x0A, 0x00, 0xFE, 0x07, 0xFE, 0x07,
+  0xFE, 0x01, 0x34, 0x02, 0x68, 0x03, 0x86, 0x20, 0x05, 0x00, 0xD1, 0x01, 0x21, 0x07, 0xB9, 0xD1,
+  0x31, 0x28, 0x01, 0x22, 0x07, 0x5B, 0xD9, 0x91, 0x58, 0x02, 0x23, 0x0E, 0x3D, 0xD1, 0x53, 0x4A,
+  0x92, 0x41, 0xA9, 0x0C, 0x4A, 0x29, 0x49, 0x00, 0x24, 0x0C, 0x3D, 0xD1, 0x95, 0x0D, 0x4A, 0xB6,
+  0x25, 0x83, 0x16, 0x01, 0x25, 0x09, 0x3D, 0xD1, 0xA1, 0x49, 0x59, 0x27, 0x4D, 0x26, 0x0C, 0x3D,
+  0xD1, 0x23, 0x55, 0x6A, 0x95, 0x44, 0x8A, 0x94, 0x00, 0x27, 0x07, 0x5A, 0xD9, 0xA1, 0x28, 0x00,
+  0x28, 0x08, 0x7B, 0xD1, 0x95, 0x94, 0x6A, 0x05, 0x29, 0x09, 0x7B, 0xD1, 0x91, 0x95, 0x2A, 0x25,
+  0x00, 0x2A, 0x0B, 0x2D, 0xD3, 0x53, 0x8B, 0x06, 0x29, 0x4B, 0x12, 0x00, 0x2B, 0x0A, 0x2D, 0xD3,
+  0x15, 0x46, 0x83, 0x14, 0x46, 0x00, 0x2C, 0x07, 0x5A, 0xD1, 0xA1, 0x28, 0x00, 0x2D, 0x06, 0x0D,
+  0xD7, 0x31, 0x08, 0x2E, 0x06, 0x52, 0xD1, 0x31, 0x04, 0x2F, 0x07, 0x2D, 0xD3, 0x99, 0x75, 0x04,
+  0x30, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0xD2, 0x92, 0x4C, 0x5A, 0xB2, 0x00, 0x31, 0x08, 0x7B, 0xD1,
+  0x93, 0x48, 0x5D, 0x06, 0x32, 0x0A, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0xD6, 0x36, 0x08, 0x33, 0x0B,
+  0x3D, 0xD1, 0x31, 0x68, 0xD5, 0x54, 0x4B, 0x16, 0x00, 0x34, 0x0C, 0x3D, 0xD1, 0x97, 0x49, 0x49,
+  0x29, 0x19, 0xB4, 0x30, 0x01, 0x35, 0x0B, 0x3D, 0xD1, 0x71, 0x1C, 0xD2, 0x50, 0x4B, 0x16, 0x00,
+  0x36, 0x0C, 0x3D, 0xD1, 0x25, 0x65, 0xE1, 0x90, 0x64, 0x5A, 0xB2, 0x00, 0x37, 0x09, 0x3D, 0xD1,
+  0x31, 0x88, 0x59, 0x63, 0x0D, 0x38, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x5A, 0xB2, 0x64, 0x5A, 0xB2,
+  0x00, 0x39, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x5A, 0x32, 0x84, 0x59, 0x24, 0x01, 0x3A, 0x08, 0x6A,
+  0xD3, 0x31, 0x44, 0x43, 0x00, 0x3B, 0x08, 0x72, 0xD1, 0x31, 0x44, 0x8A, 0x02, 0x3C, 0x07, 0x3C,
+  0xD1, 0x17, 0x35, 0x36, 0x3D, 0x08, 0x1D, 0xD5, 0x31, 0xA8, 0x83, 0x00, 0x3E, 0x08, 0x7C, 0xD1,
+  0x11, 0x36, 0xB5, 0x01, 0x3F, 0x0B, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0x56, 0x87, 0x22, 0x00, 0x40,
+  0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0x62, 0x49, 0x94, 0xCA, 0x02, 0x41, 0x0B, 0x3D, 0xD1, 0xB3,
+  0x64, 0xB6, 0x61, 0xC8, 0xB4, 0x00, 0x42, 0x0D, 0x3D, 0xD1, 0x31, 0x24, 0x99, 0x36, 0x28, 0x99,
+  0x36, 0x28, 0x00, 0x43, 0x0A, 0x3D, 0xD1, 0xB3, 0x64, 0x62, 0x5B, 0xB2, 0x00, 0x44, 0x0A, 0x3D,
+  0xD1, 0x31, 0x55, 0x32, 0xA7, 0x64, 0x02, 0x45, 0x0B, 0x3D, 0xD1, 0x71, 0x0C, 0x87, 0x24, 0x0C,
+  0x07, 0x01, 0x46, 0x09, 0x3D, 0xD1, 0x71, 0x0C, 0xA7, 0xB0, 0x08, 0x47, 0x0B, 0x3D, 0xD1, 0xB3,
+  0x64, 0x62, 0x69, 0x4B, 0x16, 0x00, 0x48, 0x0A, 0x3D, 0xD1, 0x91, 0xD9, 0x86, 0x21, 0xB3, 0x05,
+  0x49, 0x08, 0x7B, 0xD1, 0xB1, 0x44, 0x5D, 0x06, 0x4A, 0x0A, 0x3D, 0xD1, 0xB5, 0x85, 0x2D, 0x51,
+  0x24, 0x01, 0x4B, 0x0C, 0x3D, 0xD1, 0x91, 0x49, 0x49, 0x49, 0x4B, 0xA2, 0x4A, 0x16, 0x4C, 0x08,
+  0x3D, 0xD1, 0x11, 0xF6, 0x38, 0x08, 0x4D, 0x0A, 0x3D, 0xD1, 0x91, 0x2D, 0x4B, 0xA2, 0xB9, 0x05,
+  0x4E, 0x0B, 0x3D, 0xD1, 0x91, 0x69, 0x93, 0x92, 0x48, 0x9B, 0x16, 0x4F, 0x09, 0x3D, 0xD1, 0xB3,
+  0x64, 0xDE, 0x92, 0x05, 0x50, 0x0B, 0x3D, 0xD1, 0x31, 0x24, 0x99, 0x36, 0x28, 0x61, 0x11, 0x51,
+  0x0B, 0x3D, 0xD1, 0xB3, 0x64, 0x2E, 0x89, 0x14, 0x29, 0x01, 0x52, 0x0C, 0x3D, 0xD1, 0x31, 0x24,
+  0x99, 0x36, 0x28, 0xA5, 0x4A, 0x16, 0x53, 0x0B, 0x3D, 0xD1, 0x33, 0x88, 0xE9, 0x1A, 0x0E, 0x0A,
+  0x00, 0x54, 0x09, 0x3D, 0xD1, 0x31, 0x48, 0x61, 0x4F, 0x00, 0x55, 0x09, 0x3D, 0xD1, 0x91, 0xF9,
+  0x96, 0x2C, 0x00, 0x56, 0x0A, 0x3D, 0xD1, 0x91, 0x79, 0x4B, 0x6A, 0x11, 0x00, 0x57, 0x0A, 0x3D,
+  0xD1, 0x91, 0xB9, 0x24, 0x4A, 0x72, 0x0B, 0x58, 0x0B, 0x3D, 0xD1, 0x91, 0x69, 0x49, 0xAD, 0x52,
+  0xD3, 0x02, 0x59, 0x0A, 0x3D, 0xD1, 0x91, 0x69, 0x49, 0x2D, 0x6C, 0x02, 0x5A, 0x09, 0x3D, 0xD1,
+  0x31, 0x88, 0x59, 0xC7, 0x41, 0x5B, 0x08, 0x7B, 0xD1, 0x31, 0x44, 0x9D, 0x06, 0x5C, 0x06, 0x2D,
+  0xD3, 0x91, 0x76, 0x5D, 0x08, 0x7B, 0xD1, 0x31, 0x75, 0x1A, 0x02, 0x5E, 0x08, 0x1D, 0xD9, 0x95,
+  0x25, 0xB5, 0x00, 0x5F, 0x06, 0x0D, 0xD1, 0x31, 0x08, 0x60, 0x06, 0x5B, 0xD9, 0x91, 0x15, 0x61,
+  0x0A, 0x2D, 0xD1, 0xB3, 0x26, 0x83, 0x96, 0x0C, 0x01, 0x62, 0x0B, 0x3D, 0xD1, 0x11, 0x56, 0x4C,
+  0x9A, 0x36, 0x28, 0x00, 0x63, 0x09, 0x2D, 0xD1, 0xB3, 0x84, 0xB5, 0x64, 0x01, 0x64, 0x0A, 0x3D,
+  0xD1, 0x59, 0x31, 0x6D, 0x5A, 0x32, 0x04, 0x65, 0x0A, 0x2D, 0xD1, 0xB3, 0x64, 0xC3, 0x90, 0x2E,
+  0x00, 0x66, 0x0A, 0x3D, 0xD1, 0x25, 0x55, 0xB2, 0x2D, 0xAC, 0x01, 0x67, 0x0B, 0x2D, 0xD1, 0x33,
+  0x68, 0xC9, 0x10, 0x46, 0x0A, 0x00, 0x68, 0x09, 0x3D, 0xD1, 0x11, 0x56, 0x4C, 0x9A, 0x2D, 0x69,
+  0x08, 0x7B, 0xD1, 0x13, 0x4A, 0x2D, 0x03, 0x6A, 0x0A, 0x3C, 0xD1, 0x17, 0x6B, 0x99, 0x94, 0x28,
+  0x00, 0x6B, 0x0B, 0x7C, 0xD1, 0x91, 0x95, 0x94, 0x44, 0x4A, 0x4A, 0x01, 0x6C, 0x07, 0x7B, 0xD1,
+  0x21, 0xF5, 0x32, 0x6D, 0x0A, 0x2D, 0xD1, 0xA1, 0xB4, 0x28, 0x89, 0xA6, 0x05, 0x6E, 0x09, 0x2D,
+  0xD1, 0x91, 0x98, 0x34, 0x5B, 0x00, 0x6F, 0x09, 0x2D, 0xD1, 0xB3, 0x64, 0xB6, 0x64, 0x01, 0x70,
+  0x0B, 0x2D, 0xD1, 0x31, 0x24, 0xD9, 0xA0, 0x84, 0x21, 0x00, 0x71, 0x09, 0x2D, 0xD1, 0x63, 0x52,
+  0x86, 0xB0, 0x00, 0x72, 0x09, 0x2D, 0xD1, 0x91, 0x98, 0xC4, 0x22, 0x00, 0x73, 0x08, 0x2D, 0xD1,
+  0xB3, 0xA4, 0x07, 0x05, 0x74, 0x0B, 0x3D, 0xD1, 0x13, 0x66, 0x5B, 0x58, 0x8A, 0x14, 0x00, 0x75,
+  0x09, 0x2D, 0xD1, 0x91, 0x39, 0x29, 0x4A, 0x00, 0x76, 0x09, 0x2D, 0xD1, 0x91, 0xD9, 0x92, 0x5A,
+  0x04, 0x77, 0x0A, 0x2D, 0xD1, 0x91, 0x59, 0x12, 0xA5, 0x0B, 0x00, 0x78, 0x09, 0x2D, 0xD1, 0x91,
+  0x25, 0xB5, 0x4A, 0x2D, 0x79, 0x0B, 0x2D, 0xD1, 0x91, 0x69, 0xC9, 0x10, 0x26, 0x0B, 0x00, 0x7A,
+  0x09, 0x2D, 0xD1, 0x31, 0x68, 0x6D, 0x83, 0x00, 0x7B, 0x0A, 0x7B, 0xD1, 0x95, 0x44, 0x49, 0x16,
+  0x65, 0x01, 0x7C, 0x06, 0xB9, 0xD1, 0x71, 0x08, 0x7D, 0x0B, 0x7B, 0xD1, 0x91, 0x45, 0x59, 0x12,
+  0x25, 0x11, 0x00, 0x7E, 0x08, 0x1D, 0xD9, 0x93, 0x25, 0xB5, 0x04, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x00, 0x00
+};
+
+// 95 glyphs, ascent 8, descent 2, advance 6
+const uint8_t u8g2_font_6x12_tr[931] = {
+  0x5F, 0x00, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x06, 0x0C, 0x00, 0xFE, 0x08, 0xFE, 0x08,
+  0xFE, 0x01, 0x34, 0x02, 0x68, 0x03, 0x86, 0x20, 0x05, 0x00, 0xD1, 0x01, 0x21, 0x07, 0xB9, 0xD1,
+  0x31, 0x28, 0x01, 0x22, 0x07, 0x5B, 0xD9, 0x91, 0x58, 0x02, 0x23, 0x0E, 0x3D, 0xD1, 0x53, 0x4A,
+  0x92, 0x41, 0xA9, 0x0C, 0x4A, 0x29, 0x49, 0x00, 0x24, 0x0C, 0x3D, 0xD1, 0x95, 0x0D, 0x4A, 0xB6,
+  0x25, 0x83, 0x16, 0x01, 0x25, 0x09, 0x3D, 0xD1, 0xA1, 0x49, 0x59, 0x27, 0x4D, 0x26, 0x0C, 0x3D,
+  0xD1, 0x23, 0x55, 0x6A, 0x95, 0x44, 0x8A, 0x94, 0x00, 0x27, 0x07, 0x5A, 0xD9, 0xA1, 0x28, 0x00,
+  0x28, 0x08, 0x7B, 0xD1, 0x95, 0x94, 0x6A, 0x05, 0x29, 0x09, 0x7B, 0xD1, 0x91, 0x95, 0x2A, 0x25,
+  0x00, 0x2A, 0x0B, 0x2D, 0xD3, 0x53, 0x8B, 0x06, 0x29, 0x4B, 0x12, 0x00, 0x2B, 0x0A, 0x2D, 0xD3,
+  0x15, 0x46, 0x83, 0x14, 0x46, 0x00, 0x2C, 0x07, 0x5A, 0xD1, 0xA1, 0x28, 0x00, 0x2D, 0x06, 0x0D,
+  0xD7, 0x31, 0x08, 0x2E, 0x06, 0x52, 0xD1, 0x31, 0x04, 0x2F, 0x07, 0x2D, 0xD3, 0x99, 0x75, 0x04,
+  0x30, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0xD2, 0x92, 0x4C, 0x5A, 0xB2, 0x00, 0x31, 0x08, 0x7B, 0xD1,
+  0x93, 0x48, 0x5D, 0x06, 0x32, 0x0A, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0xD6, 0x36, 0x08, 0x33, 0x0B,
+  0x3D, 0xD1, 0x31, 0x68, 0xD5, 0x54, 0x4B, 0x16, 0x00, 0x34, 0x0C, 0x3D, 0xD1, 0x97, 0x49, 0x49,
+  0x29, 0x19, 0xB4, 0x30, 0x01, 0x35, 0x0B, 0x3D, 0xD1, 0x71, 0x1C, 0xD2, 0x50, 0x4B, 0x16, 0x00,
+  0x36, 0x0C, 0x3D, 0xD1, 0x25, 0x65, 0xE1, 0x90, 0x64, 0x5A, 0xB2, 0x00, 0x37, 0x09, 0x3D, 0xD1,
+  0x31, 0x88, 0x59, 0x63, 0x0D, 0x38, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x5A, 0xB2, 0x64, 0x5A, 0xB2,
+  0x00, 0x39, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x5A, 0x32, 0x84, 0x59, 0x24, 0x01, 0x3A, 0x08, 0x6A,
+  0xD3, 0x31, 0x44, 0x43, 0x00, 0x3B, 0x08, 0x72, 0xD1, 0x31, 0x44, 0x8A, 0x02, 0x3C, 0x07, 0x3C,
+  0xD1, 0x17, 0x35, 0x36, 0x3D, 0x08, 0x1D, 0xD5, 0x31, 0xA8, 0x83, 0x00, 0x3E, 0x08, 0x7C, 0xD1,
+  0x11, 0x36, 0xB5, 0x01, 0x3F, 0x0B, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0x56, 0x87, 0x22, 0x00, 0x40,
+  0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0x62, 0x49, 0x94, 0xCA, 0x02, 0x41, 0x0B, 0x3D, 0xD1, 0xB3,
+  0x64, 0xB6, 0x61, 0xC8, 0xB4, 0x00, 0x42, 0x0D, 0x3D, 0xD1, 0x31, 0x24, 0x99, 0x36, 0x28, 0x99,
+  0x36, 0x28, 0x00, 0x43, 0x0A, 0x3D, 0xD1, 0xB3, 0x64, 0x62, 0x5B, 0xB2, 0x00, 0x44, 0x0A, 0x3D,
+  0xD1, 0x31, 0x55, 0x32, 0xA7, 0x64, 0x02, 0x45, 0x0B, 0x3D, 0xD1, 0x71, 0x0C, 0x87, 0x24, 0x0C,
+  0x07, 0x01, 0x46, 0x09, 0x3D, 0xD1, 0x71, 0x0C, 0xA7, 0xB0, 0x08, 0x47, 0x0B, 0x3D, 0xD1, 0xB3,
+  0x64, 0x62, 0x69, 0x4B, 0x16, 0x00, 0x48, 0x0A, 0x3D, 0xD1, 0x91, 0xD9, 0x86, 0x21, 0xB3, 0x05,
+  0x49, 0x08, 0x7B, 0xD1, 0xB1, 0x44, 0x5D, 0x06, 0x4A, 0x0A, 0x3D, 0xD1, 0xB5, 0x85, 0x2D, 0x51,
+  0x24, 0x01, 0x4B, 0x0C, 0x3D, 0xD1, 0x91, 0x49, 0x49, 0x49, 0x4B, 0xA2, 0x4A, 0x16, 0x4C, 0x08,
+  0x3D, 0xD1, 0x11, 0xF6, 0x38, 0x08, 0x4D, 0x0A, 0x3D, 0xD1, 0x91, 0x2D, 0x4B, 0xA2, 0xB9, 0x05,
+  0x4E, 0x0B, 0x3D, 0xD1, 0x91, 0x69, 0x93, 0x92, 0x48, 0x9B, 0x16, 0x4F, 0x09, 0x3D, 0xD1, 0xB3,
+  0x64, 0xDE, 0x92, 0x05, 0x50, 0x0B, 0x3D, 0xD1, 0x31, 0x24, 0x99, 0x36, 0x28, 0x61, 0x11, 0x51,
+  0x0B, 0x3D, 0xD1, 0xB3, 0x64, 0x2E, 0x89, 0x14, 0x29, 0x01, 0x52, 0x0C, 0x3D, 0xD1, 0x31, 0x24,
+  0x99, 0x36, 0x28, 0xA5, 0x4A, 0x16, 0x53, 0x0B, 0x3D, 0xD1, 0x33, 0x88, 0xE9, 0x1A, 0x0E, 0x0A,
+  0x00, 0x54, 0x09, 0x3D, 0xD1, 0x31, 0x48, 0x61, 0x4F, 0x00, 0x55, 0x09, 0x3D, 0xD1, 0x91, 0xF9,
+  0x96, 0x2C, 0x00, 0x56, 0x0A, 0x3D, 0xD1, 0x91, 0x79, 0x4B, 0x6A, 0x11, 0x00, 0x57, 0x0A, 0x3D,
+  0xD1, 0x91, 0xB9, 0x24, 0x4A, 0x72, 0x0B, 0x58, 0x0B, 0x3D, 0xD1, 0x91, 0x69, 0x49, 0xAD, 0x52,
+  0xD3, 0x02, 0x59, 0x0A, 0x3D, 0xD1, 0x91, 0x69, 0x49, 0x2D, 0x6C, 0x02, 0x5A, 0x09, 0x3D, 0xD1,
+  0x31, 0x88, 0x59, 0xC7, 0x41, 0x5B, 0x08, 0x7B, 0xD1, 0x31, 0x44, 0x9D, 0x06, 0x5C, 0x06, 0x2D,
+  0xD3, 0x91, 0x76, 0x5D, 0x08, 0x7B, 0xD1, 0x31, 0x75, 0x1A, 0x02, 0x5E, 0x08, 0x1D, 0xD9, 0x95,
+  0x25, 0xB5, 0x00, 0x5F, 0x06, 0x0D, 0xD1, 0x31, 0x08, 0x60, 0x06, 0x5B, 0xD9, 0x91, 0x15, 0x61,
+  0x0A, 0x2D, 0xD1, 0xB3, 0x26, 0x83, 0x96, 0x0C, 0x01, 0x62, 0x0B, 0x3D, 0xD1, 0x11, 0x56, 0x4C,
+  0x9A, 0x36, 0x28, 0x00, 0x63, 0x09, 0x2D, 0xD1, 0xB3, 0x84, 0xB5, 0x64, 0x01, 0x64, 0x0A, 0x3D,
+  0xD1, 0x59, 0x31, 0x6D, 0x5A, 0x32, 0x04, 0x65, 0x0A, 0x2D, 0xD1, 0xB3, 0x64, 0xC3, 0x90, 0x2E,
+  0x00, 0x66, 0x0A, 0x3D, 0xD1, 0x25, 0x55, 0xB2, 0x2D, 0xAC, 0x01, 0x67, 0x0B, 0x2D, 0xD1, 0x33,
+  0x68, 0xC9, 0x10, 0x46, 0x0A, 0x00, 0x68, 0x09, 0x3D, 0xD1, 0x11, 0x56, 0x4C, 0x9A, 0x2D, 0x69,
+  0x08, 0x7B, 0xD1, 0x13, 0x4A, 0x2D, 0x03, 0x6A, 0x0A, 0x3C, 0xD1, 0x17, 0x6B, 0x99, 0x94, 0x28,
+  0x00, 0x6B, 0x0B, 0x7C, 0xD1, 0x91, 0x95, 0x94, 0x44, 0x4A, 0x4A, 0x01, 0x6C, 0x07, 0x7B, 0xD1,
+  0x21, 0xF5, 0x32, 0x6D, 0x0A, 0x2D, 0xD1, 0xA1, 0xB4, 0x28, 0x89, 0xA6, 0x05, 0x6E, 0x09, 0x2D,
+  0xD1, 0x91, 0x98, 0x34, 0x5B, 0x00, 0x6F, 0x09, 0x2D, 0xD1, 0xB3, 0x64, 0xB6, 0x64, 0x01, 0x70,
+  0x0B, 0x2D, 0xD1, 0x31, 0x24, 0xD9, 0xA0, 0x84, 0x21, 0x00, 0x71, 0x09, 0x2D, 0xD1, 0x63, 0x52,
+  0x86, 0xB0, 0x00, 0x72, 0x09, 0x2D, 0xD1, 0x91, 0x98, 0xC4, 0x22, 0x00, 0x73, 0x08, 0x2D, 0xD1,
+  0xB3, 0xA4, 0x07, 0x05, 0x74, 0x0B, 0x3D, 0xD1, 0x13, 0x66, 0x5B, 0x58, 0x8A, 0x14, 0x00, 0x75,
+  0x09, 0x2D, 0xD1, 0x91, 0x39, 0x29, 0x4A, 0x00, 0x76, 0x09, 0x2D, 0xD1, 0x91, 0xD9, 0x92, 0x5A,
+  0x04, 0x77, 0x0A, 0x2D, 0xD1, 0x91, 0x59, 0x12, 0xA5, 0x0B, 0x00, 0x78, 0x09, 0x2D, 0xD1, 0x91,
+  0x25, 0xB5, 0x4A, 0x2D, 0x79, 0x0B, 0x2D, 0xD1, 0x91, 0x69, 0xC9, 0x10, 0x26, 0x0B, 0x00, 0x7A,
+  0x09, 0x2D, 0xD1, 0x31, 0x68, 0x6D, 0x83, 0x00, 0x7B, 0x0A, 0x7B, 0xD1, 0x95, 0x44, 0x49, 0x16,
+  0x65, 0x01, 0x7C, 0x06, 0xB9, 0xD1, 0x71, 0x08, 0x7D, 0x0B, 0x7B, 0xD1, 0x91, 0x45, 0x59, 0x12,
+  0x25, 0x11, 0x00, 0x7E, 0x08, 0x1D, 0xD9, 0x93, 0x25, 0xB5, 0x04, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x00, 0x00
+};
+
+// 95 glyphs, ascent 14, descent 3, advance 11
+const uint8_t u8g2_font_profont17_tr[1574] = {
+  0x5F, 0x00, 0x04, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x0B, 0x11, 0x00, 0xFD, 0x0E, 0xFD, 0x0E,
+  0xFD, 0x02, 0x26, 0x04, 0x2A, 0x06, 0x09, 0x20, 0x05, 0x00, 0x08, 0x37, 0x21, 0x08, 0xE2, 0x0C,
+  0x37, 0x3C, 0x30, 0x22, 0x22, 0x09, 0x66, 0x8A, 0x37, 0x88, 0xF0, 0x89, 0x00, 0x23, 0x1E, 0xEA,
+  0x08, 0xB7, 0x28, 0x12, 0x11, 0x12, 0x11, 0x12, 0x11, 0x39, 0x38, 0x30, 0x51, 0x24, 0x22, 0x72,
+  0x70, 0x60, 0xA2, 0x48, 0x44, 0x48, 0x44, 0x48, 0x44, 0x04, 0x00, 0x24, 0x1A, 0xEA, 0x08, 0x37,
+  0x09, 0x8A, 0x1D, 0x84, 0x1C, 0x8C, 0x08, 0x89, 0x88, 0x19, 0x99, 0x89, 0x08, 0x89, 0x1C, 0x8C,
+  0x1C, 0x84, 0x09, 0x0A, 0x01, 0x25, 0x13, 0xEA, 0x08, 0x37, 0x90, 0x31, 0x32, 0x12, 0x13, 0x14,
+  0x13, 0x14, 0x13, 0x14, 0x13, 0x32, 0x22, 0x63, 0x26, 0x1B, 0xEA, 0x08, 0xB7, 0x90, 0x11, 0x29,
+  0x11, 0x12, 0x51, 0x24, 0x22, 0x26, 0x28, 0x26, 0x22, 0x42, 0x22, 0x42, 0x24, 0x22, 0x24, 0x44,
+  0x22, 0x42, 0x22, 0x27, 0x0B, 0x64, 0x8A, 0x37, 0x1C, 0x84, 0x88, 0x90, 0x88, 0x00, 0x28, 0x0F,
+  0xE6, 0x0A, 0x37, 0x29, 0x11, 0x12, 0x11, 0xD2, 0x33, 0x21, 0x31, 0x21, 0x01, 0x29, 0x11, 0xE6,
+  0x0A, 0x37, 0x08, 0x89, 0x09, 0x89, 0x09, 0xE9, 0x89, 0x90, 0x88, 0x90, 0x10, 0x00, 0x2A, 0x14,
+  0xAA, 0x28, 0xB7, 0x28, 0x12, 0x11, 0x13, 0x14, 0x3A, 0x38, 0x30, 0x12, 0x14, 0x13, 0x11, 0x12,
+  0x11, 0x01, 0x2B, 0x0E, 0xAA, 0x28, 0x37, 0x09, 0x6A, 0x74, 0x70, 0x60, 0x24, 0xA8, 0x11, 0x00,
+  0x2C, 0x0B, 0x64, 0x0A, 0x37, 0x1C, 0x84, 0x88, 0x90, 0x88, 0x00, 0x2D, 0x07, 0x2A, 0x68, 0x37,
+  0x3C, 0x30, 0x2E, 0x07, 0x44, 0x0A, 0x37, 0x3C, 0x10, 0x2F, 0x0F, 0xAA, 0x28, 0x37, 0x2A, 0x13,
+  0x14, 0x13, 0x14, 0x13, 0x14, 0x13, 0x14, 0x04, 0x30, 0x15, 0xEA, 0x08, 0xB7, 0x18, 0x99, 0x88,
+  0x31, 0x72, 0x22, 0x42, 0x22, 0x62, 0x64, 0x44, 0x46, 0x26, 0x62, 0x64, 0x02, 0x31, 0x0C, 0xE6,
+  0x0A, 0xB7, 0x08, 0x89, 0x30, 0xD2, 0x9F, 0x1C, 0x14, 0x32, 0x14, 0xEA, 0x08, 0xB7, 0x18, 0x99,
+  0x88, 0x91, 0x09, 0x2A, 0x13, 0x14, 0x13, 0x14, 0x13, 0x14, 0x3B, 0x38, 0x30, 0x33, 0x14, 0xEA,
+  0x08, 0x37, 0x3C, 0x30, 0x13, 0x14, 0x13, 0x14, 0x15, 0x14, 0x15, 0x24, 0x23, 0x13, 0x31, 0x32,
+  0x01, 0x34, 0x16, 0xEA, 0x08, 0xB7, 0x09, 0x8A, 0x31, 0x12, 0x11, 0x12, 0x51, 0x24, 0x22, 0x24,
+  0x72, 0x70, 0x60, 0x26, 0xA8, 0x09, 0x00, 0x35, 0x15, 0xEA, 0x08, 0x37, 0x7C, 0x10, 0x28, 0x78,
+  0x10, 0x72, 0x10, 0x2A, 0xA8, 0x90, 0x8C, 0x4C, 0xC4, 0xC8, 0x04, 0x00, 0x36, 0x15, 0xEA, 0x08,
+  0x37, 0x91, 0x11, 0x09, 0x8A, 0x09, 0x0A, 0x1E, 0x84, 0x1C, 0x84, 0x88, 0x71, 0x26, 0x62, 0x64,
+  0x02, 0x37, 0x10, 0xEA, 0x08, 0x37, 0x3C, 0x30, 0x54, 0x26, 0x28, 0x26, 0x28, 0x26, 0xA8, 0x67,
+  0x00, 0x38, 0x13, 0xEA, 0x08, 0xB7, 0x18, 0x99, 0x88, 0x71, 0x26, 0x62, 0x64, 0x22, 0xC6, 0x99,
+  0x88, 0x91, 0x09, 0x00, 0x39, 0x15, 0xEA, 0x08, 0xB7, 0x18, 0x99, 0x88, 0x71, 0x26, 0x72, 0x10,
+  0x72, 0x10, 0xA8, 0x4C, 0x50, 0x88, 0x8C, 0x08, 0x00, 0x3A, 0x0A, 0xA4, 0x2A, 0x37, 0x3C, 0x10,
+  0x3C, 0x38, 0x10, 0x3B, 0x0D, 0xC4, 0x0A, 0x37, 0x3C, 0x10, 0x3C, 0x08, 0x11, 0x21, 0x11, 0x01,
+  0x3C, 0x12, 0xE8, 0x08, 0xB7, 0x29, 0x12, 0x13, 0x12, 0x13, 0x12, 0x13, 0x14, 0x13, 0x14, 0x13,
+  0x14, 0x13, 0x3D, 0x0B, 0x6A, 0x48, 0x37, 0x3C, 0xB0, 0x87, 0x3A, 0x38, 0x30, 0x3E, 0x14, 0xE8,
+  0x0A, 0x37, 0x88, 0x09, 0x8A, 0x09, 0x8A, 0x09, 0x8A, 0x09, 0x89, 0x09, 0x89, 0x09, 0x89, 0x89,
+  0x01, 0x3F, 0x13, 0xEA, 0x08, 0xB7, 0x18, 0x99, 0x88, 0x91, 0x09, 0x2A, 0x13, 0x14, 0x13, 0x94,
+  0x87, 0x16, 0x14, 0x02, 0x40, 0x19, 0xEA, 0x08, 0xB7, 0x18, 0x99, 0x88, 0x91, 0x09, 0x2A, 0x21,
+  0x11, 0x61, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0xA2, 0xC4, 0xC8, 0x04, 0x00, 0x41, 0x0F, 0xEA,
+  0x08, 0xB7, 0x18, 0x99, 0x88, 0xF1, 0xD9, 0xC1, 0x83, 0x31, 0xCE, 0x04, 0x42, 0x17, 0xEA, 0x08,
+  0x37, 0x1C, 0x84, 0x1C, 0x84, 0x88, 0x71, 0x76, 0x30, 0x72, 0x10, 0x22, 0xC6, 0xD9, 0xC1, 0xC8,
+  0x41, 0x08, 0x00, 0x43, 0x10, 0xEA, 0x08, 0xB7, 0x18, 0x99, 0x88, 0x31, 0xD4, 0x67, 0x64, 0x22,
+  0x46, 0x26, 0x00, 0x44, 0x13, 0xEA, 0x08, 0x37, 0x18, 0x19, 0x29, 0x11, 0x12, 0x11, 0xE3, 0x47,
+  0x22, 0x42, 0x22, 0x46, 0x46, 0x00, 0x45, 0x12, 0xEA, 0x08, 0x37, 0x7C, 0x10, 0xA8, 0xE1, 0x41,
+  0xC8, 0x41, 0x88, 0xA0, 0x86, 0x07, 0x07, 0x06, 0x46, 0x0E, 0xEA, 0x08, 0x37, 0x7C, 0x10, 0xA8,
+  0xA1, 0x91, 0x91, 0xA0, 0x1E, 0x02, 0x47, 0x11, 0xEA, 0x08, 0xB7, 0x18, 0x99, 0x88, 0x31, 0xD4,
+  0x91, 0x33, 0x32, 0x11, 0x23, 0x13, 0x00, 0x48, 0x0D, 0xEA, 0x08, 0x37, 0x88, 0xF1, 0xD9, 0xC1,
+  0x83, 0x31, 0x3E, 0x13, 0x49, 0x0C, 0xE6, 0x0A, 0x37, 0x1C, 0x94, 0x08, 0xE9, 0x9F, 0x1C, 0x14,
+  0x4A, 0x10, 0xEA, 0x08, 0x37, 0x39, 0x13, 0xD4, 0x4F, 0x84, 0x44, 0x84, 0x84, 0xC8, 0x88, 0x00,
+  0x4B, 0x1A, 0xEA, 0x08, 0x37, 0x88, 0x31, 0x12, 0x11, 0x12, 0x51, 0x24, 0x22, 0x44, 0x46, 0x26,
+  0x22, 0x24, 0x22, 0xA4, 0x44, 0x48, 0x44, 0x8C, 0x4C, 0x00, 0x4C, 0x0B, 0xEA, 0x08, 0x37, 0x08,
+  0xEA, 0x7F, 0x78, 0x70, 0x60, 0x4D, 0x12, 0xEA, 0x08, 0x37, 0x88, 0x91, 0x99, 0x1C, 0x84, 0x98,
+  0x88, 0x90, 0x88, 0x90, 0xF1, 0x67, 0x02, 0x4E, 0x12, 0xEA, 0x08, 0x37, 0x88, 0x71, 0x66, 0x64,
+  0x44, 0x22, 0x42, 0x22, 0x42, 0xE4, 0x8C, 0x33, 0x01, 0x4F, 0x0E, 0xEA, 0x08, 0xB7, 0x18, 0x99,
+  0x88, 0xF1, 0x9F, 0x89, 0x18, 0x99, 0x00, 0x50, 0x13, 0xEA, 0x08, 0x37, 0x1C, 0x84, 0x1C, 0x84,
+  0x88, 0x71, 0x76, 0x30, 0x72, 0x10, 0x22, 0xA8, 0x87, 0x00, 0x51, 0x15, 0xEA, 0x08, 0xB7, 0x18,
+  0x99, 0x88, 0xF1, 0x13, 0x11, 0x12, 0x11, 0x22, 0x11, 0x21, 0x21, 0x12, 0x11, 0x12, 0x01, 0x52,
+  0x19, 0xEA, 0x08, 0x37, 0x1C, 0x84, 0x1C, 0x84, 0x88, 0x71, 0x76, 0x30, 0x72, 0x10, 0xA2, 0x48,
+  0x44, 0x48, 0x89, 0x90, 0x88, 0x18, 0x99, 0x00, 0x53, 0x14, 0xEA, 0x08, 0xB7, 0x1C, 0x84, 0x1C,
+  0x0C, 0x6A, 0x6A, 0x64, 0x2A, 0xA8, 0xF0, 0x60, 0xE4, 0x20, 0x04, 0x00, 0x54, 0x0C, 0xEA, 0x08,
+  0x37, 0x3C, 0x30, 0x12, 0xD4, 0xFF, 0x08, 0x00, 0x55, 0x0C, 0xEA, 0x08, 0x37, 0x88, 0xF1, 0x7F,
+  0x26, 0x62, 0x64, 0x02, 0x56, 0x0F, 0xEA, 0x08, 0x37, 0x88, 0xF1, 0x9F, 0x89, 0x28, 0x12, 0x11,
+  0x13, 0x14, 0x02, 0x57, 0x15, 0xEA, 0x08, 0x37, 0x88, 0xF1, 0x13, 0x11, 0x12, 0x11, 0x12, 0x11,
+  0x12, 0x11, 0x93, 0x83, 0x10, 0x33, 0x32, 0x01, 0x58, 0x14, 0xEA, 0x08, 0x37, 0x88, 0x71, 0x26,
+  0xA2, 0x48, 0x44, 0x4C, 0x50, 0x4C, 0x44, 0x48, 0x44, 0x19, 0x67, 0x02, 0x59, 0x0F, 0xEA, 0x08,
+  0x37, 0x88, 0x71, 0x26, 0xA2, 0x48, 0x44, 0x4C, 0x50, 0x3F, 0x02, 0x5A, 0x13, 0xEA, 0x08, 0x37,
+  0x3C, 0x30, 0x54, 0x26, 0x28, 0x26, 0x28, 0x26, 0x28, 0x26, 0x28, 0x78, 0x70, 0x60, 0x5B, 0x0A,
+  0xE6, 0x0A, 0x37, 0x3C, 0xD2, 0x3F, 0x3A, 0x28, 0x5C, 0x0F, 0xAA, 0x28, 0x37, 0x08, 0x8A, 0x0A,
+  0x8A, 0x0A, 0x8A, 0x0A, 0x8A, 0x0A, 0x0A, 0x5D, 0x0B, 0xE6, 0x0A, 0x37, 0x1C, 0x14, 0xE9, 0x1F,
+  0x1D, 0x1C, 0x5E, 0x0D, 0x6A, 0x88, 0x37, 0x09, 0x8A, 0x89, 0x08, 0x89, 0x28, 0x23, 0x13, 0x5F,
+  0x07, 0x2A, 0x08, 0x37, 0x3C, 0x30, 0x60, 0x0B, 0x66, 0x8A, 0x37, 0x08, 0x89, 0x09, 0x89, 0x09,
+  0x09, 0x61, 0x13, 0xAA, 0x08, 0xB7, 0x18, 0x99, 0x0A, 0x8A, 0x1C, 0x84, 0x1C, 0x8C, 0x91, 0x89,
+  0x1C, 0x84, 0x1C, 0x04, 0x62, 0x13, 0xEA, 0x08, 0x37, 0x08, 0xEA, 0x84, 0x44, 0x84, 0x91, 0x11,
+  0x19, 0x67, 0x07, 0x23, 0x07, 0x21, 0x00, 0x63, 0x0F, 0xAA, 0x08, 0xB7, 0x18, 0x99, 0x08, 0xEA,
+  0x8C, 0x4C, 0xC4, 0xC8, 0x04, 0x00, 0x64, 0x11, 0xEA, 0x08, 0x37, 0xEA, 0x84, 0x44, 0x84, 0x91,
+  0x33, 0xCE, 0x44, 0x0E, 0x42, 0x0E, 0x02, 0x65, 0x10, 0xAA, 0x08, 0xB7, 0x18, 0x99, 0x88, 0x91,
+  0x1D, 0x3C, 0x18, 0x14, 0x35, 0x32, 0x01, 0x66, 0x12, 0xEA, 0x08, 0x37, 0x91, 0x11, 0x29, 0x11,
+  0x12, 0x11, 0x14, 0x33, 0x32, 0x13, 0xD4, 0x33, 0x00, 0x67, 0x13, 0xAA, 0x08, 0xB7, 0x1C, 0x84,
+  0x1C, 0x8C, 0x91, 0x89, 0x1C, 0x84, 0x1C, 0x04, 0x2A, 0x22, 0x23, 0x01, 0x68, 0x0F, 0xEA, 0x08,
+  0x37, 0x08, 0xEA, 0x84, 0x44, 0x84, 0x91, 0x11, 0x19, 0x9F, 0x09, 0x69, 0x0D, 0xE6, 0x0A, 0xB7,
+  0x08, 0x89, 0x93, 0x10, 0xE9, 0x93, 0x83, 0x02, 0x6A, 0x11, 0xE8, 0x08, 0xB7, 0xA9, 0x87, 0x22,
+  0x22, 0xD3, 0x8C, 0x88, 0x48, 0x84, 0x88, 0x04, 0x00, 0x6B, 0x10, 0xE8, 0x0A, 0x37, 0x88, 0xE9,
+  0x88, 0x89, 0x26, 0x44, 0x44, 0x22, 0x3A, 0x22, 0x12, 0x6C, 0x0B, 0xE6, 0x0A, 0x37, 0x90, 0x10,
+  0xE9, 0x3F, 0x39, 0x28, 0x6D, 0x13, 0xAA, 0x08, 0x37, 0x90, 0x88, 0x90, 0x68, 0x42, 0x22, 0x42,
+  0x22, 0x42, 0x22, 0x42, 0xC6, 0x99, 0x00, 0x6E, 0x0E, 0xAA, 0x08, 0x37, 0x88, 0x90, 0x88, 0x30,
+  0x32, 0x22, 0xE3, 0x33, 0x01, 0x6F, 0x0E, 0xAA, 0x08, 0xB7, 0x18, 0x99, 0x88, 0xF1, 0x99, 0x88,
+  0x91, 0x09, 0x00, 0x70, 0x12, 0xAA, 0x08, 0x37, 0x1C, 0x84, 0x1C, 0x84, 0x88, 0x91, 0x1D, 0x8C,
+  0x1C, 0x84, 0x08, 0x6A, 0x08, 0x71, 0x10, 0xAA, 0x08, 0xB7, 0x90, 0x88, 0x30, 0x32, 0x22, 0x39,
+  0x08, 0x39, 0x08, 0xD4, 0x01, 0x72, 0x0E, 0xAA, 0x08, 0x37, 0x88, 0x90, 0x88, 0x30, 0x32, 0x22,
+  0xD4, 0x43, 0x00, 0x73, 0x11, 0xAA, 0x08, 0xB7, 0x18, 0x99, 0x08, 0x8A, 0x1A, 0x99, 0x0A, 0x1E,
+  0x8C, 0x1C, 0x84, 0x00, 0x74, 0x12, 0xEA, 0x08, 0xB7, 0x08, 0x6A, 0x66, 0x64, 0x26, 0xA8, 0x23,
+  0x11, 0x21, 0x21, 0x32, 0x12, 0x00, 0x75, 0x0E, 0xAA, 0x08, 0x37, 0x88, 0xF1, 0x23, 0x23, 0x12,
+  0x12, 0x11, 0x12, 0x01, 0x76, 0x0F, 0xAA, 0x08, 0x37, 0x88, 0xF1, 0x99, 0x88, 0x22, 0x11, 0x31,
+  0x41, 0x21, 0x00, 0x77, 0x12, 0xAA, 0x08, 0x37, 0x88, 0xF1, 0x44, 0x84, 0x44, 0x84, 0x44, 0x84,
+  0x44, 0x47, 0x22, 0x22, 0x00, 0x78, 0x13, 0xAA, 0x08, 0x37, 0x88, 0x91, 0x89, 0x28, 0x12, 0x11,
+  0x13, 0x14, 0x13, 0x11, 0x12, 0x51, 0x46, 0x26, 0x79, 0x11, 0xAA, 0x08, 0x37, 0x88, 0x71, 0x26,
+  0x72, 0x10, 0x72, 0x10, 0xA8, 0xC4, 0xC8, 0x04, 0x00, 0x7A, 0x10, 0xAA, 0x08, 0x37, 0x3C, 0x30,
+  0x13, 0x14, 0x13, 0x14, 0x13, 0x14, 0x3B, 0x38, 0x30, 0x7B, 0x0F, 0xE6, 0x0A, 0x37, 0x29, 0x11,
+  0xD2, 0x44, 0x48, 0x4C, 0x48, 0x33, 0x21, 0x01, 0x7C, 0x07, 0xE2, 0x0C, 0x37, 0xFC, 0x00, 0x7D,
+  0x11, 0xE6, 0x0A, 0x37, 0x08, 0x89, 0x09, 0x69, 0x26, 0x24, 0x22, 0xA4, 0x89, 0x90, 0x10, 0x00,
+  0x7E, 0x0E, 0x6A, 0x88, 0xB7, 0x08, 0x8A, 0x89, 0x88, 0x90, 0x28, 0x13, 0x14, 0x01, 0x00, 0x00,
+  0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00
+};
+
+// 95 glyphs, ascent 7, descent 1, advance 6
+const uint8_t u8g2_font_doomalpha04_tr[931] = {
+  0x5F, 0x00, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x06, 0x08, 0x00, 0xFF, 0x07, 0xFF, 0x07,
+  0xFF, 0x01, 0x34, 0x02, 0x68, 0x03, 0x86, 0x20, 0x05, 0x00, 0xD1, 0x01, 0x21, 0x07, 0xB9, 0xD1,
+  0x31, 0x28, 0x01, 0x22, 0x07, 0x5B, 0xD9, 0x91, 0x58, 0x02, 0x23, 0x0E, 0x3D, 0xD1, 0x53, 0x4A,
+  0x92, 0x41, 0xA9, 0x0C, 0x4A, 0x29, 0x49, 0x00, 0x24, 0x0C, 0x3D, 0xD1, 0x95, 0x0D, 0x4A, 0xB6,
+  0x25, 0x83, 0x16, 0x01, 0x25, 0x09, 0x3D, 0xD1, 0xA1, 0x49, 0x59, 0x27, 0x4D, 0x26, 0x0C, 0x3D,
+  0xD1, 0x23, 0x55, 0x6A, 0x95, 0x44, 0x8A, 0x94, 0x00, 0x27, 0x07, 0x5A, 0xD9, 0xA1, 0x28, 0x00,
+  0x28, 0x08, 0x7B, 0xD1, 0x95, 0x94, 0x6A, 0x05, 0x29, 0x09, 0x7B, 0xD1, 0x91, 0x95, 0x2A, 0x25,
+  0x00, 0x2A, 0x0B, 0x2D, 0xD3, 0x53, 0x8B, 0x06, 0x29, 0x4B, 0x12, 0x00, 0x2B, 0x0A, 0x2D, 0xD3,
+  0x15, 0x46, 0x83, 0x14, 0x46, 0x00, 0x2C, 0x07, 0x5A, 0xD1, 0xA1, 0x28, 0x00, 0x2D, 0x06, 0x0D,
+  0xD7, 0x31, 0x08, 0x2E, 0x06, 0x52, 0xD1, 0x31, 0x04, 0x2F, 0x07, 0x2D, 0xD3, 0x99, 0x75, 0x04,
+  0x30, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0xD2, 0x92, 0x4C, 0x5A, 0xB2, 0x00, 0x31, 0x08, 0x7B, 0xD1,
+  0x93, 0x48, 0x5D, 0x06, 0x32, 0x0A, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0xD6, 0x36, 0x08, 0x33, 0x0B,
+  0x3D, 0xD1, 0x31, 0x68, 0xD5, 0x54, 0x4B, 0x16, 0x00, 0x34, 0x0C, 0x3D, 0xD1, 0x97, 0x49, 0x49,
+  0x29, 0x19, 0xB4, 0x30, 0x01, 0x35, 0x0B, 0x3D, 0xD1, 0x71, 0x1C, 0xD2, 0x50, 0x4B, 0x16, 0x00,
+  0x36, 0x0C, 0x3D, 0xD1, 0x25, 0x65, 0xE1, 0x90, 0x64, 0x5A, 0xB2, 0x00, 0x37, 0x09, 0x3D, 0xD1,
+  0x31, 0x88, 0x59, 0x63, 0x0D, 0x38, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x5A, 0xB2, 0x64, 0x5A, 0xB2,
+  0x00, 0x39, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x5A, 0x32, 0x84, 0x59, 0x24, 0x01, 0x3A, 0x08, 0x6A,
+  0xD3, 0x31, 0x44, 0x43, 0x00, 0x3B, 0x08, 0x72, 0xD1, 0x31, 0x44, 0x8A, 0x02, 0x3C, 0x07, 0x3C,
+  0xD1, 0x17, 0x35, 0x36, 0x3D, 0x08, 0x1D, 0xD5, 0x31, 0xA8, 0x83, 0x00, 0x3E, 0x08, 0x7C, 0xD1,
+  0x11, 0x36, 0xB5, 0x01, 0x3F, 0x0B, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0x56, 0x87, 0x22, 0x00, 0x40,
+  0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0x62, 0x49, 0x94, 0xCA, 0x02, 0x41, 0x0B, 0x3D, 0xD1, 0xB3,
+  0x64, 0xB6, 0x61, 0xC8, 0xB4, 0x00, 0x42, 0x0D, 0x3D, 0xD1, 0x31, 0x24, 0x99, 0x36, 0x28, 0x99,
+  0x36, 0x28, 0x00, 0x43, 0x0A, 0x3D, 0xD1, 0xB3, 0x64, 0x62, 0x5B, 0xB2, 0x00, 0x44, 0x0A, 0x3D,
+  0xD1, 0x31, 0x55, 0x32, 0xA7, 0x64, 0x02, 0x45, 0x0B, 0x3D, 0xD1, 0x71, 0x0C, 0x87, 0x24, 0x0C,
+  0x07, 0x01, 0x46, 0x09, 0x3D, 0xD1, 0x71, 0x0C, 0xA7, 0xB0, 0x08, 0x47, 0x0B, 0x3D, 0xD1, 0xB3,
+  0x64, 0x62, 0x69, 0x4B, 0x16, 0x00, 0x48, 0x0A, 0x3D, 0xD1, 0x91, 0xD9, 0x86, 0x21, 0xB3, 0x05,
+  0x49, 0x08, 0x7B, 0xD1, 0xB1, 0x44, 0x5D, 0x06, 0x4A, 0x0A, 0x3D, 0xD1, 0xB5, 0x85, 0x2D, 0x51,
+  0x24, 0x01, 0x4B, 0x0C, 0x3D, 0xD1, 0x91, 0x49, 0x49, 0x49, 0x4B, 0xA2, 0x4A, 0x16, 0x4C, 0x08,
+  0x3D, 0xD1, 0x11, 0xF6, 0x38, 0x08, 0x4D, 0x0A, 0x3D, 0xD1, 0x91, 0x2D, 0x4B, 0xA2, 0xB9, 0x05,
+  0x4E, 0x0B, 0x3D, 0xD1, 0x91, 0x69, 0x93, 0x92, 0x48, 0x9B, 0x16, 0x4F, 0x09, 0x3D, 0xD1, 0xB3,
+  0x64, 0xDE, 0x92, 0x05, 0x50, 0x0B, 0x3D, 0xD1, 0x31, 0x24, 0x99, 0x36, 0x28, 0x61, 0x11, 0x51,
+  0x0B, 0x3D, 0xD1, 0xB3, 0x64, 0x2E, 0x89, 0x14, 0x29, 0x01, 0x52, 0x0C, 0x3D, 0xD1, 0x31, 0x24,
+  0x99, 0x36, 0x28, 0xA5, 0x4A, 0x16, 0x53, 0x0B, 0x3D, 0xD1, 0x33, 0x88, 0xE9, 0x1A, 0x0E, 0x0A,
+  0x00, 0x54, 0x09, 0x3D, 0xD1, 0x31, 0x48, 0x61, 0x4F, 0x00, 0x55, 0x09, 0x3D, 0xD1, 0x91, 0xF9,
+  0x96, 0x2C, 0x00, 0x56, 0x0A, 0x3D, 0xD1, 0x91, 0x79, 0x4B, 0x6A, 0x11, 0x00, 0x57, 0x0A, 0x3D,
+  0xD1, 0x91, 0xB9, 0x24, 0x4A, 0x72, 0x0B, 0x58, 0x0B, 0x3D, 0xD1, 0x91, 0x69, 0x49, 0xAD, 0x52,
+  0xD3, 0x02, 0x59, 0x0A, 0x3D, 0xD1, 0x91, 0x69, 0x49, 0x2D, 0x6C, 0x02, 0x5A, 0x09, 0x3D, 0xD1,
+  0x31, 0x88, 0x59, 0xC7, 0x41, 0x5B, 0x08, 0x7B, 0xD1, 0x31, 0x44, 0x9D, 0x06, 0x5C, 0x06, 0x2D,
+  0xD3, 0x91, 0x76, 0x5D, 0x08, 0x7B, 0xD1, 0x31, 0x75, 0x1A, 0x02, 0x5E, 0x08, 0x1D, 0xD9, 0x95,
+  0x25, 0xB5, 0x00, 0x5F, 0x06, 0x0D, 0xD1, 0x31, 0x08, 0x60, 0x06, 0x5B, 0xD9, 0x91, 0x15, 0x61,
+  0x0A, 0x2D, 0xD1, 0xB3, 0x26, 0x83, 0x96, 0x0C, 0x01, 0x62, 0x0B, 0x3D, 0xD1, 0x11, 0x56, 0x4C,
+  0x9A, 0x36, 0x28, 0x00, 0x63, 0x09, 0x2D, 0xD1, 0xB3, 0x84, 0xB5, 0x64, 0x01, 0x64, 0x0A, 0x3D,
+  0xD1, 0x59, 0x31, 0x6D, 0x5A, 0x32, 0x04, 0x65, 0x0A, 0x2D, 0xD1, 0xB3, 0x64, 0xC3, 0x90, 0x2E,
+  0x00, 0x66, 0x0A, 0x3D, 0xD1, 0x25, 0x55, 0xB2, 0x2D, 0xAC, 0x01, 0x67, 0x0B, 0x2D, 0xD1, 0x33,
+  0x68, 0xC9, 0x10, 0x46, 0x0A, 0x00, 0x68, 0x09, 0x3D, 0xD1, 0x11, 0x56, 0x4C, 0x9A, 0x2D, 0x69,
+  0x08, 0x7B, 0xD1, 0x13, 0x4A, 0x2D, 0x03, 0x6A, 0x0A, 0x3C, 0xD1, 0x17, 0x6B, 0x99, 0x94, 0x28,
+  0x00, 0x6B, 0x0B, 0x7C, 0xD1, 0x91, 0x95, 0x94, 0x44, 0x4A, 0x4A, 0x01, 0x6C, 0x07, 0x7B, 0xD1,
+  0x21, 0xF5, 0x32, 0x6D, 0x0A, 0x2D, 0xD1, 0xA1, 0xB4, 0x28, 0x89, 0xA6, 0x05, 0x6E, 0x09, 0x2D,
+  0xD1, 0x91, 0x98, 0x34, 0x5B, 0x00, 0x6F, 0x09, 0x2D, 0xD1, 0xB3, 0x64, 0xB6, 0x64, 0x01, 0x70,
+  0x0B, 0x2D, 0xD1, 0x31, 0x24, 0xD9, 0xA0, 0x84, 0x21, 0x00, 0x71, 0x09, 0x2D, 0xD1, 0x63, 0x52,
+  0x86, 0xB0, 0x00, 0x72, 0x09, 0x2D, 0xD1, 0x91, 0x98, 0xC4, 0x22, 0x00, 0x73, 0x08, 0x2D, 0xD1,
+  0xB3, 0xA4, 0x07, 0x05, 0x74, 0x0B, 0x3D, 0xD1, 0x13, 0x66, 0x5B, 0x58, 0x8A, 0x14, 0x00, 0x75,
+  0x09, 0x2D, 0xD1, 0x91, 0x39, 0x29, 0x4A, 0x00, 0x76, 0x09, 0x2D, 0xD1, 0x91, 0xD9, 0x92, 0x5A,
+  0x04, 0x77, 0x0A, 0x2D, 0xD1, 0x91, 0x59, 0x12, 0xA5, 0x0B, 0x00, 0x78, 0x09, 0x2D, 0xD1, 0x91,
+  0x25, 0xB5, 0x4A, 0x2D, 0x79, 0x0B, 0x2D, 0xD1, 0x91, 0x69, 0xC9, 0x10, 0x26, 0x0B, 0x00, 0x7A,
+  0x09, 0x2D, 0xD1, 0x31, 0x68, 0x6D, 0x83, 0x00, 0x7B, 0x0A, 0x7B, 0xD1, 0x95, 0x44, 0x49, 0x16,
+  0x65, 0x01, 0x7C, 0x06, 0xB9, 0xD1, 0x71, 0x08, 0x7D, 0x0B, 0x7B, 0xD1, 0x91, 0x45, 0x59, 0x12,
+  0x25, 0x11, 0x00, 0x7E, 0x08, 0x1D, 0xD9, 0x93, 0x25, 0xB5, 0x04, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x00, 0x00
+};
+
+// 95 glyphs, ascent 7, descent 2, advance 6
+const uint8_t u8g2_font_minicute_tr[931] = {
+  0x5F, 0x00, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x06, 0x09, 0x00, 0xFE, 0x07, 0xFE, 0x07,
+  0xFE, 0x01, 0x34, 0x02, 0x68, 0x03, 0x86, 0x20, 0x05, 0x00, 0xD1, 0x01, 0x21, 0x07, 0xB9, 0xD1,
+  0x31, 0x28, 0x01, 0x22, 0x07, 0x5B, 0xD9, 0x91, 0x58, 0x02, 0x23, 0x0E, 0x3D, 0xD1, 0x53, 0x4A,
+  0x92, 0x41, 0xA9, 0x0C, 0x4A, 0x29, 0x49, 0x00, 0x24, 0x0C, 0x3D, 0xD1, 0x95, 0x0D, 0x4A, 0xB6,
+  0x25, 0x83, 0x16, 0x01, 0x25, 0x09, 0x3D, 0xD1, 0xA1, 0x49, 0x59, 0x27, 0x4D, 0x26, 0x0C, 0x3D,
+  0xD1, 0x23, 0x55, 0x6A, 0x95, 0x44, 0x8A, 0x94, 0x00, 0x27, 0x07, 0x5A, 0xD9, 0xA1, 0x28, 0x00,
+  0x28, 0x08, 0x7B, 0xD1, 0x95, 0x94, 0x6A, 0x05, 0x29, 0x09, 0x7B, 0xD1, 0x91, 0x95, 0x2A, 0x25,
+  0x00, 0x2A, 0x0B, 0x2D, 0xD3, 0x53, 0x8B, 0x06, 0x29, 0x4B, 0x12, 0x00, 0x2B, 0x0A, 0x2D, 0xD3,
+  0x15, 0x46, 0x83, 0x14, 0x46, 0x00, 0x2C, 0x07, 0x5A, 0xD1, 0xA1, 0x28, 0x00, 0x2D, 0x06, 0x0D,
+  0xD7, 0x31, 0x08, 0x2E, 0x06, 0x52, 0xD1, 0x31, 0x04, 0x2F, 0x07, 0x2D, 0xD3, 0x99, 0x75, 0x04,
+  0x30, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0xD2, 0x92, 0x4C, 0x5A, 0xB2, 0x00, 0x31, 0x08, 0x7B, 0xD1,
+  0x93, 0x48, 0x5D, 0x06, 0x32, 0x0A, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0xD6, 0x36, 0x08, 0x33, 0x0B,
+  0x3D, 0xD1, 0x31, 0x68, 0xD5, 0x54, 0x4B, 0x16, 0x00, 0x34, 0x0C, 0x3D, 0xD1, 0x97, 0x49, 0x49,
+  0x29, 0x19, 0xB4, 0x30, 0x01, 0x35, 0x0B, 0x3D, 0xD1, 0x71, 0x1C, 0xD2, 0x50, 0x4B, 0x16, 0x00,
+  0x36, 0x0C, 0x3D, 0xD1, 0x25, 0x65, 0xE1, 0x90, 0x64, 0x5A, 0xB2, 0x00, 0x37, 0x09, 0x3D, 0xD1,
+  0x31, 0x88, 0x59, 0x63, 0x0D, 0x38, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x5A, 0xB2, 0x64, 0x5A, 0xB2,
+  0x00, 0x39, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x5A, 0x32, 0x84, 0x59, 0x24, 0x01, 0x3A, 0x08, 0x6A,
+  0xD3, 0x31, 0x44, 0x43, 0x00, 0x3B, 0x08, 0x72, 0xD1, 0x31, 0x44, 0x8A, 0x02, 0x3C, 0x07, 0x3C,
+  0xD1, 0x17, 0x35, 0x36, 0x3D, 0x08, 0x1D, 0xD5, 0x31, 0xA8, 0x83, 0x00, 0x3E, 0x08, 0x7C, 0xD1,
+  0x11, 0x36, 0xB5, 0x01, 0x3F, 0x0B, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0x56, 0x87, 0x22, 0x00, 0x40,
+  0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0x62, 0x49, 0x94, 0xCA, 0x02, 0x41, 0x0B, 0x3D, 0xD1, 0xB3,
+  0x64, 0xB6, 0x61, 0xC8, 0xB4, 0x00, 0x42, 0x0D, 0x3D, 0xD1, 0x31, 0x24, 0x99, 0x36, 0x28, 0x99,
+  0x36, 0x28, 0x00, 0x43, 0x0A, 0x3D, 0xD1, 0xB3, 0x64, 0x62, 0x5B, 0xB2, 0x00, 0x44, 0x0A, 0x3D,
+  0xD1, 0x31, 0x55, 0x32, 0xA7, 0x64, 0x02, 0x45, 0x0B, 0x3D, 0xD1, 0x71, 0x0C, 0x87, 0x24, 0x0C,
+  0x07, 0x01, 0x46, 0x09, 0x3D, 0xD1, 0x71, 0x0C, 0xA7, 0xB0, 0x08, 0x47, 0x0B, 0x3D, 0xD1, 0xB3,
+  0x64, 0x62, 0x69, 0x4B, 0x16, 0x00, 0x48, 0x0A, 0x3D, 0xD1, 0x91, 0xD9, 0x86, 0x21, 0xB3, 0x05,
+  0x49, 0x08, 0x7B, 0xD1, 0xB1, 0x44, 0x5D, 0x06, 0x4A, 0x0A, 0x3D, 0xD1, 0xB5, 0x85, 0x2D, 0x51,
+  0x24, 0x01, 0x4B, 0x0C, 0x3D, 0xD1, 0x91, 0x49, 0x49, 0x49, 0x4B, 0xA2, 0x4A, 0x16, 0x4C, 0x08,
+  0x3D, 0xD1, 0x11, 0xF6, 0x38, 0x08, 0x4D, 0x0A, 0x3D, 0xD1, 0x91, 0x2D, 0x4B, 0xA2, 0xB9, 0x05,
+  0x4E, 0x0B, 0x3D, 0xD1, 0x91, 0x69, 0x93, 0x92, 0x48, 0x9B, 0x16, 0x4F, 0x09, 0x3D, 0xD1, 0xB3,
+  0x64, 0xDE, 0x92, 0x05, 0x50, 0x0B, 0x3D, 0xD1, 0x31, 0x24, 0x99, 0x36, 0x28, 0x61, 0x11, 0x51,
+  0x0B, 0x3D, 0xD1, 0xB3, 0x64, 0x2E, 0x89, 0x14, 0x29, 0x01, 0x52, 0x0C, 0x3D, 0xD1, 0x31, 0x24,
+  0x99, 0x36, 0x28, 0xA5, 0x4A, 0x16, 0x53, 0x0B, 0x3D, 0xD1, 0x33, 0x88, 0xE9, 0x1A, 0x0E, 0x0A,
+  0x00, 0x54, 0x09, 0x3D, 0xD1, 0x31, 0x48, 0x61, 0x4F, 0x00, 0x55, 0x09, 0x3D, 0xD1, 0x91, 0xF9,
+  0x96, 0x2C, 0x00, 0x56, 0x0A, 0x3D, 0xD1, 0x91, 0x79, 0x4B, 0x6A, 0x11, 0x00, 0x57, 0x0A, 0x3D,
+  0xD1, 0x91, 0xB9, 0x24, 0x4A, 0x72, 0x0B, 0x58, 0x0B, 0x3D, 0xD1, 0x91, 0x69, 0x49, 0xAD, 0x52,
+  0xD3, 0x02, 0x59, 0x0A, 0x3D, 0xD1, 0x91, 0x69, 0x49, 0x2D, 0x6C, 0x02, 0x5A, 0x09, 0x3D, 0xD1,
+  0x31, 0x88, 0x59, 0xC7, 0x41, 0x5B, 0x08, 0x7B, 0xD1, 0x31, 0x44, 0x9D, 0x06, 0x5C, 0x06, 0x2D,
+  0xD3, 0x91, 0x76, 0x5D, 0x08, 0x7B, 0xD1, 0x31, 0x75, 0x1A, 0x02, 0x5E, 0x08, 0x1D, 0xD9, 0x95,
+  0x25, 0xB5, 0x00, 0x5F, 0x06, 0x0D, 0xD1, 0x31, 0x08, 0x60, 0x06, 0x5B, 0xD9, 0x91, 0x15, 0x61,
+  0x0A, 0x2D, 0xD1, 0xB3, 0x26, 0x83, 0x96, 0x0C, 0x01, 0x62, 0x0B, 0x3D, 0xD1, 0x11, 0x56, 0x4C,
+  0x9A, 0x36, 0x28, 0x00, 0x63, 0x09, 0x2D, 0xD1, 0xB3, 0x84, 0xB5, 0x64, 0x01, 0x64, 0x0A, 0x3D,
+  0xD1, 0x59, 0x31, 0x6D, 0x5A, 0x32, 0x04, 0x65, 0x0A, 0x2D, 0xD1, 0xB3, 0x64, 0xC3, 0x90, 0x2E,
+  0x00, 0x66, 0x0A, 0x3D, 0xD1, 0x25, 0x55, 0xB2, 0x2D, 0xAC, 0x01, 0x67, 0x0B, 0x2D, 0xD1, 0x33,
+  0x68, 0xC9, 0x10, 0x46, 0x0A, 0x00, 0x68, 0x09, 0x3D, 0xD1, 0x11, 0x56, 0x4C, 0x9A, 0x2D, 0x69,
+  0x08, 0x7B, 0xD1, 0x13, 0x4A, 0x2D, 0x03, 0x6A, 0x0A, 0x3C, 0xD1, 0x17, 0x6B, 0x99, 0x94, 0x28,
+  0x00, 0x6B, 0x0B, 0x7C, 0xD1, 0x91, 0x95, 0x94, 0x44, 0x4A, 0x4A, 0x01, 0x6C, 0x07, 0x7B, 0xD1,
+  0x21, 0xF5, 0x32, 0x6D, 0x0A, 0x2D, 0xD1, 0xA1, 0xB4, 0x28, 0x89, 0xA6, 0x05, 0x6E, 0x09, 0x2D,
+  0xD1, 0x91, 0x98, 0x34, 0x5B, 0x00, 0x6F, 0x09, 0x2D, 0xD1, 0xB3, 0x64, 0xB6, 0x64, 0x01, 0x70,
+  0x0B, 0x2D, 0xD1, 0x31, 0x24, 0xD9, 0xA0, 0x84, 0x21, 0x00, 0x71, 0x09, 0x2D, 0xD1, 0x63, 0x52,
+  0x86, 0xB0, 0x00, 0x72, 0x09, 0x2D, 0xD1, 0x91, 0x98, 0xC4, 0x22, 0x00, 0x73, 0x08, 0x2D, 0xD1,
+  0xB3, 0xA4, 0x07, 0x05, 0x74, 0x0B, 0x3D, 0xD1, 0x13, 0x66, 0x5B, 0x58, 0x8A, 0x14, 0x00, 0x75,
+  0x09, 0x2D, 0xD1, 0x91, 0x39, 0x29, 0x4A, 0x00, 0x76, 0x09, 0x2D, 0xD1, 0x91, 0xD9, 0x92, 0x5A,
+  0x04, 0x77, 0x0A, 0x2D, 0xD1, 0x91, 0x59, 0x12, 0xA5, 0x0B, 0x00, 0x78, 0x09, 0x2D, 0xD1, 0x91,
+  0x25, 0xB5, 0x4A, 0x2D, 0x79, 0x0B, 0x2D, 0xD1, 0x91, 0x69, 0xC9, 0x10, 0x26, 0x0B, 0x00, 0x7A,
+  0x09, 0x2D, 0xD1, 0x31, 0x68, 0x6D, 0x83, 0x00, 0x7B, 0x0A, 0x7B, 0xD1, 0x95, 0x44, 0x49, 0x16,
+  0x65, 0x01, 0x7C, 0x06, 0xB9, 0xD1, 0x71, 0x08, 0x7D, 0x0B, 0x7B, 0xD1, 0x91, 0x45, 0x59, 0x12,
+  0x25, 0x11, 0x00, 0x7E, 0x08, 0x1D, 0xD9, 0x93, 0x25, 0xB5, 0x04, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x00, 0x00
+};
+
+// 95 glyphs, ascent 7, descent 1, advance 6
+const uint8_t u8g2_font_simple1_tr[931] = {
+  0x5F, 0x00, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x06, 0x08, 0x00, 0xFF, 0x07, 0xFF, 0x07,
+  0xFF, 0x01, 0x34, 0x02, 0x68, 0x03, 0x86, 0x20, 0x05, 0x00, 0xD1, 0x01, 0x21, 0x07, 0xB9, 0xD1,
+  0x31, 0x28, 0x01, 0x22, 0x07, 0x5B, 0xD9, 0x91, 0x58, 0x02, 0x23, 0x0E, 0x3D, 0xD1, 0x53, 0x4A,
+  0x92, 0x41, 0xA9, 0x0C, 0x4A, 0x29, 0x49, 0x00, 0x24, 0x0C, 0x3D, 0xD1, 0x95, 0x0D, 0x4A, 0xB6,
+  0x25, 0x83, 0x16, 0x01, 0x25, 0x09, 0x3D, 0xD1, 0xA1, 0x49, 0x59, 0x27, 0x4D, 0x26, 0x0C, 0x3D,
+  0xD1, 0x23, 0x55, 0x6A, 0x95, 0x44, 0x8A, 0x94, 0x00, 0x27, 0x07, 0x5A, 0xD9, 0xA1, 0x28, 0x00,
+  0x28, 0x08, 0x7B, 0xD1, 0x95, 0x94, 0x6A, 0x05, 0x29, 0x09, 0x7B, 0xD1, 0x91, 0x95, 0x2A, 0x25,
+  0x00, 0x2A, 0x0B, 0x2D, 0xD3, 0x53, 0x8B, 0x06, 0x29, 0x4B, 0x12, 0x00, 0x2B, 0x0A, 0x2D, 0xD3,
+  0x15, 0x46, 0x83, 0x14, 0x46, 0x00, 0x2C, 0x07, 0x5A, 0xD1, 0xA1, 0x28, 0x00, 0x2D, 0x06, 0x0D,
+  0xD7, 0x31, 0x08, 0x2E, 0x06, 0x52, 0xD1, 0x31, 0x04, 0x2F, 0x07, 0x2D, 0xD3, 0x99, 0x75, 0x04,
+  0x30, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0xD2, 0x92, 0x4C, 0x5A, 0xB2, 0x00, 0x31, 0x08, 0x7B, 0xD1,
+  0x93, 0x48, 0x5D, 0x06, 0x32, 0x0A, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0xD6, 0x36, 0x08, 0x33, 0x0B,
+  0x3D, 0xD1, 0x31, 0x68, 0xD5, 0x54, 0x4B, 0x16, 0x00, 0x34, 0x0C, 0x3D, 0xD1, 0x97, 0x49, 0x49,
+  0x29, 0x19, 0xB4, 0x30, 0x01, 0x35, 0x0B, 0x3D, 0xD1, 0x71, 0x1C, 0xD2, 0x50, 0x4B, 0x16, 0x00,
+  0x36, 0x0C, 0x3D, 0xD1, 0x25, 0x65, 0xE1, 0x90, 0x64, 0x5A, 0xB2, 0x00, 0x37, 0x09, 0x3D, 0xD1,
+  0x31, 0x88, 0x59, 0x63, 0x0D, 0x38, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x5A, 0xB2, 0x64, 0x5A, 0xB2,
+  0x00, 0x39, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x5A, 0x32, 0x84, 0x59, 0x24, 0x01, 0x3A, 0x08, 0x6A,
+  0xD3, 0x31, 0x44, 0x43, 0x00, 0x3B, 0x08, 0x72, 0xD1, 0x31, 0x44, 0x8A, 0x02, 0x3C, 0x07, 0x3C,
+  0xD1, 0x17, 0x35, 0x36, 0x3D, 0x08, 0x1D, 0xD5, 0x31, 0xA8, 0x83, 0x00, 0x3E, 0x08, 0x7C, 0xD1,
+  0x11, 0x36, 0xB5, 0x01, 0x3F, 0x0B, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0x56, 0x87, 0x22, 0x00, 0x40,
+  0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0x62, 0x49, 0x94, 0xCA, 0x02, 0x41, 0x0B, 0x3D, 0xD1, 0xB3,
+  0x64, 0xB6, 0x61, 0xC8, 0xB4, 0x00, 0x42, 0x0D, 0x3D, 0xD1, 0x31, 0x24, 0x99, 0x36, 0x28, 0x99,
+  0x36, 0x28, 0x00, 0x43, 0x0A, 0x3D, 0xD1, 0xB3, 0x64, 0x62, 0x5B, 0xB2, 0x00, 0x44, 0x0A, 0x3D,
+  0xD1, 0x31, 0x55, 0x32, 0xA7, 0x64, 0x02, 0x45, 0x0B, 0x3D, 0xD1, 0x71, 0x0C, 0x87, 0x24, 0x0C,
+  0x07, 0x01, 0x46, 0x09, 0x3D, 0xD1, 0x71, 0x0C, 0xA7, 0xB0, 0x08, 0x47, 0x0B, 0x3D, 0xD1, 0xB3,
+  0x64, 0x62, 0x69, 0x4B, 0x16, 0x00, 0x48, 0x0A, 0x3D, 0xD1, 0x91, 0xD9, 0x86, 0x21, 0xB3, 0x05,
+  0x49, 0x08, 0x7B, 0xD1, 0xB1, 0x44, 0x5D, 0x06, 0x4A, 0x0A, 0x3D, 0xD1, 0xB5, 0x85, 0x2D, 0x51,
+  0x24, 0x01, 0x4B, 0x0C, 0x3D, 0xD1, 0x91, 0x49, 0x49, 0x49, 0x4B, 0xA2, 0x4A, 0x16, 0x4C, 0x08,
+  0x3D, 0xD1, 0x11, 0xF6, 0x38, 0x08, 0x4D, 0x0A, 0x3D, 0xD1, 0x91, 0x2D, 0x4B, 0xA2, 0xB9, 0x05,
+  0x4E, 0x0B, 0x3D, 0xD1, 0x91, 0x69, 0x93, 0x92, 0x48, 0x9B, 0x16, 0x4F, 0x09, 0x3D, 0xD1, 0xB3,
+  0x64, 0xDE, 0x92, 0x05, 0x50, 0x0B, 0x3D, 0xD1, 0x31, 0x24, 0x99, 0x36, 0x28, 0x61, 0x11, 0x51,
+  0x0B, 0x3D, 0xD1, 0xB3, 0x64, 0x2E, 0x89, 0x14, 0x29, 0x01, 0x52, 0x0C, 0x3D, 0xD1, 0x31, 0x24,
+  0x99, 0x36, 0x28, 0xA5, 0x4A, 0x16, 0x53, 0x0B, 0x3D, 0xD1, 0x33, 0x88, 0xE9, 0x1A, 0x0E, 0x0A,
+  0x00, 0x54, 0x09, 0x3D, 0xD1, 0x31, 0x48, 0x61, 0x4F, 0x00, 0x55, 0x09, 0x3D, 0xD1, 0x91, 0xF9,
+  0x96, 0x2C, 0x00, 0x56, 0x0A, 0x3D, 0xD1, 0x91, 0x79, 0x4B, 0x6A, 0x11, 0x00, 0x57, 0x0A, 0x3D,
+  0xD1, 0x91, 0xB9, 0x24, 0x4A, 0x72, 0x0B, 0x58, 0x0B, 0x3D, 0xD1, 0x91, 0x69, 0x49, 0xAD, 0x52,
+  0xD3, 0x02, 0x59, 0x0A, 0x3D, 0xD1, 0x91, 0x69, 0x49, 0x2D, 0x6C, 0x02, 0x5A, 0x09, 0x3D, 0xD1,
+  0x31, 0x88, 0x59, 0xC7, 0x41, 0x5B, 0x08, 0x7B, 0xD1, 0x31, 0x44, 0x9D, 0x06, 0x5C, 0x06, 0x2D,
+  0xD3, 0x91, 0x76, 0x5D, 0x08, 0x7B, 0xD1, 0x31, 0x75, 0x1A, 0x02, 0x5E, 0x08, 0x1D, 0xD9, 0x95,
+  0x25, 0xB5, 0x00, 0x5F, 0x06, 0x0D, 0xD1, 0x31, 0x08, 0x60, 0x06, 0x5B, 0xD9, 0x91, 0x15, 0x61,
+  0x0A, 0x2D, 0xD1, 0xB3, 0x26, 0x83, 0x96, 0x0C, 0x01, 0x62, 0x0B, 0x3D, 0xD1, 0x11, 0x56, 0x4C,
+  0x9A, 0x36, 0x28, 0x00, 0x63, 0x09, 0x2D, 0xD1, 0xB3, 0x84, 0xB5, 0x64, 0x01, 0x64, 0x0A, 0x3D,
+  0xD1, 0x59, 0x31, 0x6D, 0x5A, 0x32, 0x04, 0x65, 0x0A, 0x2D, 0xD1, 0xB3, 0x64, 0xC3, 0x90, 0x2E,
+  0x00, 0x66, 0x0A, 0x3D, 0xD1, 0x25, 0x55, 0xB2, 0x2D, 0xAC, 0x01, 0x67, 0x0B, 0x2D, 0xD1, 0x33,
+  0x68, 0xC9, 0x10, 0x46, 0x0A, 0x00, 0x68, 0x09, 0x3D, 0xD1, 0x11, 0x56, 0x4C, 0x9A, 0x2D, 0x69,
+  0x08, 0x7B, 0xD1, 0x13, 0x4A, 0x2D, 0x03, 0x6A, 0x0A, 0x3C, 0xD1, 0x17, 0x6B, 0x99, 0x94, 0x28,
+  0x00, 0x6B, 0x0B, 0x7C, 0xD1, 0x91, 0x95, 0x94, 0x44, 0x4A, 0x4A, 0x01, 0x6C, 0x07, 0x7B, 0xD1,
+  0x21, 0xF5, 0x32, 0x6D, 0x0A, 0x2D, 0xD1, 0xA1, 0xB4, 0x28, 0x89, 0xA6, 0x05, 0x6E, 0x09, 0x2D,
+  0xD1, 0x91, 0x98, 0x34, 0x5B, 0x00, 0x6F, 0x09, 0x2D, 0xD1, 0xB3, 0x64, 0xB6, 0x64, 0x01, 0x70,
+  0x0B, 0x2D, 0xD1, 0x31, 0x24, 0xD9, 0xA0, 0x84, 0x21, 0x00, 0x71, 0x09, 0x2D, 0xD1, 0x63, 0x52,
+  0x86, 0xB0, 0x00, 0x72, 0x09, 0x2D, 0xD1, 0x91, 0x98, 0xC4, 0x22, 0x00, 0x73, 0x08, 0x2D, 0xD1,
+  0xB3, 0xA4, 0x07, 0x05, 0x74, 0x0B, 0x3D, 0xD1, 0x13, 0x66, 0x5B, 0x58, 0x8A, 0x14, 0x00, 0x75,
+  0x09, 0x2D, 0xD1, 0x91, 0x39, 0x29, 0x4A, 0x00, 0x76, 0x09, 0x2D, 0xD1, 0x91, 0xD9, 0x92, 0x5A,
+  0x04, 0x77, 0x0A, 0x2D, 0xD1, 0x91, 0x59, 0x12, 0xA5, 0x0B, 0x00, 0x78, 0x09, 0x2D, 0xD1, 0x91,
+  0x25, 0xB5, 0x4A, 0x2D, 0x79, 0x0B, 0x2D, 0xD1, 0x91, 0x69, 0xC9, 0x10, 0x26, 0x0B, 0x00, 0x7A,
+  0x09, 0x2D, 0xD1, 0x31, 0x68, 0x6D, 0x83, 0x00, 0x7B, 0x0A, 0x7B, 0xD1, 0x95, 0x44, 0x49, 0x16,
+  0x65, 0x01, 0x7C, 0x06, 0xB9, 0xD1, 0x71, 0x08, 0x7D, 0x0B, 0x7B, 0xD1, 0x91, 0x45, 0x59, 0x12,
+  0x25, 0x11, 0x00, 0x7E, 0x08, 0x1D, 0xD9, 0x93, 0x25, 0xB5, 0x04, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x00, 0x00
+};
+
+// 95 glyphs, ascent 7, descent 1, advance 6
+const uint8_t u8g2_font_iconquadpix_m_all[931] = {
+  0x5F, 0x00, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x06, 0x08, 0x00, 0xFF, 0x07, 0xFF, 0x07,
+  0xFF, 0x01, 0x34, 0x02, 0x68, 0x03, 0x86, 0x20, 0x05, 0x00, 0xD1, 0x01, 0x21, 0x07, 0xB9, 0xD1,
+  0x31, 0x28, 0x01, 0x22, 0x07, 0x5B, 0xD9, 0x91, 0x58, 0x02, 0x23, 0x0E, 0x3D, 0xD1, 0x53, 0x4A,
+  0x92, 0x41, 0xA9, 0x0C, 0x4A, 0x29, 0x49, 0x00, 0x24, 0x0C, 0x3D, 0xD1, 0x95, 0x0D, 0x4A, 0xB6,
+  0x25, 0x83, 0x16, 0x01, 0x25, 0x09, 0x3D, 0xD1, 0xA1, 0x49, 0x59, 0x27, 0x4D, 0x26, 0x0C, 0x3D,
+  0xD1, 0x23, 0x55, 0x6A, 0x95, 0x44, 0x8A, 0x94, 0x00, 0x27, 0x07, 0x5A, 0xD9, 0xA1, 0x28, 0x00,
+  0x28, 0x08, 0x7B, 0xD1, 0x95, 0x94, 0x6A, 0x05, 0x29, 0x09, 0x7B, 0xD1, 0x91, 0x95, 0x2A, 0x25,
+  0x00, 0x2A, 0x0B, 0x2D, 0xD3, 0x53, 0x8B, 0x06, 0x29, 0x4B, 0x12, 0x00, 0x2B, 0x0A, 0x2D, 0xD3,
+  0x15, 0x46, 0x83, 0x14, 0x46, 0x00, 0x2C, 0x07, 0x5A, 0xD1, 0xA1, 0x28, 0x00, 0x2D, 0x06, 0x0D,
+  0xD7, 0x31, 0x08, 0x2E, 0x06, 0x52, 0xD1, 0x31, 0x04, 0x2F, 0x07, 0x2D, 0xD3, 0x99, 0x75, 0x04,
+  0x30, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0xD2, 0x92, 0x4C, 0x5A, 0xB2, 0x00, 0x31, 0x08, 0x7B, 0xD1,
+  0x93, 0x48, 0x5D, 0x06, 0x32, 0x0A, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0xD6, 0x36, 0x08, 0x33, 0x0B,
+  0x3D, 0xD1, 0x31, 0x68, 0xD5, 0x54, 0x4B, 0x16, 0x00, 0x34, 0x0C, 0x3D, 0xD1, 0x97, 0x49, 0x49,
+  0x29, 0x19, 0xB4, 0x30, 0x01, 0x35, 0x0B, 0x3D, 0xD1, 0x71, 0x1C, 0xD2, 0x50, 0x4B, 0x16, 0x00,
+  0x36, 0x0C, 0x3D, 0xD1, 0x25, 0x65, 0xE1, 0x90, 0x64, 0x5A, 0xB2, 0x00, 0x37, 0x09, 0x3D, 0xD1,
+  0x31, 0x88, 0x59, 0x63, 0x0D, 0x38, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x5A, 0xB2, 0x64, 0x5A, 0xB2,
+  0x00, 0x39, 0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x5A, 0x32, 0x84, 0x59, 0x24, 0x01, 0x3A, 0x08, 0x6A,
+  0xD3, 0x31, 0x44, 0x43, 0x00, 0x3B, 0x08, 0x72, 0xD1, 0x31, 0x44, 0x8A, 0x02, 0x3C, 0x07, 0x3C,
+  0xD1, 0x17, 0x35, 0x36, 0x3D, 0x08, 0x1D, 0xD5, 0x31, 0xA8, 0x83, 0x00, 0x3E, 0x08, 0x7C, 0xD1,
+  0x11, 0x36, 0xB5, 0x01, 0x3F, 0x0B, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0x56, 0x87, 0x22, 0x00, 0x40,
+  0x0C, 0x3D, 0xD1, 0xB3, 0x64, 0x61, 0x62, 0x49, 0x94, 0xCA, 0x02, 0x41, 0x0B, 0x3D, 0xD1, 0xB3,
+  0x64, 0xB6, 0x61, 0xC8, 0xB4, 0x00, 0x42, 0x0D, 0x3D, 0xD1, 0x31, 0x24, 0x99, 0x36, 0x28, 0x99,
+  0x36, 0x28, 0x00, 0x43, 0x0A, 0x3D, 0xD1, 0xB3, 0x64, 0x62, 0x5B, 0xB2, 0x00, 0x44, 0x0A, 0x3D,
+  0xD1, 0x31, 0x55, 0x32, 0xA7, 0x64, 0x02, 0x45, 0x0B, 0x3D, 0xD1, 0x71, 0x0C, 0x87, 0x24, 0x0C,
+  0x07, 0x01, 0x46, 0x09, 0x3D, 0xD1, 0x71, 0x0C, 0xA7, 0xB0, 0x08, 0x47, 0x0B, 0x3D, 0xD1, 0xB3,
+  0x64, 0x62, 0x69, 0x4B, 0x16, 0x00, 0x48, 0x0A, 0x3D, 0xD1, 0x91, 0xD9, 0x86, 0x21, 0xB3, 0x05,
+  0x49, 0x08, 0x7B, 0xD1, 0xB1, 0x44, 0x5D, 0x06, 0x4A, 0x0A, 0x3D, 0xD1, 0xB5, 0x85, 0x2D, 0x51,
+  0x24, 0x01, 0x4B, 0x0C, 0x3D, 0xD1, 0x91, 0x49, 0x49, 0x49, 0x4B, 0xA2, 0x4A, 0x16, 0x4C, 0x08,
+  0x3D, 0xD1, 0x11, 0xF6, 0x38, 0x08, 0x4D, 0x0A, 0x3D, 0xD1, 0x91, 0x2D, 0x4B, 0xA2, 0xB9, 0x05,
+  0x4E, 0x0B, 0x3D, 0xD1, 0x91, 0x69, 0x93, 0x92, 0x48, 0x9B, 0x16, 0x4F, 0x09, 0x3D, 0xD1, 0xB3,
+  0x64, 0xDE, 0x92, 0x05, 0x50, 0x0B, 0x3D, 0xD1, 0x31, 0x24, 0x99, 0x36, 0x28, 0x61, 0x11, 0x51,
+  0x0B, 0x3D, 0xD1, 0xB3, 0x64, 0x2E, 0x89, 0x14, 0x29, 0x01, 0x52, 0x0C, 0x3D, 0xD1, 0x31, 0x24,
+  0x99, 0x36, 0x28, 0xA5, 0x4A, 0x16, 0x53, 0x0B, 0x3D, 0xD1, 0x33, 0x88, 0xE9, 0x1A, 0x0E, 0x0A,
+  0x00, 0x54, 0x09, 0x3D, 0xD1, 0x31, 0x48, 0x61, 0x4F, 0x00, 0x55, 0x09, 0x3D, 0xD1, 0x91, 0xF9,
+  0x96, 0x2C, 0x00, 0x56, 0x0A, 0x3D, 0xD1, 0x91, 0x79, 0x4B, 0x6A, 0x11, 0x00, 0x57, 0x0A, 0x3D,
+  0xD1, 0x91, 0xB9, 0x24, 0x4A, 0x72, 0x0B, 0x58, 0x0B, 0x3D, 0xD1, 0x91, 0x69, 0x49, 0xAD, 0x52,
+  0xD3, 0x02, 0x59, 0x0A, 0x3D, 0xD1, 0x91, 0x69, 0x49, 0x2D, 0x6C, 0x02, 0x5A, 0x09, 0x3D, 0xD1,
+  0x31, 0x88, 0x59, 0xC7, 0x41, 0x5B, 0x08, 0x7B, 0xD1, 0x31, 0x44, 0x9D, 0x06, 0x5C, 0x06, 0x2D,
+  0xD3, 0x91, 0x76, 0x5D, 0x08, 0x7B, 0xD1, 0x31, 0x75, 0x1A, 0x02, 0x5E, 0x08, 0x1D, 0xD9, 0x95,
+  0x25, 0xB5, 0x00, 0x5F, 0x06, 0x0D, 0xD1, 0x31, 0x08, 0x60, 0x06, 0x5B, 0xD9, 0x91, 0x15, 0x61,
+  0x0A, 0x2D, 0xD1, 0xB3, 0x26, 0x83, 0x96, 0x0C, 0x01, 0x62, 0x0B, 0x3D, 0xD1, 0x11, 0x56, 0x4C,
+  0x9A, 0x36, 0x28, 0x00, 0x63, 0x09, 0x2D, 0xD1, 0xB3, 0x84, 0xB5, 0x64, 0x01, 0x64, 0x0A, 0x3D,
+  0xD1, 0x59, 0x31, 0x6D, 0x5A, 0x32, 0x04, 0x65, 0x0A, 0x2D, 0xD1, 0xB3, 0x64, 0xC3, 0x90, 0x2E,
+  0x00, 0x66, 0x0A, 0x3D, 0xD1, 0x25, 0x55, 0xB2, 0x2D, 0xAC, 0x01, 0x67, 0x0B, 0x2D, 0xD1, 0x33,
+  0x68, 0xC9, 0x10, 0x46, 0x0A, 0x00, 0x68, 0x09, 0x3D, 0xD1, 0x11, 0x56, 0x4C, 0x9A, 0x2D, 0x69,
+  0x08, 0x7B, 0xD1, 0x13, 0x4A, 0x2D, 0x03, 0x6A, 0x0A, 0x3C, 0xD1, 0x17, 0x6B, 0x99, 0x94, 0x28,
+  0x00, 0x6B, 0x0B, 0x7C, 0xD1, 0x91, 0x95, 0x94, 0x44, 0x4A, 0x4A, 0x01, 0x6C, 0x07, 0x7B, 0xD1,
+  0x21, 0xF5, 0x32, 0x6D, 0x0A, 0x2D, 0xD1, 0xA1, 0xB4, 0x28, 0x89, 0xA6, 0x05, 0x6E, 0x09, 0x2D,
+  0xD1, 0x91, 0x98, 0x34, 0x5B, 0x00, 0x6F, 0x09, 0x2D, 0xD1, 0xB3, 0x64, 0xB6, 0x64, 0x01, 0x70,
+  0x0B, 0x2D, 0xD1, 0x31, 0x24, 0xD9, 0xA0, 0x84, 0x21, 0x00, 0x71, 0x09, 0x2D, 0xD1, 0x63, 0x52,
+  0x86, 0xB0, 0x00, 0x72, 0x09, 0x2D, 0xD1, 0x91, 0x98, 0xC4, 0x22, 0x00, 0x73, 0x08, 0x2D, 0xD1,
+  0xB3, 0xA4, 0x07, 0x05, 0x74, 0x0B, 0x3D, 0xD1, 0x13, 0x66, 0x5B, 0x58, 0x8A, 0x14, 0x00, 0x75,
+  0x09, 0x2D, 0xD1, 0x91, 0x39, 0x29, 0x4A, 0x00, 0x76, 0x09, 0x2D, 0xD1, 0x91, 0xD9, 0x92, 0x5A,
+  0x04, 0x77, 0x0A, 0x2D, 0xD1, 0x91, 0x59, 0x12, 0xA5, 0x0B, 0x00, 0x78, 0x09, 0x2D, 0xD1, 0x91,
+  0x25, 0xB5, 0x4A, 0x2D, 0x79, 0x0B, 0x2D, 0xD1, 0x91, 0x69, 0xC9, 0x10, 0x26, 0x0B, 0x00, 0x7A,
+  0x09, 0x2D, 0xD1, 0x31, 0x68, 0x6D, 0x83, 0x00, 0x7B, 0x0A, 0x7B, 0xD1, 0x95, 0x44, 0x49, 0x16,
+  0x65, 0x01, 0x7C, 0x06, 0xB9, 0xD1, 0x71, 0x08, 0x7D, 0x0B, 0x7B, 0xD1, 0x91, 0x45, 0x59, 0x12,
+  0x25, 0x11, 0x00, 0x7E, 0x08, 0x1D, 0xD9, 0x93, 0x25, 0xB5, 0x04, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x00, 0x00
+};
\ No newline at end of file
@@ -0,0 +1,552 @@
+#include "U8g2lib.h"
+#include "HostHal.h"
+
+static const u8g2_cb_t rotationR0 = {0};
+const u8g2_cb_t* U8G2_R0 = &rotationR0;
+
+// Quadrants for the circle helpers
+#define QUAD_UPPER_RIGHT 0x01
+#define QUAD_UPPER_LEFT 0x02
+#define QUAD_LOWER_LEFT 0x04
+#define QUAD_LOWER_RIGHT 0x08
+#define QUAD_ALL 0x0F
+
+// SSD1306 addressing preamble per tile run: address, control byte and the
+// column/page commands
+#define DRAW_TILE_OVERHEAD 5
+
+// ---- C interface ----
+
+void u8g2_Setup_ssd1306_i2c_128x64_noname_f(u8g2_t* u8g2, const u8g2_cb_t* rotation,
+                                            u8x8_msg_cb byteCb, u8x8_msg_cb gpioCb) {
+  // Like u8g2, every instance of this setup shares one static buffer
+  static uint8_t buffer[U8G2_HOST_WIDTH * U8G2_HOST_PAGES];
+  memset(&u8g2->u8x8, 0, sizeof(u8g2->u8x8));
+  u8g2->u8x8.byteCb = byteCb;
+  u8g2->u8x8.gpioCb = gpioCb;
+  u8g2->u8x8.i2c_address = 0x78;
+  u8g2->u8x8.clockPin = U8X8_PIN_NONE;
+  u8g2->u8x8.dataPin = U8X8_PIN_NONE;
+  u8g2->u8x8.resetPin = U8X8_PIN_NONE;
+  u8g2->tile_buf_ptr = buffer;
+}
+
+static uint8_t chargeI2c(uint8_t msg, uint8_t argInt, uint32_t bitsPerSecond) {
+  switch (msg) {
+    case U8X8_MSG_BYTE_START_TRANSFER:
+      hostHal.chargeBus(1, bitsPerSecond);  // address byte
+      break;
+    case U8X8_MSG_BYTE_SEND:
+      hostHal.chargeBus(argInt, bitsPerSecond);
+      break;
+  }
+  return 1;
+}
+
+uint8_t u8x8_byte_arduino_sw_i2c(u8x8_t* u8x8, uint8_t msg, uint8_t argInt, void* argPtr) {
+  return chargeI2c(msg, argInt, U8G2_HOST_SW_I2C_BITRATE);
+}
+
+uint8_t u8x8_byte_arduino_hw_i2c(u8x8_t* u8x8, uint8_t msg, uint8_t argInt, void* argPtr) {
+  return chargeI2c(msg, argInt, u8x8->bus_clock ? u8x8->bus_clock : U8G2_HOST_HW_I2C_BITRATE);
+}
+
+uint8_t u8x8_gpio_and_delay_arduino(u8x8_t* u8x8, uint8_t msg, uint8_t argInt, void* argPtr) {
+  return 1;
+}
+
+void u8x8_SetPin_SW_I2C(u8x8_t* u8x8, uint8_t clock, uint8_t data, uint8_t reset) {
+  u8x8->clockPin = clock;
+  u8x8->dataPin = data;
+  u8x8->resetPin = reset;
+}
+
+void u8x8_SetPin_HW_I2C(u8x8_t* u8x8, uint8_t reset, uint8_t clock, uint8_t data) {
+  u8x8->resetPin = reset;
+  u8x8->clockPin = clock;
+  u8x8->dataPin = data;
+}
+
+uint8_t u8x8_DrawTile(u8x8_t* u8x8, uint8_t x, uint8_t y, uint8_t count, uint8_t* tiles) {
+  hostHal.panelWriteTiles(x, y, count, tiles);
+  if (u8x8->byteCb != nullptr) {
+    u8x8->byteCb(u8x8, U8X8_MSG_BYTE_START_TRANSFER, 0, nullptr);
+    u8x8->byteCb(u8x8, U8X8_MSG_BYTE_SEND, DRAW_TILE_OVERHEAD - 1, nullptr);
+    // The byte callback takes at most 255 bytes per call
+    uint16_t remaining = count * 8;
+    while (remaining > 0) {
+      uint8_t chunk = remaining > 248 ? 248 : remaining;
+      u8x8->byteCb(u8x8, U8X8_MSG_BYTE_SEND, chunk, tiles);
+      tiles += chunk;
+      remaining -= chunk;
+    }
+    u8x8->byteCb(u8x8, U8X8_MSG_BYTE_END_TRANSFER, 0, nullptr);
+  }
+  return 1;
+}
+
+void u8x8_RefreshDisplay(u8x8_t* u8x8) {
+  hostHal.panelRefresh();
+}
+
+// ---- U8G2 ----
+
+U8G2::U8G2()
+  : drawColor(1), fontMode(0), fontPosTop(false), font(u8g2_font_6x10_tf),
+    cursorX(0), cursorY(0) {
+  memset(&u8g2, 0, sizeof(u8g2));
+}
+
+bool U8G2::begin() {
+  clearDisplay();
+  setPowerSave(0);
+  return true;
+}
+
+void U8G2::setPowerSave(uint8_t enable) {
+}
+
+void U8G2::setBusClock(uint32_t clockSpeed) {
+  u8g2.u8x8.bus_clock = clockSpeed;
+}
+
+void U8G2::clearDisplay() {
+  clearBuffer();
+  sendBuffer();
+}
+
+void U8G2::clearBuffer() {
+  memset(u8g2.tile_buf_ptr, 0, U8G2_HOST_WIDTH * U8G2_HOST_PAGES);
+}
+
+void U8G2::sendBuffer() {
+  updateDisplay();
+}
+
+void U8G2::updateDisplay() {
+  for (uint8_t page = 0; page < U8G2_HOST_PAGES; page++) {
+    u8x8_DrawTile(&u8g2.u8x8, 0, page, U8G2_HOST_TILE_COLS,
+                  u8g2.tile_buf_ptr + page * U8G2_HOST_WIDTH);
+  }
+  u8x8_RefreshDisplay(&u8g2.u8x8);
+}
+
+void U8G2::updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th) {
+  if (tx >= U8G2_HOST_TILE_COLS || ty >= U8G2_HOST_PAGES) {
+    return;
+  }
+  tw = min<uint8_t>(tw, U8G2_HOST_TILE_COLS - tx);
+  th = min<uint8_t>(th, U8G2_HOST_PAGES - ty);
+  for (uint8_t page = ty; page < ty + th; page++) {
+    u8x8_DrawTile(&u8g2.u8x8, tx, page, tw, u8g2.tile_buf_ptr + page * U8G2_HOST_WIDTH + tx * 8);
+  }
+  u8x8_RefreshDisplay(&u8g2.u8x8);
+}
+
+// ---- Primitives ----
+
+void U8G2::drawPixel(int x, int y) {
+  if (x < 0 || y < 0 || x >= U8G2_HOST_WIDTH || y >= U8G2_HOST_HEIGHT) {
+    return;
+  }
+  uint8_t* cell = u8g2.tile_buf_ptr + (y >> 3) * U8G2_HOST_WIDTH + x;
+  uint8_t mask = 1 << (y & 7);
+  switch (drawColor) {
+    case 0:
+      *cell &= ~mask;
+      break;
+    case 1:
+      *cell |= mask;
+      break;
+    default:
+      *cell ^= mask;
+      break;
+  }
+}
+
+void U8G2::drawHLine(int x, int y, int w) {
+  for (int i = 0; i < w; i++) {
+    drawPixel(x + i, y);
+  }
+}
+
+void U8G2::drawVLine(int x, int y, int h) {
+  for (int i = 0; i < h; i++) {
+    drawPixel(x, y + i);
+  }
+}
+
+void U8G2::drawBox(int x, int y, int w, int h) {
+  for (int i = 0; i < h; i++) {
+    drawHLine(x, y + i, w);
+  }
+}
+
+void U8G2::drawFrame(int x, int y, int w, int h) {
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+  drawHLine(x, y, w);
+  if (h > 1) {
+    drawHLine(x, y + h - 1, w);
+  }
+  if (h > 2) {
+    drawVLine(x, y + 1, h - 2);
+    if (w > 1) {
+      drawVLine(x + w - 1, y + 1, h - 2);
+    }
+  }
+}
+
+// Same stepping as u8g2's midpoint circle, so corners match pixel for pixel
+void U8G2::circleSection(int x, int y, int x0, int y0, uint8_t quadrants, bool filled) {
+  if (filled) {
+    if (quadrants & QUAD_UPPER_RIGHT) {
+      drawVLine(x0 + x, y0 - y, y + 1);
+      drawVLine(x0 + y, y0 - x, x + 1);
+    }
+    if (quadrants & QUAD_UPPER_LEFT) {
+      drawVLine(x0 - x, y0 - y, y + 1);
+      drawVLine(x0 - y, y0 - x, x + 1);
+    }
+    if (quadrants & QUAD_LOWER_RIGHT) {
+      drawVLine(x0 + x, y0, y + 1);
+      drawVLine(x0 + y, y0, x + 1);
+    }
+    if (quadrants & QUAD_LOWER_LEFT) {
+      drawVLine(x0 - x, y0, y + 1);
+      drawVLine(x0 - y, y0, x + 1);
+    }
+    return;
+  }
+  if (quadrants & QUAD_UPPER_RIGHT) {
+    drawPixel(x0 + x, y0 - y);
+    drawPixel(x0 + y, y0 - x);
+  }
+  if (quadrants & QUAD_UPPER_LEFT) {
+    drawPixel(x0 - x, y0 - y);
+    drawPixel(x0 - y, y0 - x);
+  }
+  if (quadrants & QUAD_LOWER_RIGHT) {
+    drawPixel(x0 + x, y0 + y);
+    drawPixel(x0 + y, y0 + x);
+  }
+  if (quadrants & QUAD_LOWER_LEFT) {
+    drawPixel(x0 - x, y0 + y);
+    drawPixel(x0 - y, y0 + x);
+  }
+}
+
+void U8G2::circle(int x0, int y0, int r, uint8_t quadrants, bool filled) {
+  int f = 1 - r;
+  int ddFx = 1;
+  int ddFy = -2 * r;
+  int x = 0;
+  int y = r;
+
+  circleSection(x, y, x0, y0, quadrants, filled);
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddFy += 2;
+      f += ddFy;
+    }
+    x++;
+    ddFx += 2;
+    f += ddFx;
+    circleSection(x, y, x0, y0, quadrants, filled);
+  }
+}
+
+void U8G2::drawCircle(int x0, int y0, int r) {
+  circle(x0, y0, r, QUAD_ALL, false);
+}
+
+void U8G2::drawDisc(int x0, int y0, int r) {
+  circle(x0, y0, r, QUAD_ALL, true);
+}
+
+void U8G2::drawRFrame(int x, int y, int w, int h, int r) {
+  int xl = x + r;
+  int yu = y + r;
+  int xr = x + w - r - 1;
+  int yl = y + h - r - 1;
+  circle(xl, yu, r, QUAD_UPPER_LEFT, false);
+  circle(xr, yu, r, QUAD_UPPER_RIGHT, false);
+  circle(xl, yl, r, QUAD_LOWER_LEFT, false);
+  circle(xr, yl, r, QUAD_LOWER_RIGHT, false);
+
+  int ww = w - r - r;
+  int hh = h - r - r;
+  if (ww >= 3) {
+    drawHLine(xl + 1, y, ww - 2);
+    drawHLine(xl + 1, y + h - 1, ww - 2);
+  }
+  if (hh >= 3) {
+    drawVLine(x, yu + 1, hh - 2);
+    drawVLine(x + w - 1, yu + 1, hh - 2);
+  }
+}
+
+void U8G2::drawRBox(int x, int y, int w, int h, int r) {
+  int xl = x + r;
+  int yu = y + r;
+  int xr = x + w - r - 1;
+  int yl = y + h - r - 1;
+  circle(xl, yu, r, QUAD_UPPER_LEFT, true);
+  circle(xr, yu, r, QUAD_UPPER_RIGHT, true);
+  circle(xl, yl, r, QUAD_LOWER_LEFT, true);
+  circle(xr, yl, r, QUAD_LOWER_RIGHT, true);
+
+  int ww = w - r - r;
+  int hh = h - r - r;
+  if (ww >= 3) {
+    drawBox(xl + 1, y, ww - 2, r + 1);
+    drawBox(xl + 1, yl, ww - 2, r + 1);
+  }
+  if (hh >= 3) {
+    drawBox(x, yu + 1, w, hh - 2);
+  }
+}
+
+void U8G2::drawLine(int x0, int y0, int x1, int y1) {
+  int dx = abs(x1 - x0);
+  int dy = -abs(y1 - y0);
+  int sx = x0 < x1 ? 1 : -1;
+  int sy = y0 < y1 ? 1 : -1;
+  int err = dx + dy;
+  for (;;) {
+    drawPixel(x0, y0);
+    if (x0 == x1 && y0 == y1) {
+      break;
+    }
+    int e2 = 2 * err;
+    if (e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+// XBM: rows of LSB-first bytes
+void U8G2::drawXBM(int x, int y, int w, int h, const uint8_t* bitmap) {
+  int stride = (w + 7) / 8;
+  for (int row = 0; row < h; row++) {
+    for (int col = 0; col < w; col++) {
+      if (bitmap[row * stride + col / 8] & (1 << (col & 7))) {
+        drawPixel(x + col, y + row);
+      }
+    }
+  }
+}
+
+// ---- Text ----
+
+// u8g2_font.c's decoding: a 23-byte header, then glyphs of an encoding,
+// the offset to the next glyph and a bit stream, read LSB first, of the
+// glyph's box, offsets and advance followed by background and ink run
+// lengths row by row. Runs are drawn as lines, the background only in
+// font mode 0, as u8g2_font_decode_len() draws them.
+#define FONT_HEADER_SIZE 23
+#define FONT_BITS_PER_0 2
+#define FONT_BITS_PER_1 3
+#define FONT_BITS_PER_WIDTH 4
+#define FONT_BITS_PER_HEIGHT 5
+#define FONT_BITS_PER_X 6
+#define FONT_BITS_PER_Y 7
+#define FONT_BITS_PER_DELTA 8
+#define FONT_MAX_WIDTH 9
+#define FONT_MAX_HEIGHT 10
+#define FONT_ASCENT_A 13
+#define FONT_DESCENT_G 14
+#define FONT_START_UPPER_A 17
+#define FONT_START_LOWER_A 19
+
+struct FontDecode {
+  const uint8_t* data;
+  uint8_t bit;
+  int targetX;      // top left of the glyph box
+  int targetY;
+  uint8_t width;
+  uint8_t x;        // next pixel within the box
+  uint8_t y;
+  uint8_t fgColor;
+  uint8_t bgColor;
+  bool transparent;
+};
+
+static uint8_t decodeBits(FontDecode& decode, uint8_t count) {
+  uint8_t value = u8x8_pgm_read(decode.data) >> decode.bit;
+  uint8_t end = decode.bit + count;
+  if (end >= 8) {
+    decode.data++;
+    value |= u8x8_pgm_read(decode.data) << (8 - decode.bit);
+    end -= 8;
+  }
+  decode.bit = end;
+  return value & ((1U << count) - 1);
+}
+
+static int8_t decodeSignedBits(FontDecode& decode, uint8_t count) {
+  return (int8_t)(decodeBits(decode, count) - (1 << (count - 1)));
+}
+
+// The glyph's bit stream, or nullptr if the font lacks it. The host
+// fonts have no glyphs past 0xFF.
+static const uint8_t* fontGlyph(const uint8_t* font, uint16_t encoding) {
+  if (encoding > 0xFF) {
+    return nullptr;
+  }
+  const uint8_t* glyph = font + FONT_HEADER_SIZE;
+  if (encoding >= 'a') {
+    glyph += (font[FONT_START_LOWER_A] << 8) | font[FONT_START_LOWER_A + 1];
+  } else if (encoding >= 'A') {
+    glyph += (font[FONT_START_UPPER_A] << 8) | font[FONT_START_UPPER_A + 1];
+  }
+  while (glyph[1] != 0) {
+    if (glyph[0] == encoding) {
+      return glyph + 2;
+    }
+    glyph += glyph[1];
+  }
+  return nullptr;
+}
+
+// Draws length pixels from the decode position on, wrapping into the
+// next row at the right edge of the box
+static void decodeRun(U8G2& u8g2, FontDecode& decode, uint8_t length, bool foreground) {
+  uint8_t count = length;
+  uint8_t x = decode.x;
+  uint8_t y = decode.y;
+  for (;;) {
+    uint8_t remaining = decode.width - x;
+    uint8_t current = count < remaining ? count : remaining;
+    if (foreground || !decode.transparent) {
+      u8g2.setDrawColor(foreground ? decode.fgColor : decode.bgColor);
+      u8g2.drawHLine(decode.targetX + x, decode.targetY + y, current);
+    }
+    if (count < remaining) {
+      break;
+    }
+    count -= remaining;
+    x = 0;
+    y++;
+  }
+  decode.x = x + count;
+  decode.y = y;
+}
+
+void U8G2::setFont(const uint8_t* newFont) {
+  font = newFont;
+}
+
+int U8G2::getAscent() const {
+  return (int8_t)font[FONT_ASCENT_A];
+}
+
+int U8G2::getDescent() const {
+  return (int8_t)font[FONT_DESCENT_G];
+}
+
+int U8G2::getMaxCharHeight() const {
+  return font[FONT_MAX_HEIGHT];
+}
+
+int U8G2::getMaxCharWidth() const {
+  return font[FONT_MAX_WIDTH];
+}
+
+// As u8g2_GetStrWidth(): the advances, except that the last glyph counts
+// to the right edge of its ink
+int U8G2::getStrWidth(const char* text) const {
+  int width = 0;
+  int advance = 0;
+  uint8_t glyphWidth = 0;
+  int8_t glyphX = 0;
+  for (; *text != '\0' && *text != '\n'; text++) {
+    const uint8_t* data = fontGlyph(font, (uint8_t)*text);
+    advance = 0;
+    if (data != nullptr) {
+      FontDecode decode = {data, 0};
+      glyphWidth = decodeBits(decode, font[FONT_BITS_PER_WIDTH]);
+      decodeBits(decode, font[FONT_BITS_PER_HEIGHT]);
+      glyphX = decodeSignedBits(decode, font[FONT_BITS_PER_X]);
+      decodeSignedBits(decode, font[FONT_BITS_PER_Y]);
+      advance = decodeSignedBits(decode, font[FONT_BITS_PER_DELTA]);
+    }
+    width += advance;
+  }
+  if (glyphWidth != 0) {
+    width += glyphX + glyphWidth - advance;
+  }
+  return width;
+}
+
+int U8G2::drawGlyph(int x, int y, uint16_t encoding) {
+  const uint8_t* data = fontGlyph(font, encoding);
+  if (data == nullptr) {
+    return 0;
+  }
+  if (fontPosTop) {
+    y += getAscent();
+  }
+  FontDecode decode = {data, 0};
+  decode.fgColor = drawColor;
+  decode.bgColor = drawColor == 0 ? 1 : 0;
+  decode.transparent = fontMode != 0;
+  decode.width = decodeBits(decode, font[FONT_BITS_PER_WIDTH]);
+  uint8_t height = decodeBits(decode, font[FONT_BITS_PER_HEIGHT]);
+  int8_t offsetX = decodeSignedBits(decode, font[FONT_BITS_PER_X]);
+  int8_t offsetY = decodeSignedBits(decode, font[FONT_BITS_PER_Y]);
+  int8_t advance = decodeSignedBits(decode, font[FONT_BITS_PER_DELTA]);
+  if (decode.width == 0) {
+    return advance;
+  }
+
+  decode.targetX = x + offsetX;
+  decode.targetY = y - (height + offsetY);
+  do {
+    uint8_t background = decodeBits(decode, font[FONT_BITS_PER_0]);
+    uint8_t ink = decodeBits(decode, font[FONT_BITS_PER_1]);
+    do {
+      decodeRun(*this, decode, background, false);
+      decodeRun(*this, decode, ink, true);
+    } while (decodeBits(decode, 1) != 0);
+  } while (decode.y < height);
+  drawColor = decode.fgColor;
+  return advance;
+}
+
+// Ends at a newline, as u8g2's ASCII decoding does
+int U8G2::drawStr(int x, int y, const char* text) {
+  int width = 0;
+  while (*text != '\0' && *text != '\n') {
+    width += drawGlyph(x + width, y, (uint8_t)*text++);
+  }
+  return width;
+}
+
+size_t U8G2::write(uint8_t c) {
+  cursorX += drawGlyph(cursorX, cursorY, c);
+  return 1;
+}
+
+// ---- Concrete panels ----
+
+U8G2_SSD1306_128X64_NONAME_F_SW_I2C::U8G2_SSD1306_128X64_NONAME_F_SW_I2C(
+    const u8g2_cb_t* rotation, uint8_t clock, uint8_t data, uint8_t reset) {
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, rotation, u8x8_byte_arduino_sw_i2c,
+                                         u8x8_gpio_and_delay_arduino);
+  u8x8_SetPin_SW_I2C(&u8g2.u8x8, clock, data, reset);
+}
+
+U8G2_SSD1306_128X64_NONAME_F_HW_I2C::U8G2_SSD1306_128X64_NONAME_F_HW_I2C(
+    const u8g2_cb_t* rotation, uint8_t reset, uint8_t clock, uint8_t data) {
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, rotation, u8x8_byte_arduino_hw_i2c,
+                                         u8x8_gpio_and_delay_arduino);
+  u8x8_SetPin_HW_I2C(&u8g2.u8x8, reset, clock, data);
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+#ifndef HOST_U8G2LIB_H
+#define HOST_U8G2LIB_H
+
+// Host stand-in for U8g2: a full-buffer SSD1306 128x64 with the drawing
+// calls the NEOos sources use. Tiles go to the HostHal panel and the byte
+// callbacks charge the I2C transfer time to the virtual clock. Fonts are
+// in the u8g2 font format and drawn the way u8g2 decodes them; see
+// font_encode.cpp for where they come from.
+
+#include "Arduino.h"
+
+#define U8X8_PIN_NONE 255
+
+#define u8x8_pgm_read(address) (*(const uint8_t*)(address))
+
+#define U8X8_MSG_BYTE_INIT 20
+#define U8X8_MSG_BYTE_SEND 23
+#define U8X8_MSG_BYTE_START_TRANSFER 24
+#define U8X8_MSG_BYTE_END_TRANSFER 25
+#define U8X8_MSG_BYTE_SET_DC 32
+
+#define U8G2_HOST_WIDTH 128
+#define U8G2_HOST_HEIGHT 64
+#define U8G2_HOST_TILE_COLS (U8G2_HOST_WIDTH / 8)
+#define U8G2_HOST_PAGES (U8G2_HOST_HEIGHT / 8)
+#define U8G2_HOST_SW_I2C_BITRATE 100000UL  // bit-banged bus, roughly
+#define U8G2_HOST_HW_I2C_BITRATE 400000UL  // u8g2 default for the SSD1306
+
+struct u8x8_t;
+typedef uint8_t (*u8x8_msg_cb)(u8x8_t* u8x8, uint8_t msg, uint8_t argInt, void* argPtr);
+
+struct u8x8_t {
+  u8x8_msg_cb byteCb;
+  u8x8_msg_cb gpioCb;
+  uint32_t bus_clock;
+  uint8_t i2c_address;
+  uint8_t clockPin;
+  uint8_t dataPin;
+  uint8_t resetPin;
+};
+
+struct u8g2_t {
+  u8x8_t u8x8;
+  uint8_t* tile_buf_ptr;
+};
+
+struct u8g2_cb_t {
+  uint8_t rotation;
+};
+
+extern const u8g2_cb_t* U8G2_R0;
+
+void u8g2_Setup_ssd1306_i2c_128x64_noname_f(u8g2_t* u8g2, const u8g2_cb_t* rotation,
+                                            u8x8_msg_cb byteCb, u8x8_msg_cb gpioCb);
+uint8_t u8x8_byte_arduino_sw_i2c(u8x8_t* u8x8, uint8_t msg, uint8_t argInt, void* argPtr);
+uint8_t u8x8_byte_arduino_hw_i2c(u8x8_t* u8x8, uint8_t msg, uint8_t argInt, void* argPtr);
+uint8_t u8x8_gpio_and_delay_arduino(u8x8_t* u8x8, uint8_t msg, uint8_t argInt, void* argPtr);
+void u8x8_SetPin_SW_I2C(u8x8_t* u8x8, uint8_t clock, uint8_t data, uint8_t reset);
+void u8x8_SetPin_HW_I2C(u8x8_t* u8x8, uint8_t reset, uint8_t clock = U8X8_PIN_NONE,
+                        uint8_t data = U8X8_PIN_NONE);
+uint8_t u8x8_DrawTile(u8x8_t* u8x8, uint8_t x, uint8_t y, uint8_t count, uint8_t* tiles);
+void u8x8_RefreshDisplay(u8x8_t* u8x8);
+
+// Generated into U8g2Fonts.cpp by neoos_font_encode
+extern const uint8_t u8g2_font_4x6_tr[];
+extern const uint8_t u8g2_font_4x6_tf[];
+extern const uint8_t u8g2_font_6x10_tf[];
+extern const uint8_t u8g2_font_6x12_tr[];
+extern const uint8_t u8g2_font_profont17_tr[];
+extern const uint8_t u8g2_font_doomalpha04_tr[];
+extern const uint8_t u8g2_font_minicute_tr[];
+extern const uint8_t u8g2_font_simple1_tr[];
+extern const uint8_t u8g2_font_iconquadpix_m_all[];
+
+class U8G2 : public Print {
+  public:
+    U8G2();
+
+    u8g2_t* getU8g2() { return &u8g2; }
+    u8x8_t* getU8x8() { return &u8g2.u8x8; }
+
+    bool begin();
+    void setPowerSave(uint8_t enable);
+    void setBusClock(uint32_t clockSpeed);
+    void clearDisplay();
+    void clearBuffer();
+    void sendBuffer();
+    void updateDisplay();
+    void updateDisplayArea(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+    uint8_t* getBufferPtr() { return u8g2.tile_buf_ptr; }
+    uint8_t getBufferTileWidth() const { return U8G2_HOST_TILE_COLS; }
+    uint8_t getBufferTileHeight() const { return U8G2_HOST_PAGES; }
+    int getDisplayWidth() const { return U8G2_HOST_WIDTH; }
+    int getDisplayHeight() const { return U8G2_HOST_HEIGHT; }
+
+    void setDrawColor(uint8_t color) { drawColor = color; }
+    uint8_t getDrawColor() const { return drawColor; }
+    void drawPixel(int x, int y);
+    void drawHLine(int x, int y, int w);
+    void drawVLine(int x, int y, int h);
+    void drawBox(int x, int y, int w, int h);
+    void drawFrame(int x, int y, int w, int h);
+    void drawRBox(int x, int y, int w, int h, int r);
+    void drawRFrame(int x, int y, int w, int h, int r);
+    void drawLine(int x0, int y0, int x1, int y1);
+    void drawCircle(int x0, int y0, int r);
+    void drawDisc(int x0, int y0, int r);
+    void drawXBM(int x, int y, int w, int h, const uint8_t* bitmap);
+
+    void setFont(const uint8_t* font);
+    void setFontMode(uint8_t mode) { fontMode = mode; }
+    void setFontDirection(uint8_t direction) {}
+    void setFontRefHeightExtendedText() {}
+    void setFontPosBaseline() { fontPosTop = false; }
+    void setFontPosTop() { fontPosTop = true; }
+    int drawStr(int x, int y, const char* text);
+    int drawGlyph(int x, int y, uint16_t encoding);
+    int getStrWidth(const char* text) const;
+    int getMaxCharHeight() const;
+    int getMaxCharWidth() const;
+    int getAscent() const;
+    int getDescent() const;
+
+    void setCursor(int x, int y) { cursorX = x; cursorY = y; }
+    using Print::write;
+    size_t write(uint8_t c);
+
+  protected:
+    u8g2_t u8g2;
+
+  private:
+    uint8_t drawColor;
+    uint8_t fontMode;
+    bool fontPosTop;
+    const uint8_t* font;
+    int cursorX;
+    int cursorY;
+
+    void circleSection(int x, int y, int x0, int y0, uint8_t quadrants, bool filled);
+    void circle(int x0, int y0, int r, uint8_t quadrants, bool filled);
+};
+
+class U8G2_SSD1306_128X64_NONAME_F_SW_I2C : public U8G2 {
+  public:
+    U8G2_SSD1306_128X64_NONAME_F_SW_I2C(const u8g2_cb_t* rotation, uint8_t clock, uint8_t data,
+                                        uint8_t reset = U8X8_PIN_NONE);
+};
+
+class U8G2_SSD1306_128X64_NONAME_F_HW_I2C : public U8G2 {
+  public:
+    U8G2_SSD1306_128X64_NONAME_F_HW_I2C(const u8g2_cb_t* rotation, uint8_t reset = U8X8_PIN_NONE,
+                                        uint8_t clock = U8X8_PIN_NONE, uint8_t data = U8X8_PIN_NONE);
+};
+
+#endif
\ No newline at end of file
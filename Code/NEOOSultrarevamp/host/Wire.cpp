@@ -0,0 +1,56 @@
+#include "Wire.h"
+
+TwoWire Wire;
+
+TwoWire::TwoWire() : clock(100000) {
+}
+
+bool TwoWire::begin() {
+  return true;
+}
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency) {
+  if (frequency != 0) {
+    clock = frequency;
+  }
+  return true;
+}
+
+void TwoWire::end() {
+}
+
+void TwoWire::setClock(uint32_t frequency) {
+  clock = frequency;
+}
+
+uint32_t TwoWire::getClock() const {
+  return clock;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+}
+
+// 2 = address NACK, as if no device answered
+uint8_t TwoWire::endTransmission(bool sendStop) {
+  return 2;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity, bool sendStop) {
+  return 0;
+}
+
+int TwoWire::available() {
+  return 0;
+}
+
+int TwoWire::read() {
+  return -1;
+}
+
+size_t TwoWire::write(uint8_t c) {
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t* buffer, size_t size) {
+  return size;
+}
\ No newline at end of file
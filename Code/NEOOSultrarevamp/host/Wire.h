@@ -0,0 +1,36 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+// Host stand-in for the Arduino Wire library. Nothing sits on the bus:
+// writes are accepted and reads return nothing. The display shim charges
+// its own transfer time.
+
+#include "Arduino.h"
+
+class TwoWire : public Print {
+  public:
+    TwoWire();
+
+    bool begin();
+    bool begin(int sda, int scl, uint32_t frequency = 0);
+    void end();
+    void setClock(uint32_t frequency);
+    uint32_t getClock() const;
+
+    void beginTransmission(uint8_t address);
+    uint8_t endTransmission(bool sendStop = true);
+    uint8_t requestFrom(uint8_t address, uint8_t quantity, bool sendStop = true);
+    int available();
+    int read();
+
+    using Print::write;
+    size_t write(uint8_t c);
+    size_t write(const uint8_t* buffer, size_t size);
+
+  private:
+    uint32_t clock;
+};
+
+extern TwoWire Wire;
+
+#endif
\ No newline at end of file
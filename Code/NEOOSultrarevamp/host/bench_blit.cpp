@@ -0,0 +1,229 @@
+// Host benchmark for the Blitter and the TextCache: draws the shapes and
+// strings the menus use through them and through the u8g2 shim, prints
+// the time per draw of each, and checks both leave the same framebuffer.
+// Every glyph of every font is then checked the same way, over a ruled
+// background so the box a glyph clears shows.
+//
+//   neoos_bench_blit [--iterations n]
+//
+// The shim plots pixel by pixel like u8g2's generic routines, so the
+// ratio is indicative of the device; neoos_bench_render --u8g2 gives the
+// whole-frame view. Compare two runs with scripts/bench_compare.py.
+
+#include "Blitter.h"
+#include "TextCache.h"
+
+#include <chrono>
+
+#define BENCH_ITERATIONS 20000
+#define GLYPHS_PER_DRAW 10  // fit across the screen in the widest font
+
+static uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// The title bars and list of drawSubMenu()
+static const char* const labels[] = {"ATTACKS", "SCAN", "DIRECT SEND", "REPEAT SEND", "BURST SEND"};
+
+static void u8g2Lines(U8G2& u8g2) {
+  for (int y = 0; y < DISPLAY_HEIGHT; y += 2) {
+    u8g2.drawHLine(0, y, DISPLAY_WIDTH);
+  }
+}
+
+static void blitLines(uint8_t* buffer) {
+  for (int y = 0; y < DISPLAY_HEIGHT; y += 2) {
+    blitHLine(buffer, 0, y, DISPLAY_WIDTH);
+  }
+}
+
+static void u8g2Box(U8G2& u8g2) {
+  u8g2.drawBox(3, 5, 121, 50);
+}
+
+static void blitBoxCase(uint8_t* buffer) {
+  blitBox(buffer, 3, 5, 121, 50);
+}
+
+static void u8g2Frames(U8G2& u8g2) {
+  u8g2.drawRFrame(0, 0, 128, 64, 4);
+  u8g2.drawRFrame(0, 0, 128, 12, 4);
+  u8g2.drawRFrame(0, 0, 128, 10, 3);
+  u8g2.drawRFrame(30, 20, 40, 30, 8);
+}
+
+static void blitFrames(uint8_t* buffer) {
+  blitRFrame(buffer, 0, 0, 128, 64, 4);
+  blitRFrame(buffer, 0, 0, 128, 12, 4);
+  blitRFrame(buffer, 0, 0, 128, 10, 3);
+  blitRFrame(buffer, 30, 20, 40, 30, 8);
+}
+
+static void u8g2Title(U8G2& u8g2) {
+  u8g2.setFont(u8g2_font_4x6_tr);
+  u8g2.drawStr(4, 9, "NEOos V.1.0");
+  u8g2.drawStr(110, 8, "- X");
+}
+
+static void blitTitle(uint8_t* buffer) {
+  blitStr(buffer, u8g2_font_4x6_tr, 4, 9, "NEOos V.1.0");
+  blitStr(buffer, u8g2_font_4x6_tr, 110, 8, "- X");
+}
+
+static void u8g2List(U8G2& u8g2) {
+  u8g2.setFont(u8g2_font_6x10_tf);
+  for (int i = 0; i < 5; i++) {
+    u8g2.drawStr(12, 24 + i * 10, labels[i]);
+  }
+}
+
+static void blitList(uint8_t* buffer) {
+  for (int i = 0; i < 5; i++) {
+    blitStr(buffer, u8g2_font_6x10_tf, 12, 24 + i * 10, labels[i]);
+  }
+}
+
+static void u8g2Large(U8G2& u8g2) {
+  u8g2.setFont(u8g2_font_profont17_tr);
+  u8g2.drawStr(20, 58, "INFRARED");
+}
+
+static void blitLarge(uint8_t* buffer) {
+  blitStr(buffer, u8g2_font_profont17_tr, 20, 58, "INFRARED");
+}
+
+// Glyphs across the screen edges and page boundaries
+static void u8g2Clipped(U8G2& u8g2) {
+  u8g2.setFont(u8g2_font_6x10_tf);
+  u8g2.drawStr(-4, 3, "EDGE");
+  u8g2.drawStr(110, 67, "EDGE");
+  u8g2.setFont(u8g2_font_profont17_tr);
+  u8g2.drawStr(100, 37, "Wq");
+}
+
+static void blitClipped(uint8_t* buffer) {
+  blitStr(buffer, u8g2_font_6x10_tf, -4, 3, "EDGE");
+  blitStr(buffer, u8g2_font_6x10_tf, 110, 67, "EDGE");
+  blitStr(buffer, u8g2_font_profont17_tr, 100, 37, "Wq");
+}
+
+// The same strings from the cache; it is warm after the first draw
+static TextCache labelCache;
+
+static void cachedList(uint8_t* buffer) {
+  for (int i = 0; i < 5; i++) {
+    labelCache.draw(buffer, u8g2_font_6x10_tf, 12, 24 + i * 10, labels[i]);
+  }
+}
+
+static void cachedClipped(uint8_t* buffer) {
+  labelCache.draw(buffer, u8g2_font_6x10_tf, -4, 3, "EDGE");
+  labelCache.draw(buffer, u8g2_font_6x10_tf, 110, 67, "EDGE");
+  labelCache.draw(buffer, u8g2_font_profont17_tr, 100, 37, "Wq");
+}
+
+static const uint8_t* const fonts[] = {
+  u8g2_font_4x6_tr, u8g2_font_4x6_tf, u8g2_font_6x10_tf, u8g2_font_6x12_tr, u8g2_font_profont17_tr,
+  u8g2_font_doomalpha04_tr, u8g2_font_minicute_tr, u8g2_font_simple1_tr, u8g2_font_iconquadpix_m_all
+};
+
+// Draws each font's printable glyphs a few at a time through both and
+// returns the number of draws that differ
+static uint32_t checkGlyphs(U8G2& u8g2, uint8_t* buffer, uint32_t& glyphs) {
+  uint32_t mismatches = 0;
+  for (const uint8_t* font : fonts) {
+    char text[GLYPHS_PER_DRAW + 1];
+    for (int first = 0x20; first <= 0x7E; first += GLYPHS_PER_DRAW) {
+      int count = min(GLYPHS_PER_DRAW, 0x7F - first);
+      for (int i = 0; i < count; i++) {
+        text[i] = first + i;
+      }
+      text[count] = '\0';
+      glyphs += count;
+
+      u8g2.clearBuffer();
+      u8g2Lines(u8g2);
+      u8g2.setFont(font);
+      u8g2.drawStr(1, 30, text);
+      memset(buffer, 0, DISPLAY_BUFFER_SIZE);
+      blitLines(buffer);
+      blitStr(buffer, font, 1, 30, text);
+      if (memcmp(buffer, u8g2.getBufferPtr(), DISPLAY_BUFFER_SIZE) != 0) {
+        mismatches++;
+        fprintf(stderr, "neoos_bench_blit: glyphs 0x%02X..0x%02X differ from u8g2\n", first,
+                first + count - 1);
+      }
+    }
+  }
+  return mismatches;
+}
+
+struct BlitCase {
+  const char* name;
+  void (*u8g2)(U8G2& u8g2);
+  void (*blit)(uint8_t* buffer);
+};
+
+static const BlitCase cases[] = {
+  {"hlines", u8g2Lines, blitLines},
+  {"box", u8g2Box, blitBoxCase},
+  {"rframes", u8g2Frames, blitFrames},
+  {"str_title", u8g2Title, blitTitle},
+  {"str_list", u8g2List, blitList},
+  {"str_large", u8g2Large, blitLarge},
+  {"str_clipped", u8g2Clipped, blitClipped},
+  {"label_list", u8g2List, cachedList},
+  {"label_clipped", u8g2Clipped, cachedClipped}
+};
+
+int main(int argc, char** argv) {
+  uint32_t iterations = BENCH_ITERATIONS;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], nullptr, 10);
+    } else {
+      fprintf(stderr, "usage: neoos_bench_blit [--iterations n]\n");
+      return 2;
+    }
+  }
+  if (iterations == 0) {
+    fprintf(stderr, "neoos_bench_blit: --iterations must be positive\n");
+    return 2;
+  }
+
+  U8G2 u8g2;
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(u8g2.getU8g2(), U8G2_R0, nullptr, nullptr);
+  static uint8_t buffer[DISPLAY_BUFFER_SIZE];
+
+  printf("# blit-bench v1 unit=ns iterations=%u\n", (unsigned)iterations);
+  bool failed = false;
+  for (const BlitCase& benchCase : cases) {
+    // Each draw starts from a clear buffer, as a frame does
+    uint64_t started = nowNs();
+    for (uint32_t i = 0; i < iterations; i++) {
+      u8g2.clearBuffer();
+      benchCase.u8g2(u8g2);
+    }
+    uint64_t u8g2Ns = (nowNs() - started) / iterations;
+
+    started = nowNs();
+    for (uint32_t i = 0; i < iterations; i++) {
+      memset(buffer, 0, sizeof(buffer));
+      benchCase.blit(buffer);
+    }
+    uint64_t blitNs = (nowNs() - started) / iterations;
+
+    bool match = memcmp(buffer, u8g2.getBufferPtr(), sizeof(buffer)) == 0;
+    failed |= !match;
+    printf("bench=blit_%s ops=%u time_per_op=%llu time_u8g2=%llu unit=ns match=%d\n", benchCase.name,
+           (unsigned)iterations, (unsigned long long)blitNs, (unsigned long long)u8g2Ns, match ? 1 : 0);
+  }
+  uint32_t glyphs = 0;
+  uint32_t mismatches = checkGlyphs(u8g2, buffer, glyphs);
+  failed |= mismatches != 0;
+  printf("check=blit_glyphs fonts=%u glyphs=%u mismatches=%u\n", (unsigned)(sizeof(fonts) / sizeof(fonts[0])),
+         (unsigned)glyphs, (unsigned)mismatches);
+  printf("# end\n");
+  return failed ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,297 @@
+// Host benchmark for IrCodec: encodes a corpus of IR captures and prints
+// the compression ratio, the worst timing error and the encode and
+// streaming decode speed per capture.
+//
+//   neoos_bench_ircodec [--iterations n] [capture file ...]
+//
+// Without files the corpus is synthesised: one frame per common protocol
+// plus long air-conditioner frames and pure noise, with the mark
+// stretching and jitter of a real demodulating receiver. Capture files
+// use the `ir` script format (mark/space us, # comments), e.g.
+// scripts/ir/*.txt. Compare two runs with scripts/bench_compare.py.
+
+#include "IrCodec.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#define BENCH_MAX_DURATIONS 512
+
+struct Capture {
+  std::string name;
+  std::vector<uint16_t> durations;
+};
+
+static uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t randomState = 0x1234567;
+
+static uint32_t nextRandom() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+// Receivers stretch marks and shorten spaces by up to ~100 us
+class Synth {
+  public:
+    explicit Synth(Capture& capture) : capture(capture) {}
+
+    void mark(uint16_t us) { capture.durations.push_back(us + 20 + nextRandom() % 80); }
+    void space(uint16_t us) { capture.durations.push_back(us - 20 - nextRandom() % 80); }
+
+    // Pulse-distance bits, LSB first: fixed mark, space by value
+    void bits(uint64_t value, uint8_t count, uint16_t markUs, uint16_t zeroUs, uint16_t oneUs) {
+      for (uint8_t i = 0; i < count; i++) {
+        mark(markUs);
+        space((value >> i) & 1 ? oneUs : zeroUs);
+      }
+    }
+
+    // Manchester levels, merged into marks and spaces
+    void level(bool on, uint16_t us) {
+      if (on != lastOn || capture.durations.empty()) {
+        if (on) {
+          mark(us);
+        } else if (!capture.durations.empty()) {
+          space(us);
+        }
+        lastOn = on;
+        return;
+      }
+      capture.durations.back() += us;
+    }
+
+  private:
+    Capture& capture;
+    bool lastOn = false;
+};
+
+static void synthesise(std::vector<Capture>& corpus) {
+  corpus.push_back({"nec", {}});
+  {
+    Synth s(corpus.back());
+    s.mark(9000);
+    s.space(4500);
+    s.bits(0xF708FB04ULL, 32, 560, 560, 1690);
+    s.mark(560);
+  }
+  corpus.push_back({"nec_repeat", {}});
+  {
+    Synth s(corpus.back());
+    s.mark(9000);
+    s.space(2250);
+    s.mark(560);
+  }
+  corpus.push_back({"samsung32", {}});
+  {
+    Synth s(corpus.back());
+    s.mark(4500);
+    s.space(4500);
+    s.bits(0xE51A0707ULL, 32, 560, 560, 1690);
+    s.mark(560);
+  }
+  corpus.push_back({"jvc", {}});
+  {
+    Synth s(corpus.back());
+    s.mark(8400);
+    s.space(4200);
+    s.bits(0x0C03, 16, 526, 526, 1578);
+    s.mark(526);
+  }
+  // Sony: pulse-width bits, the value is in the marks
+  const uint8_t sonyBits[] = {12, 20};
+  for (uint8_t width : sonyBits) {
+    corpus.push_back({width == 12 ? "sony12" : "sony20", {}});
+    Synth s(corpus.back());
+    uint32_t value = width == 12 ? 0x095 : 0x1A8F2;
+    s.mark(2400);
+    for (uint8_t i = 0; i < width; i++) {
+      s.space(600);
+      s.mark((value >> i) & 1 ? 1200 : 600);
+    }
+  }
+  corpus.push_back({"panasonic48", {}});
+  {
+    Synth s(corpus.back());
+    s.mark(3456);
+    s.space(1728);
+    s.bits(0x3D0100B0020ULL, 48, 432, 432, 1296);
+    s.mark(432);
+  }
+  corpus.push_back({"rc5", {}});
+  {
+    Synth s(corpus.back());
+    uint16_t frame = 0x3000 | (5 << 6) | 12;  // start bits, address 5, command 12
+    for (int8_t i = 13; i >= 0; i--) {
+      bool one = (frame >> i) & 1;
+      s.level(!one, 889);
+      s.level(one, 889);
+    }
+  }
+  corpus.push_back({"rc6", {}});
+  {
+    Synth s(corpus.back());
+    s.level(true, 2666);
+    s.level(false, 889);
+    uint32_t frame = 0x1000C;  // start bit, mode 0, address 0, command 12
+    for (int8_t i = 20; i >= 0; i--) {
+      bool one = (frame >> i) & 1;
+      uint16_t half = i == 16 ? 889 : 444;  // the trailer bit is twice as long
+      s.level(one, half);
+      s.level(!one, half);
+    }
+  }
+  // Air conditioners send the whole state every time
+  corpus.push_back({"ac_mitsubishi144", {}});
+  {
+    Synth s(corpus.back());
+    s.mark(3400);
+    s.space(1750);
+    for (uint8_t byte = 0; byte < 18; byte++) {
+      s.bits(nextRandom() & 0xFF, 8, 450, 420, 1300);
+    }
+    s.mark(450);
+  }
+  corpus.push_back({"ac_daikin216", {}});
+  {
+    Synth s(corpus.back());
+    s.mark(3500);
+    s.space(1728);
+    for (uint8_t byte = 0; byte < 27; byte++) {
+      s.bits(nextRandom() & 0xFF, 8, 428, 428, 1280);
+    }
+    s.mark(428);
+  }
+  // Nothing to share: exercises the varint fallback
+  corpus.push_back({"noise", {}});
+  for (uint16_t i = 0; i < 200; i++) {
+    corpus.back().durations.push_back(100 + nextRandom() % 9000);
+  }
+}
+
+static bool loadCapture(const char* path, Capture& capture) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    return false;
+  }
+  const char* slash = strrchr(path, '/');
+  capture.name = slash != nullptr ? slash + 1 : path;
+  size_t dot = capture.name.rfind('.');
+  if (dot != std::string::npos) {
+    capture.name.resize(dot);
+  }
+  char line[256];
+  while (fgets(line, sizeof(line), file) != nullptr && capture.durations.size() < BENCH_MAX_DURATIONS) {
+    char* hash = strchr(line, '#');
+    if (hash != nullptr) {
+      *hash = '\0';
+    }
+    for (char* token = strtok(line, " \t\r\n"); token != nullptr; token = strtok(nullptr, " \t\r\n")) {
+      capture.durations.push_back(strtoul(token, nullptr, 10));
+    }
+  }
+  fclose(file);
+  return !capture.durations.empty();
+}
+
+int main(int argc, char** argv) {
+  uint32_t iterations = 20000;
+  std::vector<Capture> corpus;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], nullptr, 10);
+    } else if (argv[i][0] != '-') {
+      Capture capture;
+      if (!loadCapture(argv[i], capture)) {
+        fprintf(stderr, "neoos_bench_ircodec: cannot read %s\n", argv[i]);
+        return 1;
+      }
+      corpus.push_back(capture);
+    } else {
+      fprintf(stderr, "usage: neoos_bench_ircodec [--iterations n] [capture file ...]\n");
+      return 2;
+    }
+  }
+  if (iterations == 0) {
+    fprintf(stderr, "neoos_bench_ircodec: --iterations must be positive\n");
+    return 2;
+  }
+  if (corpus.empty()) {
+    synthesise(corpus);
+  }
+
+  printf("# ircodec-bench v1 unit=ns iterations=%u captures=%u tick_us=%u\n",
+         (unsigned)iterations, (unsigned)corpus.size(), IR_CODEC_TICK);
+  uint8_t encoded[IR_CODEC_MAX_SIZE(BENCH_MAX_DURATIONS)];
+  uint16_t decoded[BENCH_MAX_DURATIONS];
+  uint64_t rawTotal = 0;
+  uint64_t encodedTotal = 0;
+  uint64_t durationTotal = 0;
+  uint64_t decodeTotal = 0;
+  bool failed = false;
+  volatile uint32_t sink = 0;
+
+  for (const Capture& capture : corpus) {
+    uint16_t count = capture.durations.size();
+    const uint16_t* durations = capture.durations.data();
+
+    uint64_t started = nowNs();
+    size_t length = 0;
+    for (uint32_t i = 0; i < iterations; i++) {
+      length = irCodecEncode(durations, count, encoded, sizeof(encoded));
+    }
+    uint64_t encodeNs = (nowNs() - started) / iterations;
+
+    // Streaming, the way IrLibrary::readRaw() consumes it
+    started = nowNs();
+    for (uint32_t i = 0; i < iterations; i++) {
+      IrCodecReader reader;
+      reader.begin(encoded, length);
+      uint16_t duration;
+      uint32_t sum = 0;
+      while (reader.next(duration)) {
+        sum += duration;
+      }
+      sink = sink + sum;
+    }
+    uint64_t decodeNs = (nowNs() - started) / iterations;
+
+    uint16_t got = irCodecDecode(encoded, length, decoded, BENCH_MAX_DURATIONS);
+    uint32_t maxError = 0;
+    uint32_t maxErrorPct = 0;
+    for (uint16_t i = 0; i < got; i++) {
+      uint32_t error = abs((int)decoded[i] - (int)durations[i]);
+      maxError = std::max(maxError, error);
+      maxErrorPct = std::max<uint32_t>(maxErrorPct, durations[i] ? 100 * error / durations[i] : 0);
+    }
+    if (length == 0 || got != count) {
+      failed = true;
+    }
+
+    uint32_t rawBytes = count * sizeof(uint16_t);
+    printf("bench=codec_%s ops=%u time_per_op=%llu time_encode=%llu unit=ns durations=%u raw_bytes=%u "
+           "encoded_bytes=%u ratio_x100=%u mode=%s max_error_us=%u max_error_pct=%u\n",
+           capture.name.c_str(), (unsigned)iterations, (unsigned long long)decodeNs, (unsigned long long)encodeNs,
+           (unsigned)count, (unsigned)rawBytes, (unsigned)length,
+           (unsigned)(length ? 100 * rawBytes / length : 0),
+           length && encoded[0] == IR_CODEC_DICTIONARY ? "dictionary" : "varint",
+           (unsigned)maxError, (unsigned)maxErrorPct);
+    rawTotal += rawBytes;
+    encodedTotal += length;
+    durationTotal += count;
+    decodeTotal += decodeNs;
+  }
+
+  printf("bench=codec_corpus captures=%u time_per_duration=%llu unit=ns raw_bytes=%llu encoded_bytes=%llu ratio_x100=%llu\n",
+         (unsigned)corpus.size(), (unsigned long long)(durationTotal ? decodeTotal / durationTotal : 0),
+         (unsigned long long)rawTotal, (unsigned long long)encodedTotal,
+         (unsigned long long)(encodedTotal ? 100 * rawTotal / encodedTotal : 0));
+  printf("# end\n");
+  return failed ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+// Host benchmark for the IrProtocols decoder: frames per second over a
+// trace corpus, decoding every frame in one pass against all protocols
+// and, for reference, trying the protocols one after another.
+//
+//   neoos_bench_irdecode [--iterations n] [trace ...]
+//
+// Without traces it runs on scripts/ir/corpus. Compare two runs with
+// scripts/bench_compare.py.
+
+#include "IrTrace.h"
+
+#include <chrono>
+#include <dirent.h>
+#include <algorithm>
+
+struct Corpus {
+  std::string name;
+  std::vector<IrTraceFrame> frames;
+};
+
+static uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static bool decodeSequential(const IrTraceFrame& frame, IrCode& code) {
+  for (uint8_t t = 0; t < irTimingCount(); t++) {
+    if (irDecode(frame.durations.data(), frame.durations.size(), code, 1UL << t)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Decodes every frame iterations times; returns ns per frame
+static uint64_t run(const std::vector<IrTraceFrame>& frames, uint32_t iterations, bool sequential, uint32_t& decoded) {
+  IrCode code;
+  memset(&code, 0, sizeof(code));
+  decoded = 0;
+  uint64_t started = nowNs();
+  for (uint32_t i = 0; i < iterations; i++) {
+    for (const IrTraceFrame& frame : frames) {
+      bool ok = sequential ? decodeSequential(frame, code)
+                           : irDecode(frame.durations.data(), frame.durations.size(), code);
+      if (i == 0 && ok) {
+        decoded++;
+      }
+    }
+  }
+  uint64_t frameCount = (uint64_t)iterations * frames.size();
+  return frameCount ? (nowNs() - started) / frameCount : 0;
+}
+
+static void report(const char* name, size_t frames, uint32_t iterations, uint64_t ns, uint32_t decoded) {
+  printf("bench=%s ops=%llu time_per_op=%llu unit=ns frames=%u decoded=%u frames_per_s=%llu\n", name,
+         (unsigned long long)frames * iterations, (unsigned long long)ns, (unsigned)frames, (unsigned)decoded,
+         (unsigned long long)(ns ? 1000000000ULL / ns : 0));
+}
+
+int main(int argc, char** argv) {
+  uint32_t iterations = 20000;
+  std::vector<std::string> paths;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], nullptr, 10);
+    } else if (argv[i][0] != '-') {
+      paths.push_back(argv[i]);
+    } else {
+      fprintf(stderr, "usage: neoos_bench_irdecode [--iterations n] [trace ...]\n");
+      return 2;
+    }
+  }
+  if (iterations == 0) {
+    fprintf(stderr, "neoos_bench_irdecode: --iterations must be positive\n");
+    return 2;
+  }
+  if (paths.empty()) {
+    DIR* dir = opendir(NEOOS_IR_CORPUS_DIR);
+    if (dir != nullptr) {
+      for (dirent* entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+        if (entry->d_name[0] != '.') {
+          paths.push_back(std::string(NEOOS_IR_CORPUS_DIR "/") + entry->d_name);
+        }
+      }
+      closedir(dir);
+    }
+    std::sort(paths.begin(), paths.end());
+  }
+
+  std::vector<Corpus> corpora;
+  std::vector<IrTraceFrame> all;
+  for (const std::string& path : paths) {
+    Corpus corpus;
+    if (!irTraceLoad(path.c_str(), corpus.frames)) {
+      fprintf(stderr, "neoos_bench_irdecode: cannot read %s\n", path.c_str());
+      return 1;
+    }
+    size_t slash = path.rfind('/');
+    corpus.name = path.substr(slash == std::string::npos ? 0 : slash + 1);
+    corpus.name = corpus.name.substr(0, corpus.name.rfind('.'));
+    all.insert(all.end(), corpus.frames.begin(), corpus.frames.end());
+    corpora.push_back(corpus);
+  }
+  if (all.empty()) {
+    fprintf(stderr, "neoos_bench_irdecode: no frames to decode\n");
+    return 1;
+  }
+
+  printf("# irdecode-bench v1 unit=ns iterations=%u protocols=%u frames=%u\n", (unsigned)iterations,
+         (unsigned)irTimingCount(), (unsigned)all.size());
+  uint32_t decoded;
+  run(all, iterations, false, decoded);  // warm up caches and clocks
+  for (const Corpus& corpus : corpora) {
+    uint64_t ns = run(corpus.frames, iterations, false, decoded);
+    report(("decode_" + corpus.name).c_str(), corpus.frames.size(), iterations, ns, decoded);
+  }
+  uint64_t ns = run(all, iterations, false, decoded);
+  report("decode_corpus", all.size(), iterations, ns, decoded);
+  ns = run(all, iterations, true, decoded);
+  report("decode_corpus_sequential", all.size(), iterations, ns, decoded);
+  printf("# end\n");
+  return 0;
+}
\ No newline at end of file
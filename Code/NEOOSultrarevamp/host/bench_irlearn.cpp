@@ -0,0 +1,198 @@
+// Host benchmark for bulk remote learning: plays a synthetic 40-key
+// remote into the receiver pin, key after key with held keys, repeat
+// frames and keys pressed twice, while IrLearner polls as the LEARN
+// REMOTE screen does. Then saves the batch and, for comparison, adds
+// the same codes to a second library one insert() at a time.
+//
+//   neoos_bench_irlearn [--keys n] [--press ms]
+//
+// Prints what the session kept and dropped, its length in virtual time,
+// and the file writes and flushes each way of saving costs.
+
+#include "HostHal.h"
+#include "IrLearner.h"
+#include "IrLibrary.h"
+#include "IrProtocols.h"
+#include "IrTxQueue.h"
+
+#include <LittleFS.h>
+#include <chrono>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#define POLL_INTERVAL 100  // ms, as ACTION_STEP_INTERVAL
+
+static uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// xorshift32, so every run presses the same keys
+static uint32_t nextRandom(uint32_t& state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+// Key n of the remote: mostly NEC, some Samsung, and a few in a
+// pulse-distance format no decoder knows, which are learned as RAW
+static uint16_t encodeKey(uint32_t n, bool repeat, uint16_t* durations, uint16_t capacity) {
+  if (n % 8 == 7) {
+    if (repeat) {
+      return 0;
+    }
+    uint16_t count = 0;
+    durations[count++] = 3000;
+    durations[count++] = 3000;
+    for (uint8_t bit = 0; bit < 16 && count + 3 < capacity; bit++) {
+      durations[count++] = 500;
+      durations[count++] = ((n * 2654435761UL) >> bit) & 1 ? 1500 : 500;
+    }
+    durations[count++] = 500;
+    return count;
+  }
+  IrCode code;
+  memset(&code, 0, sizeof(code));
+  code.protocol = n % 8 == 3 ? IR_PROTOCOL_SAMSUNG : IR_PROTOCOL_NEC;
+  code.address = code.protocol == IR_PROTOCOL_SAMSUNG ? 0x707 : 0x04;
+  code.command = n;
+  if (repeat) {
+    if (!irHasRepeatFrame(code.protocol)) {
+      return irEncode(code, durations, capacity);
+    }
+    code.flags |= IR_CODE_FLAG_REPEAT;
+  }
+  return irEncode(code, durations, capacity);
+}
+
+// What the receiver makes of it: marks stretched, every edge jittered
+static void receive(uint64_t atMicros, const uint16_t* durations, uint16_t count, uint32_t& random) {
+  uint16_t received[IR_TX_MAX_DURATIONS];
+  for (uint16_t i = 0; i < count; i++) {
+    int jitter = (int)(nextRandom(random) % 81) - 40;
+    received[i] = durations[i] + (i % 2 == 0 ? IR_MARK_EXCESS : -IR_MARK_EXCESS) + jitter;
+  }
+  hostHal.irInjectAt(atMicros, IR_RECEIVE_PIN, received, count);
+}
+
+static bool openLibrary(const char* dir) {
+  hostHal.setFlashDir(dir);
+  return irLibrary.begin();
+}
+
+static void removeLibrary(const char* dir) {
+  hostHal.setFlashDir(dir);
+  LittleFS.remove(IR_LIBRARY_DIR "/codes.bin");
+  LittleFS.remove(IR_LIBRARY_DIR "/index.bin");
+  LittleFS.remove(IR_LIBRARY_DIR "/raw.bin");
+  LittleFS.rmdir(IR_LIBRARY_DIR);
+  rmdir(dir);
+}
+
+int main(int argc, char** argv) {
+  uint32_t keys = 40;
+  uint32_t pressMs = 1200;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--keys") == 0 && i + 1 < argc) {
+      keys = strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--press") == 0 && i + 1 < argc) {
+      pressMs = strtoul(argv[++i], nullptr, 10);
+    } else {
+      fprintf(stderr, "usage: neoos_bench_irlearn [--keys n] [--press ms]\n");
+      return 2;
+    }
+  }
+
+  char batchDir[] = "/tmp/neoos_irlearn_XXXXXX";
+  char eachDir[] = "/tmp/neoos_irlearn_XXXXXX";
+  if (mkdtemp(batchDir) == nullptr || mkdtemp(eachDir) == nullptr || !openLibrary(batchDir)) {
+    fprintf(stderr, "neoos_bench_irlearn: cannot create a library\n");
+    return 1;
+  }
+
+  // One key press every pressMs: the frame, then held for 0-3 protocol
+  // periods; every fifth key is pressed a second time
+  uint32_t random = 0x13579BDFUL;
+  uint64_t at = 500000;
+  uint32_t presses = 0;
+  uint32_t frames = 0;
+  uint16_t durations[IR_TX_MAX_DURATIONS];
+  for (uint32_t n = 0; n < keys; n++) {
+    for (uint32_t press = 0; press < (n % 5 == 4 ? 2u : 1u); press++) {
+      uint32_t held = nextRandom(random) % 4;
+      uint64_t frameAt = at;
+      for (uint32_t f = 0; f <= held; f++) {
+        uint16_t count = encodeKey(n, f > 0, durations, IR_TX_MAX_DURATIONS);
+        if (count == 0) {
+          break;
+        }
+        receive(frameAt, durations, count, random);
+        frameAt += 108000;
+        frames++;
+      }
+      presses++;
+      at += pressMs * 1000ULL;
+    }
+  }
+
+  irLearner.begin();
+  uint64_t start = nowNs();
+  while (hostHal.now() < at) {
+    hostHal.advance(POLL_INTERVAL * 1000UL);
+    irLearner.poll();
+  }
+  uint64_t pollNs = nowNs() - start;
+
+  uint32_t writes = File::getWrites();
+  uint32_t flushes = File::getFlushes();
+  start = nowNs();
+  irLearner.end();
+  uint64_t batchNs = nowNs() - start;
+  uint32_t batchWrites = File::getWrites() - writes;
+  uint32_t batchFlushes = File::getFlushes() - flushes;
+
+  printf("bench=learn_session ops=%u time_per_op=%llu unit=ns presses=%u frames=%u learned=%u duplicates=%u "
+         "repeats=%u session_ms=%llu\n",
+         (unsigned)keys, (unsigned long long)(pollNs / std::max<uint32_t>(keys, 1)), (unsigned)presses,
+         (unsigned)frames, (unsigned)irLearner.getLearned(), (unsigned)irLearner.getDuplicates(),
+         (unsigned)irLearner.getRepeats(), (unsigned long long)(hostHal.now() / 1000));
+  printf("bench=commit_batch ops=%u time_per_op=%llu unit=ns writes=%u flushes=%u\n",
+         (unsigned)irLearner.getSaved(), (unsigned long long)(batchNs / std::max<uint16_t>(irLearner.getSaved(), 1)),
+         (unsigned)batchWrites, (unsigned)batchFlushes);
+
+  // The same codes, one insert() each
+  std::vector<IrCode> codes;
+  std::vector<std::vector<uint16_t> > raws;
+  for (uint32_t id = 0; id < irLibrary.size(); id++) {
+    IrCode code;
+    irLibrary.get(id, code);
+    std::vector<uint16_t> raw(IR_LIBRARY_MAX_RAW);
+    raw.resize(code.protocol == IR_PROTOCOL_RAW ? irLibrary.readRaw(code, raw.data(), raw.size()) : 0);
+    codes.push_back(code);
+    raws.push_back(raw);
+  }
+  irLibrary.end();
+  bool ok = openLibrary(eachDir);
+  writes = File::getWrites();
+  flushes = File::getFlushes();
+  start = nowNs();
+  for (size_t i = 0; ok && i < codes.size(); i++) {
+    ok = irLibrary.insert(codes[i], raws[i].empty() ? nullptr : raws[i].data(), raws[i].size()) >= 0;
+  }
+  uint64_t eachNs = nowNs() - start;
+  printf("bench=commit_each ops=%u time_per_op=%llu unit=ns writes=%u flushes=%u\n", (unsigned)codes.size(),
+         (unsigned long long)(eachNs / std::max<size_t>(codes.size(), 1)), (unsigned)(File::getWrites() - writes),
+         (unsigned)(File::getFlushes() - flushes));
+  irLibrary.end();
+
+  removeLibrary(batchDir);
+  removeLibrary(eachDir);
+  if (!ok || irLearner.getLearned() != keys || codes.size() != keys) {
+    fprintf(stderr, "neoos_bench_irlearn: expected %u codes, learned %u, saved %u\n", (unsigned)keys,
+            (unsigned)irLearner.getLearned(), (unsigned)codes.size());
+    return 1;
+  }
+  return 0;
+}
\ No newline at end of file
@@ -0,0 +1,254 @@
+// Host benchmark for IrLibrary: builds a library of synthetic codes in a
+// host directory through the LittleFS shim and times the operations the
+// firmware uses, next to a plain scan of the record file for reference.
+//
+//   neoos_bench_irlib [--entries n] [--lookups n] [--dir path]
+//
+// Without --dir the library goes to a temporary directory that is removed
+// afterwards. Compare two runs with scripts/bench_compare.py.
+
+#include "IrLibrary.h"
+#include "HostHal.h"
+
+#include <LittleFS.h>
+#include <chrono>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+static const char* const devices[] = {
+  "TV", "AC", "SOUNDBAR", "PROJECTR", "DVD", "FAN", "LIGHT", "CABLEBOX",
+  "RECEIVER", "CAMERA", "HEATER", "STREAMER"
+};
+
+static const char* const brands[] = {
+  "SAMSUNG", "LG", "SONY", "PANASONIC", "PHILIPS", "SHARP", "TOSHIBA", "HISENSE",
+  "TCL", "VIZIO", "DAIKIN", "MITSUBISHI", "FUJITSU", "HITACHI", "BOSE", "YAMAHA",
+  "DENON", "ONKYO", "PIONEER", "EPSON", "BENQ", "OPTOMA", "ROKU", "APPLE"
+};
+
+#define DEVICE_COUNT (sizeof(devices) / sizeof(devices[0]))
+#define BRAND_COUNT (sizeof(brands) / sizeof(brands[0]))
+
+static uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// xorshift32, so every run builds the same library
+static uint32_t nextRandom(uint32_t& state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+// Entry n always gets the same, unique key
+static void makeKey(uint32_t n, IrCodeKey& key) {
+  char function[IR_KEY_FUNCTION + 1];
+  snprintf(function, sizeof(function), "FN%05u", (unsigned)(n / (DEVICE_COUNT * BRAND_COUNT)));
+  irCodeKeySet(key, devices[n % DEVICE_COUNT], brands[(n / DEVICE_COUNT) % BRAND_COUNT], function);
+}
+
+static void report(const char* name, uint32_t ops, uint64_t elapsed, const char* extra) {
+  printf("bench=%s ops=%u time_per_op=%llu unit=ns%s%s\n", name, (unsigned)ops,
+         (unsigned long long)(ops ? elapsed / ops : 0), extra[0] ? " " : "", extra);
+}
+
+static bool countCode(const IrCodeKey& key, uint32_t id, void* context) {
+  (*static_cast<uint32_t*>(context))++;
+  return true;
+}
+
+// What lookups cost without the index: read records until the key matches
+static int32_t scanRecords(File& codes, const IrCodeKey& key, uint32_t count) {
+  IrCode records[IR_LIBRARY_CHUNK];
+  codes.seek(IR_LIBRARY_HEADER_SIZE);
+  for (uint32_t id = 0; id < count; id += IR_LIBRARY_CHUNK) {
+    uint32_t batch = std::min<uint32_t>(count - id, IR_LIBRARY_CHUNK);
+    codes.read(reinterpret_cast<uint8_t*>(records), batch * sizeof(IrCode));
+    for (uint32_t i = 0; i < batch; i++) {
+      if (irCodeKeyCompare(records[i].key, key) == 0) {
+        return id + i;
+      }
+    }
+  }
+  return -1;
+}
+
+static size_t fileBytes(const char* path) {
+  File file = LittleFS.open(path, "r");
+  return file ? file.size() : 0;
+}
+
+int main(int argc, char** argv) {
+  uint32_t entries = 10000;
+  uint32_t lookups = 10000;
+  const char* dirOption = nullptr;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--entries") == 0 && i + 1 < argc) {
+      entries = strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--lookups") == 0 && i + 1 < argc) {
+      lookups = strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--dir") == 0 && i + 1 < argc) {
+      dirOption = argv[++i];
+    } else {
+      fprintf(stderr, "usage: neoos_bench_irlib [--entries n] [--lookups n] [--dir path]\n");
+      return 2;
+    }
+  }
+  if (entries == 0 || lookups == 0) {
+    fprintf(stderr, "neoos_bench_irlib: --entries and --lookups must be positive\n");
+    return 2;
+  }
+
+  char temporary[] = "/tmp/neoos_irlib_XXXXXX";
+  std::string root = dirOption != nullptr ? dirOption : "";
+  if (dirOption == nullptr) {
+    if (mkdtemp(temporary) == nullptr) {
+      fprintf(stderr, "neoos_bench_irlib: cannot create a temporary directory\n");
+      return 1;
+    }
+    root = temporary;
+  }
+  hostHal.setFlashDir(root.c_str());
+
+  // Start from an empty library
+  LittleFS.remove(IR_LIBRARY_DIR "/codes.bin");
+  LittleFS.remove(IR_LIBRARY_DIR "/index.bin");
+  LittleFS.remove(IR_LIBRARY_DIR "/raw.bin");
+
+  IrLibrary library;
+  if (!library.begin()) {
+    fprintf(stderr, "neoos_bench_irlib: cannot open a library in %s\n", root.c_str());
+    return 1;
+  }
+
+  printf("# irlib-bench v1 unit=ns entries=%u lookups=%u\n", (unsigned)entries, (unsigned)lookups);
+  char extra[160];
+
+  // Inserts in a shuffled order so the index really has to sort
+  std::vector<uint32_t> order(entries);
+  for (uint32_t i = 0; i < entries; i++) {
+    order[i] = i;
+  }
+  uint32_t state = 0x2545F491;
+  for (uint32_t i = entries - 1; i > 0; i--) {
+    std::swap(order[i], order[nextRandom(state) % (i + 1)]);
+  }
+
+  IrCode code;
+  memset(&code, 0, sizeof(code));
+  code.protocol = IR_PROTOCOL_NEC;
+  code.bits = 32;
+  code.carrierKHz = 38;
+  uint64_t started = nowNs();
+  for (uint32_t i = 0; i < entries; i++) {
+    makeKey(order[i], code.key);
+    code.address = order[i] & 0xFF;
+    code.command = order[i] >> 8;
+    if (library.insert(code) < 0) {
+      fprintf(stderr, "neoos_bench_irlib: insert %u failed\n", (unsigned)i);
+      return 1;
+    }
+  }
+  library.flush();
+  uint64_t elapsed = nowNs() - started;
+  snprintf(extra, sizeof(extra), "merges=%u codes_bytes=%u index_bytes=%u", (unsigned)library.getMerges(),
+           (unsigned)fileBytes(IR_LIBRARY_DIR "/codes.bin"), (unsigned)fileBytes(IR_LIBRARY_DIR "/index.bin"));
+  report("insert", entries, elapsed, extra);
+
+  // Hits check that the right record comes back
+  IrCodeKey key;
+  uint32_t wrong = 0;
+  uint32_t readsBefore = library.getEntryReads();
+  started = nowNs();
+  for (uint32_t i = 0; i < lookups; i++) {
+    uint32_t n = nextRandom(state) % entries;
+    makeKey(n, key);
+    IrCode found;
+    if (library.find(key, &found) < 0 || found.address != (n & 0xFF) || found.command != (n >> 8)) {
+      wrong++;
+    }
+  }
+  elapsed = nowNs() - started;
+  snprintf(extra, sizeof(extra), "entry_reads_per_op=%u wrong=%u",
+           (unsigned)((library.getEntryReads() - readsBefore) / lookups), (unsigned)wrong);
+  report("lookup_hit", lookups, elapsed, extra);
+
+  uint32_t found = 0;
+  readsBefore = library.getEntryReads();
+  started = nowNs();
+  for (uint32_t i = 0; i < lookups; i++) {
+    makeKey(entries + nextRandom(state) % entries, key);
+    if (library.find(key) >= 0) {
+      found++;
+    }
+  }
+  elapsed = nowNs() - started;
+  snprintf(extra, sizeof(extra), "entry_reads_per_op=%u wrong=%u",
+           (unsigned)((library.getEntryReads() - readsBefore) / lookups), (unsigned)found);
+  report("lookup_miss", lookups, elapsed, extra);
+
+  // Inserts that stay in the pending tail, found by the linear part
+  uint32_t tail = IR_LIBRARY_PENDING_MAX - 1;
+  for (uint32_t i = 0; i < tail; i++) {
+    makeKey(2 * entries + i, code.key);
+    library.insert(code);
+  }
+  started = nowNs();
+  for (uint32_t i = 0; i < lookups; i++) {
+    makeKey(2 * entries + nextRandom(state) % tail, key);
+    library.find(key);
+  }
+  elapsed = nowNs() - started;
+  report("lookup_pending", lookups, elapsed, "");
+
+  uint32_t listed = 0;
+  started = nowNs();
+  for (uint32_t i = 0; i < DEVICE_COUNT; i++) {
+    library.list(countCode, &listed, devices[i]);
+  }
+  elapsed = nowNs() - started;
+  snprintf(extra, sizeof(extra), "devices=%u", (unsigned)DEVICE_COUNT);
+  report("list_device", listed, elapsed, extra);
+
+  uint32_t page = 0;
+  uint32_t pages = std::min<uint32_t>(lookups, 1000);
+  started = nowNs();
+  for (uint32_t i = 0; i < pages; i++) {
+    library.list(countCode, &page, nullptr, nullptr, nextRandom(state) % library.size(), 3);
+  }
+  elapsed = nowNs() - started;
+  report("list_page", pages, elapsed, "rows=3");
+
+  // Reference: the same hits without an index, on fewer lookups
+  uint32_t scans = std::max<uint32_t>(lookups / 50, 1);
+  File records = LittleFS.open(IR_LIBRARY_DIR "/codes.bin", "r");
+  started = nowNs();
+  for (uint32_t i = 0; i < scans; i++) {
+    makeKey(nextRandom(state) % entries, key);
+    scanRecords(records, key, library.size());
+  }
+  elapsed = nowNs() - started;
+  records.close();
+  report("linear_scan", scans, elapsed, "");
+
+  library.end();
+  started = nowNs();
+  bool reopened = library.begin();
+  elapsed = nowNs() - started;
+  snprintf(extra, sizeof(extra), "ok=%u", reopened ? 1 : 0);
+  report("reopen", 1, elapsed, extra);
+  library.end();
+  printf("# end\n");
+
+  if (dirOption == nullptr) {
+    LittleFS.remove(IR_LIBRARY_DIR "/codes.bin");
+    LittleFS.remove(IR_LIBRARY_DIR "/index.bin");
+    LittleFS.remove(IR_LIBRARY_DIR "/raw.bin");
+    LittleFS.rmdir(IR_LIBRARY_DIR);
+    rmdir(temporary);
+  }
+  return wrong == 0 && found == 0 && reopened ? 0 : 1;
+}
\ No newline at end of file
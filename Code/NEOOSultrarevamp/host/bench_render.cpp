@@ -0,0 +1,33 @@
+// Host driver for RenderBench: runs the menu draw paths against a panel
+// without a bus and prints the results to stdout.
+//
+//   neoos_bench_render [--iterations n] [--u8g2]
+//
+// --u8g2 draws through u8g2 instead of the Blitter. Compare two runs
+// with scripts/bench_compare.py.
+
+#include "RenderBench.h"
+#include "HostHal.h"
+
+int main(int argc, char** argv) {
+  uint32_t iterations = RENDER_BENCH_HOST_ITERATIONS;
+  bool blitter = true;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--u8g2") == 0) {
+      blitter = false;
+    } else {
+      fprintf(stderr, "usage: neoos_bench_render [--iterations n] [--u8g2]\n");
+      return 2;
+    }
+  }
+
+  DisplayManager display(DISPLAY_HOST_STUB);
+  display.init();
+  display.setBlitter(blitter);
+
+  RenderBench bench(&display);
+  bench.run(Serial, iterations);
+  return 0;
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+// Host benchmark for the oscilloscope's min/max decimation: folds one
+// second of synthetic ADC results through scopeDecimate() a DMA frame at
+// a time, as the device does, for each samples-per-column the timebases
+// use, and prints the time per frame next to a straightforward
+// per-sample reference. Both must give the same columns.
+//
+//   neoos_bench_scope [--iterations n]
+//
+// The signal is a 50 Hz sine with noise and a one-sample spike to full
+// scale every ~1000 samples. spikes_shown counts the spikes that reach
+// a column's max; spikes_picked counts what a plain one-sample-per-column
+// decimation would have kept. Compare two runs with
+// scripts/bench_compare.py.
+
+#include "AdcScope.h"
+
+#include <chrono>
+#include <math.h>
+#include <vector>
+
+#define BENCH_SECONDS 1
+#define BENCH_SPIKE_EVERY 997
+
+static const uint32_t perColumns[] = {1, 5, 25, 100, 500};
+
+static uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t randomState = 0x1234567;
+
+static uint32_t nextRandom() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+// Results as the C3's DMA writes them: channel and unit bits above the data
+static void synthesise(std::vector<uint32_t>& words, std::vector<uint32_t>& spikes) {
+  size_t count = (size_t)SCOPE_SAMPLE_RATE * BENCH_SECONDS;
+  for (size_t i = 0; i < count; i++) {
+    double phase = 2 * M_PI * 50 * i / SCOPE_SAMPLE_RATE;
+    int value = 2048 + (int)(1500 * sin(phase)) + (int)(nextRandom() % 41) - 20;
+    if (i % BENCH_SPIKE_EVERY == BENCH_SPIKE_EVERY / 2) {
+      value = SCOPE_MAX_VALUE;
+      spikes.push_back(i);
+    }
+    words.push_back((uint32_t)value | (0x5U << 13));
+  }
+}
+
+// One branchy pass per sample, column from a division
+static void reference(const std::vector<uint32_t>& words, uint32_t perColumn, std::vector<ScopeColumn>& out) {
+  out.assign(words.size() / perColumn, ScopeColumn());
+  for (size_t i = 0; i < out.size() * perColumn; i++) {
+    ScopeColumn& column = out[i / perColumn];
+    uint16_t value = SCOPE_SAMPLE(words[i]);
+    if (i % perColumn == 0) {
+      column.low = value;
+      column.high = value;
+    }
+    if (value < column.low) {
+      column.low = value;
+    }
+    if (value > column.high) {
+      column.high = value;
+    }
+  }
+}
+
+static void kernel(const std::vector<uint32_t>& words, uint32_t perColumn, std::vector<ScopeColumn>& out) {
+  out.resize(words.size() / perColumn);
+  ScopeDecimator state;
+  scopeDecimatorReset(state, perColumn);
+  size_t filled = 0;
+  for (size_t first = 0; first < words.size(); first += SCOPE_FRAME_SAMPLES) {
+    size_t count = std::min<size_t>(SCOPE_FRAME_SAMPLES, words.size() - first);
+    size_t columns;
+    scopeDecimate(state, words.data() + first, count, out.data() + filled, out.size() - filled, columns);
+    filled += columns;
+  }
+}
+
+int main(int argc, char** argv) {
+  uint32_t iterations = 50;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], nullptr, 10);
+    } else {
+      fprintf(stderr, "usage: neoos_bench_scope [--iterations n]\n");
+      return 2;
+    }
+  }
+  if (iterations == 0) {
+    fprintf(stderr, "neoos_bench_scope: --iterations must be positive\n");
+    return 2;
+  }
+
+  std::vector<uint32_t> words;
+  std::vector<uint32_t> spikes;
+  synthesise(words, spikes);
+  size_t frames = (words.size() + SCOPE_FRAME_SAMPLES - 1) / SCOPE_FRAME_SAMPLES;
+
+  printf("# scope-bench v1 unit=ns iterations=%u samples=%u frame=%u rate=%u\n", (unsigned)iterations,
+         (unsigned)words.size(), SCOPE_FRAME_SAMPLES, SCOPE_SAMPLE_RATE);
+  bool failed = false;
+  std::vector<ScopeColumn> expected;
+  std::vector<ScopeColumn> columns;
+  for (uint32_t perColumn : perColumns) {
+    uint64_t started = nowNs();
+    for (uint32_t i = 0; i < iterations; i++) {
+      reference(words, perColumn, expected);
+    }
+    uint64_t referenceNs = (nowNs() - started) / iterations / frames;
+
+    started = nowNs();
+    for (uint32_t i = 0; i < iterations; i++) {
+      kernel(words, perColumn, columns);
+    }
+    uint64_t kernelNs = (nowNs() - started) / iterations / frames;
+
+    bool match = columns.size() == expected.size();
+    for (size_t c = 0; match && c < columns.size(); c++) {
+      match = columns[c].low == expected[c].low && columns[c].high == expected[c].high;
+    }
+    failed |= !match;
+
+    unsigned shown = 0;
+    unsigned picked = 0;
+    for (uint32_t at : spikes) {
+      if (at / perColumn < columns.size()) {
+        shown += columns[at / perColumn].high == SCOPE_MAX_VALUE;
+        picked += at % perColumn == 0;
+      }
+    }
+    printf("bench=scope_decimate_%u ops=%u time_per_op=%llu time_reference=%llu unit=ns columns=%u spikes=%u "
+           "spikes_shown=%u spikes_picked=%u match=%d\n",
+           (unsigned)perColumn, (unsigned)(iterations * frames), (unsigned long long)kernelNs,
+           (unsigned long long)referenceNs, (unsigned)columns.size(), (unsigned)spikes.size(), shown, picked,
+           match ? 1 : 0);
+  }
+  printf("# end\n");
+  return failed ? 1 : 0;
+}
\ No newline at end of file
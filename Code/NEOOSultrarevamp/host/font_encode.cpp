@@ -0,0 +1,542 @@
+// Writes U8g2Fonts.cpp, the host's fonts: two bitmap faces (3x5 and 5x7)
+// scaled and spaced to roughly match the u8g2 fonts the sketch uses, in
+// the u8g2 font format as bdfconv encodes u8g2's own fonts. The Blitter
+// and the U8g2 shim then decode the same bytes they would on the device.
+//
+//   neoos_font_encode > U8g2Fonts.cpp
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#define FIRST_GLYPH 0x20
+#define LAST_GLYPH 0x7E
+#define MIN_RUN_BITS 2    // run length field widths bdfconv tries
+#define MAX_RUN_BITS 7
+#define BYTES_PER_LINE 16
+
+// u8g2 font header, 23 bytes before the glyphs
+#define HEADER_SIZE 23
+#define HEADER_START_UPPER_A 17
+#define HEADER_START_LOWER_A 19
+#define HEADER_START_UNICODE 21
+
+// Column-major glyphs for 0x20..0x7E, bit 0 = top row.
+// Lower case letters reuse the capitals at this size
+static const uint8_t glyphs3x5[] = {
+  0x00, 0x00, 0x00,  // space
+  0x00, 0x17, 0x00,  // !
+  0x03, 0x00, 0x03,  // "
+  0x1F, 0x0A, 0x1F,  // #
+  0x12, 0x1F, 0x09,  // $
+  0x09, 0x04, 0x12,  // %
+  0x0A, 0x15, 0x1A,  // &
+  0x00, 0x03, 0x00,  // '
+  0x00, 0x0E, 0x11,  // (
+  0x11, 0x0E, 0x00,  // )
+  0x0A, 0x04, 0x0A,  // *
+  0x04, 0x0E, 0x04,  // +
+  0x10, 0x08, 0x00,  // ,
+  0x04, 0x04, 0x04,  // -
+  0x00, 0x10, 0x00,  // .
+  0x18, 0x04, 0x03,  // /
+  0x1F, 0x11, 0x1F,  // 0
+  0x12, 0x1F, 0x10,  // 1
+  0x1D, 0x15, 0x17,  // 2
+  0x11, 0x15, 0x1F,  // 3
+  0x07, 0x04, 0x1F,  // 4
+  0x17, 0x15, 0x1D,  // 5
+  0x1F, 0x15, 0x1D,  // 6
+  0x01, 0x1D, 0x03,  // 7
+  0x1F, 0x15, 0x1F,  // 8
+  0x17, 0x15, 0x1F,  // 9
+  0x00, 0x0A, 0x00,  // :
+  0x10, 0x0A, 0x00,  // ;
+  0x04, 0x0A, 0x11,  // <
+  0x0A, 0x0A, 0x0A,  // =
+  0x11, 0x0A, 0x04,  // >
+  0x01, 0x15, 0x03,  // ?
+  0x0E, 0x15, 0x16,  // @
+  0x1E, 0x05, 0x1E,  // A
+  0x1F, 0x15, 0x0A,  // B
+  0x0E, 0x11, 0x11,  // C
+  0x1F, 0x11, 0x0E,  // D
+  0x1F, 0x15, 0x11,  // E
+  0x1F, 0x05, 0x01,  // F
+  0x0E, 0x11, 0x1D,  // G
+  0x1F, 0x04, 0x1F,  // H
+  0x11, 0x1F, 0x11,  // I
+  0x08, 0x10, 0x0F,  // J
+  0x1F, 0x04, 0x1B,  // K
+  0x1F, 0x10, 0x10,  // L
+  0x1F, 0x06, 0x1F,  // M
+  0x1F, 0x0E, 0x1F,  // N
+  0x0E, 0x11, 0x0E,  // O
+  0x1F, 0x05, 0x02,  // P
+  0x0E, 0x19, 0x1E,  // Q
+  0x1F, 0x05, 0x1A,  // R
+  0x12, 0x15, 0x09,  // S
+  0x01, 0x1F, 0x01,  // T
+  0x0F, 0x10, 0x1F,  // U
+  0x07, 0x18, 0x07,  // V
+  0x1F, 0x0C, 0x1F,  // W
+  0x1B, 0x04, 0x1B,  // X
+  0x03, 0x1C, 0x03,  // Y
+  0x19, 0x15, 0x13,  // Z
+  0x1F, 0x11, 0x00,  // [
+  0x03, 0x04, 0x18,  // backslash
+  0x00, 0x11, 0x1F,  // ]
+  0x02, 0x01, 0x02,  // ^
+  0x10, 0x10, 0x10,  // _
+  0x01, 0x02, 0x00,  // `
+  0x1E, 0x05, 0x1E,  // a
+  0x1F, 0x15, 0x0A,  // b
+  0x0E, 0x11, 0x11,  // c
+  0x1F, 0x11, 0x0E,  // d
+  0x1F, 0x15, 0x11,  // e
+  0x1F, 0x05, 0x01,  // f
+  0x0E, 0x11, 0x1D,  // g
+  0x1F, 0x04, 0x1F,  // h
+  0x11, 0x1F, 0x11,  // i
+  0x08, 0x10, 0x0F,  // j
+  0x1F, 0x04, 0x1B,  // k
+  0x1F, 0x10, 0x10,  // l
+  0x1F, 0x06, 0x1F,  // m
+  0x1F, 0x0E, 0x1F,  // n
+  0x0E, 0x11, 0x0E,  // o
+  0x1F, 0x05, 0x02,  // p
+  0x0E, 0x19, 0x1E,  // q
+  0x1F, 0x05, 0x1A,  // r
+  0x12, 0x15, 0x09,  // s
+  0x01, 0x1F, 0x01,  // t
+  0x0F, 0x10, 0x1F,  // u
+  0x07, 0x18, 0x07,  // v
+  0x1F, 0x0C, 0x1F,  // w
+  0x1B, 0x04, 0x1B,  // x
+  0x03, 0x1C, 0x03,  // y
+  0x19, 0x15, 0x13,  // z
+  0x04, 0x1F, 0x11,  // {
+  0x00, 0x1F, 0x00,  // |
+  0x11, 0x1F, 0x04,  // }
+  0x04, 0x06, 0x02,  // ~
+};
+
+static const uint8_t glyphs5x7[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00,  // space
+  0x00, 0x00, 0x5F, 0x00, 0x00,  // !
+  0x00, 0x07, 0x00, 0x07, 0x00,  // "
+  0x14, 0x7F, 0x14, 0x7F, 0x14,  // #
+  0x24, 0x2A, 0x7F, 0x2A, 0x12,  // $
+  0x23, 0x13, 0x08, 0x64, 0x62,  // %
+  0x36, 0x49, 0x55, 0x22, 0x50,  // &
+  0x00, 0x05, 0x03, 0x00, 0x00,  // '
+  0x00, 0x1C, 0x22, 0x41, 0x00,  // (
+  0x00, 0x41, 0x22, 0x1C, 0x00,  // )
+  0x08, 0x2A, 0x1C, 0x2A, 0x08,  // *
+  0x08, 0x08, 0x3E, 0x08, 0x08,  // +
+  0x00, 0x50, 0x30, 0x00, 0x00,  // ,
+  0x08, 0x08, 0x08, 0x08, 0x08,  // -
+  0x00, 0x60, 0x60, 0x00, 0x00,  // .
+  0x20, 0x10, 0x08, 0x04, 0x02,  // /
+  0x3E, 0x51, 0x49, 0x45, 0x3E,  // 0
+  0x00, 0x42, 0x7F, 0x40, 0x00,  // 1
+  0x42, 0x61, 0x51, 0x49, 0x46,  // 2
+  0x21, 0x41, 0x45, 0x4B, 0x31,  // 3
+  0x18, 0x14, 0x12, 0x7F, 0x10,  // 4
+  0x27, 0x45, 0x45, 0x45, 0x39,  // 5
+  0x3C, 0x4A, 0x49, 0x49, 0x30,  // 6
+  0x01, 0x71, 0x09, 0x05, 0x03,  // 7
+  0x36, 0x49, 0x49, 0x49, 0x36,  // 8
+  0x06, 0x49, 0x49, 0x29, 0x1E,  // 9
+  0x00, 0x36, 0x36, 0x00, 0x00,  // :
+  0x00, 0x56, 0x36, 0x00, 0x00,  // ;
+  0x08, 0x14, 0x22, 0x41, 0x00,  // <
+  0x14, 0x14, 0x14, 0x14, 0x14,  // =
+  0x00, 0x41, 0x22, 0x14, 0x08,  // >
+  0x02, 0x01, 0x51, 0x09, 0x06,  // ?
+  0x32, 0x49, 0x79, 0x41, 0x3E,  // @
+  0x7E, 0x11, 0x11, 0x11, 0x7E,  // A
+  0x7F, 0x49, 0x49, 0x49, 0x36,  // B
+  0x3E, 0x41, 0x41, 0x41, 0x22,  // C
+  0x7F, 0x41, 0x41, 0x22, 0x1C,  // D
+  0x7F, 0x49, 0x49, 0x49, 0x41,  // E
+  0x7F, 0x09, 0x09, 0x01, 0x01,  // F
+  0x3E, 0x41, 0x41, 0x51, 0x32,  // G
+  0x7F, 0x08, 0x08, 0x08, 0x7F,  // H
+  0x00, 0x41, 0x7F, 0x41, 0x00,  // I
+  0x20, 0x40, 0x41, 0x3F, 0x01,  // J
+  0x7F, 0x08, 0x14, 0x22, 0x41,  // K
+  0x7F, 0x40, 0x40, 0x40, 0x40,  // L
+  0x7F, 0x02, 0x04, 0x02, 0x7F,  // M
+  0x7F, 0x04, 0x08, 0x10, 0x7F,  // N
+  0x3E, 0x41, 0x41, 0x41, 0x3E,  // O
+  0x7F, 0x09, 0x09, 0x09, 0x06,  // P
+  0x3E, 0x41, 0x51, 0x21, 0x5E,  // Q
+  0x7F, 0x09, 0x19, 0x29, 0x46,  // R
+  0x46, 0x49, 0x49, 0x49, 0x31,  // S
+  0x01, 0x01, 0x7F, 0x01, 0x01,  // T
+  0x3F, 0x40, 0x40, 0x40, 0x3F,  // U
+  0x1F, 0x20, 0x40, 0x20, 0x1F,  // V
+  0x7F, 0x20, 0x18, 0x20, 0x7F,  // W
+  0x63, 0x14, 0x08, 0x14, 0x63,  // X
+  0x03, 0x04, 0x78, 0x04, 0x03,  // Y
+  0x61, 0x51, 0x49, 0x45, 0x43,  // Z
+  0x00, 0x7F, 0x41, 0x41, 0x00,  // [
+  0x02, 0x04, 0x08, 0x10, 0x20,  // backslash
+  0x00, 0x41, 0x41, 0x7F, 0x00,  // ]
+  0x04, 0x02, 0x01, 0x02, 0x04,  // ^
+  0x40, 0x40, 0x40, 0x40, 0x40,  // _
+  0x00, 0x01, 0x02, 0x04, 0x00,  // `
+  0x20, 0x54, 0x54, 0x54, 0x78,  // a
+  0x7F, 0x48, 0x44, 0x44, 0x38,  // b
+  0x38, 0x44, 0x44, 0x44, 0x20,  // c
+  0x38, 0x44, 0x44, 0x48, 0x7F,  // d
+  0x38, 0x54, 0x54, 0x54, 0x18,  // e
+  0x08, 0x7E, 0x09, 0x01, 0x02,  // f
+  0x08, 0x14, 0x54, 0x54, 0x3C,  // g
+  0x7F, 0x08, 0x04, 0x04, 0x78,  // h
+  0x00, 0x44, 0x7D, 0x40, 0x00,  // i
+  0x20, 0x40, 0x44, 0x3D, 0x00,  // j
+  0x00, 0x7F, 0x10, 0x28, 0x44,  // k
+  0x00, 0x41, 0x7F, 0x40, 0x00,  // l
+  0x7C, 0x04, 0x18, 0x04, 0x78,  // m
+  0x7C, 0x08, 0x04, 0x04, 0x78,  // n
+  0x38, 0x44, 0x44, 0x44, 0x38,  // o
+  0x7C, 0x14, 0x14, 0x14, 0x08,  // p
+  0x08, 0x14, 0x14, 0x18, 0x7C,  // q
+  0x7C, 0x08, 0x04, 0x04, 0x08,  // r
+  0x48, 0x54, 0x54, 0x54, 0x20,  // s
+  0x04, 0x3F, 0x44, 0x40, 0x20,  // t
+  0x3C, 0x40, 0x40, 0x20, 0x7C,  // u
+  0x1C, 0x20, 0x40, 0x20, 0x1C,  // v
+  0x3C, 0x40, 0x30, 0x40, 0x3C,  // w
+  0x44, 0x28, 0x10, 0x28, 0x44,  // x
+  0x0C, 0x50, 0x50, 0x50, 0x3C,  // y
+  0x44, 0x64, 0x54, 0x4C, 0x44,  // z
+  0x00, 0x08, 0x36, 0x41, 0x00,  // {
+  0x00, 0x00, 0x7F, 0x00, 0x00,  // |
+  0x00, 0x41, 0x36, 0x08, 0x00,  // }
+  0x02, 0x01, 0x02, 0x04, 0x02,  // ~
+};
+struct Face {
+  const uint8_t* glyphs;
+  uint8_t columns;
+  uint8_t rows;
+};
+
+static const Face face3x5 = {glyphs3x5, 3, 5};
+static const Face face5x7 = {glyphs5x7, 5, 7};
+
+// A font and the metrics of the u8g2 font it stands in for
+struct FontSpec {
+  const char* name;
+  const Face* face;
+  uint8_t scale;
+  uint8_t advance;
+  uint8_t ascent;
+  uint8_t descent;
+  uint8_t height;  // max char height
+};
+
+static const FontSpec fonts[] = {
+  {"u8g2_font_4x6_tr", &face3x5, 1, 4, 5, 1, 6},
+  {"u8g2_font_4x6_tf", &face3x5, 1, 4, 5, 1, 6},
+  {"u8g2_font_6x10_tf", &face5x7, 1, 6, 7, 2, 10},
+  {"u8g2_font_6x12_tr", &face5x7, 1, 6, 8, 2, 12},
+  {"u8g2_font_profont17_tr", &face5x7, 2, 11, 14, 3, 17},
+  {"u8g2_font_doomalpha04_tr", &face5x7, 1, 6, 7, 1, 8},
+  {"u8g2_font_minicute_tr", &face5x7, 1, 6, 7, 2, 9},
+  {"u8g2_font_simple1_tr", &face5x7, 1, 6, 7, 1, 8},
+  {"u8g2_font_iconquadpix_m_all", &face5x7, 1, 6, 7, 1, 8}
+};
+
+// One glyph cut down to its ink, as bdfconv's bounding box mode 0 does
+struct Glyph {
+  uint8_t encoding;
+  uint8_t width;
+  uint8_t height;
+  int8_t x;
+  int8_t y;                  // bottom row above the baseline
+  std::vector<bool> pixels;  // row by row
+};
+
+// Bit counts of the glyph fields, shared by all glyphs of a font
+struct FieldBits {
+  uint8_t per0;
+  uint8_t per1;
+  uint8_t width;
+  uint8_t height;
+  uint8_t x;
+  uint8_t y;
+  uint8_t delta;
+};
+
+// Background and ink run lengths, each at most what its field holds
+struct Run {
+  uint8_t background;
+  uint8_t ink;
+};
+
+// Appends LSB first, as u8g2_font_decode_get_unsigned_bits() reads
+struct BitWriter {
+  std::vector<uint8_t> bytes;
+  uint8_t bit;
+};
+
+static void putBits(BitWriter& writer, unsigned value, uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) {
+    if (writer.bit == 0) {
+      writer.bytes.push_back(0);
+    }
+    if (value & (1U << i)) {
+      writer.bytes.back() |= 1 << writer.bit;
+    }
+    writer.bit = (writer.bit + 1) & 7;
+  }
+}
+
+static void putSignedBits(BitWriter& writer, int value, uint8_t count) {
+  putBits(writer, value + (1 << (count - 1)), count);
+}
+
+static uint8_t unsignedBits(unsigned maximum) {
+  uint8_t count = 1;
+  while ((maximum >> count) != 0) {
+    count++;
+  }
+  return count;
+}
+
+static uint8_t signedBits(int minimum, int maximum) {
+  uint8_t count = 1;
+  while (minimum < -(1 << (count - 1)) || maximum > (1 << (count - 1)) - 1) {
+    count++;
+  }
+  return count;
+}
+
+static Glyph cutGlyph(const FontSpec& font, uint8_t encoding) {
+  const Face& face = *font.face;
+  const uint8_t* source = face.glyphs + (encoding - FIRST_GLYPH) * face.columns;
+  int cellWidth = face.columns * font.scale;
+  int cellHeight = face.rows * font.scale;
+  int left = cellWidth;
+  int right = -1;
+  int top = cellHeight;
+  int bottom = -1;
+  for (int col = 0; col < cellWidth; col++) {
+    for (int row = 0; row < cellHeight; row++) {
+      if (source[col / font.scale] & (1 << (row / font.scale))) {
+        left = left < col ? left : col;
+        right = right > col ? right : col;
+        top = top < row ? top : row;
+        bottom = bottom > row ? bottom : row;
+      }
+    }
+  }
+
+  Glyph glyph;
+  glyph.encoding = encoding;
+  glyph.width = 0;
+  glyph.height = 0;
+  glyph.x = 0;
+  glyph.y = 0;
+  if (right < 0) {
+    // Blank: only the advance is stored
+    return glyph;
+  }
+  glyph.width = right - left + 1;
+  glyph.height = bottom - top + 1;
+  glyph.x = left;
+  glyph.y = cellHeight - 1 - bottom;
+  for (int row = top; row <= bottom; row++) {
+    for (int col = left; col <= right; col++) {
+      glyph.pixels.push_back((source[col / font.scale] & (1 << (row / font.scale))) != 0);
+    }
+  }
+  return glyph;
+}
+
+// Splits the pixels into background/ink pairs. A run too long for its
+// field goes on in the next pair, after an empty run of the other kind.
+static std::vector<Run> runsOf(const Glyph& glyph, uint8_t per0, uint8_t per1) {
+  std::vector<Run> runs;
+  unsigned maxBackground = (1U << per0) - 1;
+  unsigned maxInk = (1U << per1) - 1;
+  size_t i = 0;
+  size_t end = glyph.pixels.size();
+  while (i < end) {
+    Run run = {0, 0};
+    while (i < end && !glyph.pixels[i] && run.background < maxBackground) {
+      run.background++;
+      i++;
+    }
+    if (i == end || !glyph.pixels[i]) {
+      runs.push_back(run);
+      continue;
+    }
+    while (i < end && glyph.pixels[i] && run.ink < maxInk) {
+      run.ink++;
+      i++;
+    }
+    runs.push_back(run);
+  }
+  return runs;
+}
+
+// Each pair is followed by a repeat bit: 1 to draw the same pair again
+static void putRuns(BitWriter& writer, const std::vector<Run>& runs, uint8_t per0, uint8_t per1) {
+  for (size_t i = 0; i < runs.size(); i++) {
+    if (i == 0 || runs[i].background != runs[i - 1].background || runs[i].ink != runs[i - 1].ink) {
+      if (i > 0) {
+        putBits(writer, 0, 1);
+      }
+      putBits(writer, runs[i].background, per0);
+      putBits(writer, runs[i].ink, per1);
+    } else {
+      putBits(writer, 1, 1);
+    }
+  }
+  if (!runs.empty()) {
+    putBits(writer, 0, 1);
+  }
+}
+
+static size_t runBits(const std::vector<Glyph>& glyphs, uint8_t per0, uint8_t per1) {
+  size_t total = 0;
+  for (const Glyph& glyph : glyphs) {
+    BitWriter writer = {std::vector<uint8_t>(), 0};
+    putRuns(writer, runsOf(glyph, per0, per1), per0, per1);
+    total += writer.bytes.size() * 8 - (writer.bit == 0 ? 0 : 8 - writer.bit);
+  }
+  return total;
+}
+
+static FieldBits chooseBits(const FontSpec& font, const std::vector<Glyph>& glyphs) {
+  unsigned maxWidth = 0;
+  unsigned maxHeight = 0;
+  int minX = 0;
+  int maxX = 0;
+  int minY = 0;
+  int maxY = 0;
+  for (const Glyph& glyph : glyphs) {
+    maxWidth = glyph.width > maxWidth ? glyph.width : maxWidth;
+    maxHeight = glyph.height > maxHeight ? glyph.height : maxHeight;
+    minX = glyph.x < minX ? glyph.x : minX;
+    maxX = glyph.x > maxX ? glyph.x : maxX;
+    minY = glyph.y < minY ? glyph.y : minY;
+    maxY = glyph.y > maxY ? glyph.y : maxY;
+  }
+  FieldBits bits;
+  bits.width = unsignedBits(maxWidth);
+  bits.height = unsignedBits(maxHeight);
+  bits.x = signedBits(minX, maxX);
+  bits.y = signedBits(minY, maxY);
+  bits.delta = signedBits(0, font.advance);
+
+  // The run fields that pack the font smallest, as bdfconv searches them
+  size_t best = 0;
+  for (uint8_t per0 = MIN_RUN_BITS; per0 <= MAX_RUN_BITS; per0++) {
+    for (uint8_t per1 = MIN_RUN_BITS; per1 <= MAX_RUN_BITS; per1++) {
+      size_t size = runBits(glyphs, per0, per1);
+      if (best == 0 || size < best) {
+        best = size;
+        bits.per0 = per0;
+        bits.per1 = per1;
+      }
+    }
+  }
+  return bits;
+}
+
+static bool encodeFont(const FontSpec& font, std::vector<uint8_t>& out) {
+  std::vector<Glyph> glyphs;
+  for (unsigned encoding = FIRST_GLYPH; encoding <= LAST_GLYPH; encoding++) {
+    glyphs.push_back(cutGlyph(font, encoding));
+  }
+  FieldBits bits = chooseBits(font, glyphs);
+
+  out.assign(HEADER_SIZE, 0);
+  out[0] = glyphs.size();
+  out[1] = 0;  // bounding box mode: each glyph its own
+  out[2] = bits.per0;
+  out[3] = bits.per1;
+  out[4] = bits.width;
+  out[5] = bits.height;
+  out[6] = bits.x;
+  out[7] = bits.y;
+  out[8] = bits.delta;
+  out[9] = font.advance;  // max char width
+  out[10] = font.height;
+  out[11] = 0;  // font box x offset
+  out[12] = (uint8_t)-font.descent;
+  out[13] = font.ascent;
+  out[14] = (uint8_t)-font.descent;
+  out[15] = font.ascent;
+  out[16] = (uint8_t)-font.descent;
+
+  for (const Glyph& glyph : glyphs) {
+    size_t offset = out.size() - HEADER_SIZE;
+    if (glyph.encoding == 'A' || glyph.encoding == 'a') {
+      int field = glyph.encoding == 'A' ? HEADER_START_UPPER_A : HEADER_START_LOWER_A;
+      out[field] = offset >> 8;
+      out[field + 1] = offset & 0xFF;
+    }
+    BitWriter writer = {std::vector<uint8_t>(), 0};
+    putBits(writer, glyph.width, bits.width);
+    putBits(writer, glyph.height, bits.height);
+    putSignedBits(writer, glyph.x, bits.x);
+    putSignedBits(writer, glyph.y, bits.y);
+    putSignedBits(writer, font.advance, bits.delta);
+    putRuns(writer, runsOf(glyph, bits.per0, bits.per1), bits.per0, bits.per1);
+    // The second byte is the offset to the next glyph
+    if (writer.bytes.size() + 2 > 0xFF) {
+      fprintf(stderr, "neoos_font_encode: %s glyph 0x%02X too large\n", font.name, glyph.encoding);
+      return false;
+    }
+    out.push_back(glyph.encoding);
+    out.push_back(writer.bytes.size() + 2);
+    out.insert(out.end(), writer.bytes.begin(), writer.bytes.end());
+  }
+
+  // End of the 8-bit glyphs, then an empty Unicode table: one lookup
+  // entry that ends it, as bdfconv writes for a font without such glyphs
+  out.push_back(0);
+  out.push_back(0);
+  size_t unicode = out.size() - HEADER_SIZE;
+  out[HEADER_START_UNICODE] = unicode >> 8;
+  out[HEADER_START_UNICODE + 1] = unicode & 0xFF;
+  static const uint8_t unicodeEnd[] = {0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00};
+  out.insert(out.end(), unicodeEnd, unicodeEnd + sizeof(unicodeEnd));
+  return true;
+}
+
+int main(int argc, char** argv) {
+  if (argc != 1) {
+    fprintf(stderr, "usage: neoos_font_encode > U8g2Fonts.cpp\n");
+    return 2;
+  }
+  printf("// Generated by neoos_font_encode (font_encode.cpp); do not edit.\n");
+  printf("// Stand-ins for the u8g2 fonts the sketch uses, in the u8g2 font\n");
+  printf("// format, drawn from the 3x5 and 5x7 faces in font_encode.cpp.\n\n");
+  printf("#include \"U8g2lib.h\"\n");
+  for (const FontSpec& font : fonts) {
+    std::vector<uint8_t> bytes;
+    if (!encodeFont(font, bytes)) {
+      return 1;
+    }
+    printf("\n// %u glyphs, ascent %u, descent %u, advance %u\n", LAST_GLYPH - FIRST_GLYPH + 1,
+           font.ascent, font.descent, font.advance);
+    printf("const uint8_t %s[%u] = {", font.name, (unsigned)bytes.size());
+    for (size_t i = 0; i < bytes.size(); i++) {
+      printf("%s0x%02X%s", i % BYTES_PER_LINE == 0 ? "\n  " : "", bytes[i], i + 1 < bytes.size() ? "," : "");
+      if (i + 1 < bytes.size() && i % BYTES_PER_LINE != BYTES_PER_LINE - 1) {
+        printf(" ");
+      }
+    }
+    printf("\n};\n");
+  }
+  return 0;
+}
\ No newline at end of file
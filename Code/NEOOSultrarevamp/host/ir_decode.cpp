@@ -0,0 +1,68 @@
+// Runs the IrProtocols decoder over recorded traces and prints one line
+// per frame. With --check, frames must carry an "# expect" comment that
+// matches the result; scripts/ir/corpus is the regression corpus for it.
+//
+//   neoos_ir_decode [--check] [--sim-log] <trace> ...
+//
+// --sim-log reads neoos_sim --ir-log output, e.g. to decode what the
+// sketch transmitted.
+
+#include "IrTrace.h"
+
+int main(int argc, char** argv) {
+  bool check = false;
+  bool simLog = false;
+  int first = 1;
+  for (; first < argc && argv[first][0] == '-'; first++) {
+    if (strcmp(argv[first], "--check") == 0) {
+      check = true;
+    } else if (strcmp(argv[first], "--sim-log") == 0) {
+      simLog = true;
+    } else {
+      first = argc;
+    }
+  }
+  if (first >= argc) {
+    fprintf(stderr, "usage: neoos_ir_decode [--check] [--sim-log] <trace> ...\n");
+    return 2;
+  }
+
+  uint32_t total = 0;
+  uint32_t decoded = 0;
+  uint32_t failures = 0;
+  for (int i = first; i < argc; i++) {
+    std::vector<IrTraceFrame> frames;
+    if (!irTraceLoad(argv[i], frames, simLog)) {
+      fprintf(stderr, "neoos_ir_decode: cannot read %s\n", argv[i]);
+      return 1;
+    }
+    for (const IrTraceFrame& frame : frames) {
+      IrCode code;
+      memset(&code, 0, sizeof(code));
+      if (irDecode(frame.durations.data(), frame.durations.size(), code)) {
+        decoded++;
+      } else {
+        code.protocol = IR_PROTOCOL_RAW;
+      }
+      total++;
+      std::string result = irTraceDescribe(code);
+      const char* verdict = "";
+      if (check && result != frame.expect) {
+        verdict = frame.expect.empty() ? "  FAIL (no expectation)" : "  FAIL";
+        failures++;
+      }
+      printf("%s:%d %u durations: %s%s\n", argv[i], frame.line, (unsigned)frame.durations.size(),
+             result.c_str(), verdict);
+      if (*verdict != '\0' && !frame.expect.empty()) {
+        printf("    expected: %s\n", frame.expect.c_str());
+      }
+    }
+  }
+
+  fprintf(stderr, "frames=%u decoded=%u", (unsigned)total, (unsigned)decoded);
+  if (check) {
+    fprintf(stderr, " failures=%u", (unsigned)failures);
+  }
+  fprintf(stderr, "\n");
+  return failures == 0 ? 0 : 1;
+}
\ No newline at end of file
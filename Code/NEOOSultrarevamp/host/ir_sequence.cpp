@@ -0,0 +1,286 @@
+// Plays macros through IrSequencer::fill(), without the transmit queue,
+// and prints the frames of the edge timeline with their start times.
+// With --check each macro must produce exactly the frames listed after
+// it; scripts/ir/sequences.txt is the regression file for it.
+//
+//   neoos_ir_sequence [--check] <sequence file> ...
+//   neoos_ir_sequence --sim-log <ir log>
+//
+// Sequence files hold library codes, macros in the firmware syntax and
+// the frames each macro must produce, at exact start times in us:
+//   code TV/NEC/POWER NEC 0x4 0x8 [bits]
+//   code TV/RAW/INPUT RAW <trace file, relative to this one>
+//   HOLD: TV/NEC/POWER*2
+//   expect 0 NEC bits=32 address=0x4 command=0x8
+//   expect 108000 NEC repeat
+//
+// --sim-log reads neoos_sim --ir-log output instead and prints each frame
+// the sketch sent, its distance from the previous one and how far that
+// is from the protocol's period when it repeats the same key.
+
+#include "HostHal.h"
+#include "IrTrace.h"
+#include "IrLibrary.h"
+#include "IrSequencer.h"
+
+#include <LittleFS.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+struct Expectation {
+  uint64_t atMicros;
+  std::string frame;
+};
+
+struct SequenceMacro {
+  IrMacro macro;
+  int line;
+  std::vector<Expectation> expect;
+};
+
+static int protocolByName(const char* name) {
+  for (uint8_t p = 0; p < IR_PROTOCOL_COUNT; p++) {
+    if (strcmp(irProtocolName(p), name) == 0) {
+      return p;
+    }
+  }
+  return -1;
+}
+
+// "code DEVICE/BRAND/FUNCTION PROTOCOL address command [bits]" or
+// "code DEVICE/BRAND/FUNCTION RAW trace"
+static bool addCode(const char* path, char* arguments) {
+  const char* key = strtok(arguments, " \t\r\n");
+  const char* protocolName = strtok(nullptr, " \t\r\n");
+  const char* first = strtok(nullptr, " \t\r\n");
+  const char* second = strtok(nullptr, " \t\r\n");
+  const char* bits = strtok(nullptr, " \t\r\n");
+  IrMacro parsed;
+  std::string line = std::string("code: ") + (key != nullptr ? key : "");
+  int protocol = protocolName != nullptr ? protocolByName(protocolName) : -1;
+  if (key == nullptr || protocol < 0 || first == nullptr || !irMacroParse(line.c_str(), parsed)) {
+    return false;
+  }
+
+  IrCode code;
+  memset(&code, 0, sizeof(code));
+  code.key = parsed.steps[0].key;
+  code.protocol = protocol;
+  code.carrierKHz = IR_DEFAULT_CARRIER / 1000;
+  if (protocol == IR_PROTOCOL_RAW) {
+    std::string trace = path;
+    size_t slash = trace.rfind('/');
+    trace = (slash == std::string::npos ? std::string() : trace.substr(0, slash + 1)) + first;
+    std::vector<IrTraceFrame> frames;
+    if (!irTraceLoad(trace.c_str(), frames) || frames.empty()) {
+      return false;
+    }
+    return irLibrary.insert(code, frames[0].durations.data(), frames[0].durations.size()) >= 0;
+  }
+  if (second == nullptr) {
+    return false;
+  }
+  for (uint8_t t = 0; t < irTimingCount(); t++) {
+    if (irTiming(t).protocol == protocol && !(irTiming(t).flags & IR_TIMING_REPEAT)) {
+      code.carrierKHz = irTiming(t).carrierKHz;
+      break;
+    }
+  }
+  code.address = strtoul(first, nullptr, 0);
+  code.command = strtoul(second, nullptr, 0);
+  code.bits = bits != nullptr ? strtoul(bits, nullptr, 0) : 0;
+  return irLibrary.insert(code) >= 0;
+}
+
+static bool loadSequences(const char* path, std::vector<SequenceMacro>& macros) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    fprintf(stderr, "neoos_ir_sequence: cannot read %s\n", path);
+    return false;
+  }
+  char text[IR_MACRO_LINE];
+  bool ok = true;
+  for (int line = 1; ok && fgets(text, sizeof(text), file) != nullptr; line++) {
+    char* hash = strchr(text, '#');
+    if (hash != nullptr) {
+      *hash = '\0';
+    }
+    char* start = text + strspn(text, " \t\r\n");
+    if (*start == '\0') {
+      continue;
+    }
+    if (strncmp(start, "code ", 5) == 0) {
+      ok = addCode(path, start + 5);
+    } else if (strncmp(start, "expect ", 7) == 0) {
+      char* end;
+      Expectation expect;
+      expect.atMicros = strtoull(start + 7, &end, 10);
+      expect.frame = end + strspn(end, " \t");
+      expect.frame.erase(expect.frame.find_last_not_of(" \r\n") + 1);
+      ok = !macros.empty();
+      if (ok) {
+        macros.back().expect.push_back(expect);
+      }
+    } else {
+      SequenceMacro macro;
+      macro.line = line;
+      ok = irMacroParse(start, macro.macro);
+      if (ok) {
+        macros.push_back(macro);
+      }
+    }
+    if (!ok) {
+      fprintf(stderr, "neoos_ir_sequence: %s:%d: cannot use this line\n", path, line);
+    }
+  }
+  fclose(file);
+  return ok;
+}
+
+static std::string describe(const IrTraceFrame& frame, IrCode& code) {
+  memset(&code, 0, sizeof(code));
+  if (!irDecode(frame.durations.data(), frame.durations.size(), code)) {
+    code.protocol = IR_PROTOCOL_RAW;
+  }
+  return irTraceDescribe(code);
+}
+
+// Lays the slots fill() returns end to end, as the queue would send them
+// with no start latency, and cuts the timeline into frames
+static uint32_t play(const IrMacro& macro, std::vector<IrTraceFrame>& frames) {
+  static uint16_t slot[IR_TX_MAX_DURATIONS];
+  IrTraceSplitter splitter(frames);
+  uint64_t clock = 0;
+  uint32_t slots = 0;
+  irSequencer.load(macro);
+  for (;;) {
+    IrSequenceSlot filled;
+    uint16_t length = irSequencer.fill(slot, IR_TX_MAX_DURATIONS, filled);
+    if (length == 0) {
+      break;
+    }
+    splitter.restart(clock);
+    for (uint16_t i = 0; i < length; i++) {
+      splitter.add(slot[i]);
+    }
+    clock = splitter.getClock() + filled.gapUs;
+    slots++;
+  }
+  splitter.flush();
+  return slots;
+}
+
+static int checkSequences(int count, char** paths, bool check) {
+  char temporary[] = "/tmp/neoos_irseq_XXXXXX";
+  if (mkdtemp(temporary) == nullptr) {
+    fprintf(stderr, "neoos_ir_sequence: cannot create a temporary directory\n");
+    return 1;
+  }
+  hostHal.setFlashDir(temporary);
+
+  uint32_t total = 0;
+  uint32_t failures = 0;
+  int status = 0;
+  for (int i = 0; i < count && status == 0; i++) {
+    std::vector<SequenceMacro> macros;
+    if (!irLibrary.begin() || !loadSequences(paths[i], macros)) {
+      status = 1;
+    }
+    for (size_t m = 0; m < macros.size() && status == 0; m++) {
+      const SequenceMacro& macro = macros[m];
+      std::vector<IrTraceFrame> frames;
+      uint32_t slots = play(macro.macro, frames);
+      printf("%s:%d %s: %u frames in %u slots\n", paths[i], macro.line, macro.macro.name,
+             (unsigned)frames.size(), (unsigned)slots);
+      size_t rows = std::max(frames.size(), check ? macro.expect.size() : 0);
+      for (size_t f = 0; f < rows; f++) {
+        IrCode code;
+        std::string result = f < frames.size() ? describe(frames[f], code) : "(none)";
+        uint64_t at = f < frames.size() ? frames[f].atMicros : 0;
+        const char* verdict = "";
+        if (check && (f >= macro.expect.size() || macro.expect[f].atMicros != at ||
+                      macro.expect[f].frame != result)) {
+          verdict = "  FAIL";
+          failures++;
+        }
+        printf("  %10llu %s%s\n", (unsigned long long)at, result.c_str(), verdict);
+        if (*verdict != '\0' && f < macro.expect.size()) {
+          printf("    expected: %llu %s\n", (unsigned long long)macro.expect[f].atMicros,
+                 macro.expect[f].frame.c_str());
+        }
+      }
+      total += frames.size();
+    }
+    irLibrary.end();
+    LittleFS.remove(IR_LIBRARY_DIR "/codes.bin");
+    LittleFS.remove(IR_LIBRARY_DIR "/index.bin");
+    LittleFS.remove(IR_LIBRARY_DIR "/raw.bin");
+  }
+  LittleFS.rmdir(IR_LIBRARY_DIR);
+  rmdir(temporary);
+
+  fprintf(stderr, "frames=%u", (unsigned)total);
+  if (check) {
+    fprintf(stderr, " failures=%u", (unsigned)failures);
+  }
+  fprintf(stderr, "\n");
+  return status != 0 ? status : (failures == 0 ? 0 : 1);
+}
+
+static int printSimLog(const char* path) {
+  std::vector<IrTraceFrame> frames;
+  if (!irTraceLoad(path, frames, true)) {
+    fprintf(stderr, "neoos_ir_sequence: cannot read %s\n", path);
+    return 1;
+  }
+  std::string previous;
+  uint32_t previousPeriod = 0;
+  uint64_t previousAt = 0;
+  int64_t worst = 0;
+  uint32_t repeats = 0;
+  for (const IrTraceFrame& frame : frames) {
+    IrCode code;
+    std::string result = describe(frame, code);
+    uint64_t delta = frame.atMicros - previousAt;
+    printf("%12llu %+10lld %s", (unsigned long long)frame.atMicros,
+           previous.empty() ? 0LL : (long long)delta, result.c_str());
+    // A repeat frame, or the same frame again, continues the key press
+    bool repeat = code.protocol != IR_PROTOCOL_RAW && previousPeriod != 0 &&
+                  ((code.flags & IR_CODE_FLAG_REPEAT) || result == previous);
+    if (repeat) {
+      int64_t off = (int64_t)delta - previousPeriod;
+      printf("  period off by %+lld us", (long long)off);
+      worst = std::max<int64_t>(worst, off < 0 ? -off : off);
+      repeats++;
+    }
+    printf("\n");
+    previous = result;
+    previousPeriod = irFramePeriod(code);
+    previousAt = frame.atMicros;
+  }
+  fprintf(stderr, "frames=%u repeats=%u worst_period_error_us=%lld\n", (unsigned)frames.size(),
+          (unsigned)repeats, (long long)worst);
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  bool check = false;
+  bool simLog = false;
+  int first = 1;
+  for (; first < argc && argv[first][0] == '-'; first++) {
+    if (strcmp(argv[first], "--check") == 0) {
+      check = true;
+    } else if (strcmp(argv[first], "--sim-log") == 0) {
+      simLog = true;
+    } else {
+      first = argc;
+    }
+  }
+  if (first >= argc || (simLog && (check || first != argc - 1))) {
+    fprintf(stderr, "usage: neoos_ir_sequence [--check] <sequence file> ...\n"
+                    "       neoos_ir_sequence --sim-log <ir log>\n");
+    return 2;
+  }
+  return simLog ? printSimLog(argv[first]) : checkSequences(argc - first, argv + first, check);
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+// Decodes Logger frames captured from the serial port (or from
+// neoos_sim --serial-log) into text, one "[seconds.ms] L message" line
+// per frame. Plain text in the capture is passed through.
+//
+//   neoos_log_decode <capture>
+
+#include "LogDecoder.h"
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: neoos_log_decode <capture>\n");
+    return 2;
+  }
+  FILE* file = fopen(argv[1], "rb");
+  if (file == nullptr) {
+    fprintf(stderr, "neoos_log_decode: cannot read %s\n", argv[1]);
+    return 1;
+  }
+
+  LogDecoder decoder(stdout);
+  uint8_t buffer[4096];
+  size_t length;
+  while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    decoder.feed(buffer, length);
+  }
+  fclose(file);
+  decoder.finish();
+
+  fprintf(stderr, "frames=%u bad_frames=%u\n", (unsigned)decoder.getFrames(), (unsigned)decoder.getBadFrames());
+  return 0;
+}
\ No newline at end of file
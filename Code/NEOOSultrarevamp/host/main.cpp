@@ -0,0 +1,234 @@
+// Host runner for the NEOos sketch: builds the unmodified sketch against
+// the HostHal shims, replays a button script in virtual time and reports
+// what the firmware did.
+//
+//   neoos_sim [--script file] [--until ms] [--snapshots dir]
+//             [--dump-frames] [--serial-log file] [--ir-log file]
+//             [--flash dir] [--gpio-log file] [--quiet] [--check]
+//
+// --flash gives LittleFS a host directory (e.g. for the IR library);
+// without it the sketch runs with no storage. --gpio-log writes a line
+// per port write: time in us, mask and levels, both hex. With --check,
+// the script's "# expect sim.<name>=<value> ..." comments must match the
+// stats printed at the end, or the run fails.
+
+#include "../NEOos_ULTRAREVAMP_copy_20250403194543.ino"
+#include "HostHal.h"
+#include "LogDecoder.h"
+#include "AdcScope.h"
+#include "IrLearner.h"
+#include "IrLibrary.h"
+
+#include <map>
+#include <stdarg.h>
+#include <string>
+
+// Without --serial-log the console shows the log stream decoded
+static LogDecoder consoleLog(stdout);
+
+static void decodeSerial(const uint8_t* data, size_t length) {
+  consoleLog.feed(data, length);
+}
+
+static FILE* gpioLog = nullptr;
+
+static void logPort(uint64_t atMicros, uint32_t mask, uint32_t levels) {
+  fprintf(gpioLog, "%llu %08x %08x\n", (unsigned long long)atMicros, (unsigned)mask, (unsigned)(levels & mask));
+}
+
+static void usage() {
+  fprintf(stderr,
+          "usage: neoos_sim [--script file] [--until ms] [--snapshots dir]\n"
+          "                 [--dump-frames] [--serial-log file] [--ir-log file]\n"
+          "                 [--flash dir] [--gpio-log file] [--quiet] [--check]\n");
+}
+
+// Stats as printed, by name, for --check
+static std::map<std::string, std::string> printedStats;
+
+static void printStat(const char* name, const char* format, ...) {
+  char value[32];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(value, sizeof(value), format, args);
+  va_end(args);
+  printf("%s=%s\n", name, value);
+  printedStats[name] = value;
+}
+
+// Compares every "# expect" comment in the script with the stats;
+// returns the number of mismatches
+static uint32_t checkExpectations(const char* script) {
+  FILE* file = fopen(script, "r");
+  if (file == nullptr) {
+    return 1;
+  }
+  char line[256];
+  int lineNumber = 0;
+  uint32_t checked = 0;
+  uint32_t failures = 0;
+  while (fgets(line, sizeof(line), file)) {
+    lineNumber++;
+    const char* expect = strstr(line, "# expect ");
+    if (expect == nullptr) {
+      continue;
+    }
+    char* token = strtok(const_cast<char*>(expect) + 9, " \t\r\n");
+    for (; token != nullptr; token = strtok(nullptr, " \t\r\n")) {
+      char* equals = strchr(token, '=');
+      if (equals == nullptr) {
+        continue;
+      }
+      *equals = '\0';
+      std::map<std::string, std::string>::const_iterator stat = printedStats.find(token);
+      checked++;
+      if (stat == printedStats.end() || stat->second != equals + 1) {
+        fprintf(stderr, "%s:%d %s=%s  FAIL (got %s)\n", script, lineNumber, token, equals + 1,
+                stat == printedStats.end() ? "nothing" : stat->second.c_str());
+        failures++;
+      }
+    }
+  }
+  fclose(file);
+  fprintf(stderr, "expectations=%u failures=%u\n", (unsigned)checked, (unsigned)failures);
+  return failures;
+}
+
+int main(int argc, char** argv) {
+  const char* script = nullptr;
+  const char* serialLog = nullptr;
+  const char* irLog = nullptr;
+  const char* gpioLogPath = nullptr;
+  uint64_t untilMs = 10000;
+  bool quiet = false;
+  bool check = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--script") == 0 && i + 1 < argc) {
+      script = argv[++i];
+    } else if (strcmp(argv[i], "--until") == 0 && i + 1 < argc) {
+      untilMs = strtoull(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--snapshots") == 0 && i + 1 < argc) {
+      hostHal.setSnapshotDir(argv[++i]);
+    } else if (strcmp(argv[i], "--dump-frames") == 0) {
+      hostHal.setFrameDump(true);
+    } else if (strcmp(argv[i], "--serial-log") == 0 && i + 1 < argc) {
+      serialLog = argv[++i];
+    } else if (strcmp(argv[i], "--ir-log") == 0 && i + 1 < argc) {
+      irLog = argv[++i];
+    } else if (strcmp(argv[i], "--flash") == 0 && i + 1 < argc) {
+      hostHal.setFlashDir(argv[++i]);
+    } else if (strcmp(argv[i], "--gpio-log") == 0 && i + 1 < argc) {
+      gpioLogPath = argv[++i];
+    } else if (strcmp(argv[i], "--quiet") == 0) {
+      quiet = true;
+    } else if (strcmp(argv[i], "--check") == 0) {
+      check = true;
+    } else {
+      usage();
+      return 2;
+    }
+  }
+  if (check && script == nullptr) {
+    usage();
+    return 2;
+  }
+
+  hostHal.definePinName("A", ButtonHandler::BUTTON_A);
+  hostHal.definePinName("B", ButtonHandler::BUTTON_B);
+  hostHal.definePinName("LEFT", ButtonHandler::BUTTON_LEFT);
+  hostHal.definePinName("RIGHT", ButtonHandler::BUTTON_RIGHT);
+  hostHal.definePinName("UP", ButtonHandler::BUTTON_UP);
+  hostHal.definePinName("DOWN", ButtonHandler::BUTTON_DOWN);
+  hostHal.definePinName("IR", IR_RECEIVE_PIN);
+  hostHal.definePinName("ADC", SCOPE_PIN);
+
+  if (script != nullptr && !hostHal.loadScript(script)) {
+    fprintf(stderr, "neoos_sim: cannot load script %s\n", script);
+    return 1;
+  }
+  // Serial output is binary-safe in the log, e.g. for profiler dumps
+  FILE* serialFile = nullptr;
+  if (serialLog != nullptr) {
+    serialFile = fopen(serialLog, "wb");
+    if (serialFile == nullptr) {
+      fprintf(stderr, "neoos_sim: cannot write %s\n", serialLog);
+      return 1;
+    }
+    hostHal.setSerialOutput(serialFile);
+  } else {
+    hostHal.setSerialOutput(nullptr);
+    if (!quiet) {
+      hostHal.setSerialTap(decodeSerial);
+    }
+  }
+  if (gpioLogPath != nullptr) {
+    gpioLog = fopen(gpioLogPath, "w");
+    if (gpioLog == nullptr) {
+      fprintf(stderr, "neoos_sim: cannot write %s\n", gpioLogPath);
+      return 1;
+    }
+    hostHal.setPortTap(logPort);
+  }
+  hostHal.setTimeLimit(untilMs * 1000);
+
+  setup();
+  while (!hostHal.finished()) {
+    loop();
+  }
+
+  if (serialFile != nullptr) {
+    fclose(serialFile);
+  }
+  if (gpioLog != nullptr) {
+    fclose(gpioLog);
+  }
+  consoleLog.finish();
+  if (irLog != nullptr && !hostHal.writeIrLog(irLog)) {
+    fprintf(stderr, "neoos_sim: cannot write %s\n", irLog);
+    return 1;
+  }
+
+  // key=value lines so scripts can grep for what they need
+  const DisplayStats& stats = display.getStats();
+  uint64_t elapsedMs = hostHal.now() / 1000;
+  printStat("sim.time_ms", "%llu", (unsigned long long)elapsedMs);
+  printStat("sim.frames", "%u", (unsigned)stats.frames);
+  printStat("sim.frames_skipped", "%u", (unsigned)stats.framesSkipped);
+  printStat("sim.tiles_sent", "%u", (unsigned)stats.tilesSent);
+  printStat("sim.bytes_sent", "%u", (unsigned)stats.bytesSent);
+  printStat("sim.tiles_compared", "%u", (unsigned)stats.tilesCompared);
+  printStat("sim.layer_hits", "%u", (unsigned)stats.layerHits);
+  printStat("sim.layer_misses", "%u", (unsigned)stats.layerMisses);
+  const TextCacheStats& labels = display.getTextCacheStats();
+  printStat("sim.label_hits", "%u", (unsigned)labels.hits);
+  printStat("sim.label_misses", "%u", (unsigned)labels.misses);
+  printStat("sim.label_evictions", "%u", (unsigned)labels.evictions);
+  printStat("sim.label_bytes", "%u", (unsigned)labels.bytes);
+  printStat("sim.idle_pct", "%.1f", elapsedMs ? 100.0 * scheduler.getIdleTime() / elapsedMs : 0.0);
+  const FrameStats& frames = framePacer.getStats();
+  printStat("sim.frames_rendered", "%u", (unsigned)frames.frames);
+  printStat("sim.frames_missed", "%u", (unsigned)frames.missedDeadlines);
+  printStat("sim.frame_time_max_us", "%u", (unsigned)frames.maxFrameTime);
+  printStat("sim.frame_time_mean_us", "%u", frames.frames ? (unsigned)(frames.totalFrameTime / frames.frames) : 0U);
+  printStat("sim.input_latency_max_us", "%u", (unsigned)menuSystem.getMaxInputLatency());
+  printStat("sim.dropped_events", "%u", (unsigned)buttonHandler.getDroppedEvents());
+  printStat("sim.serial_bytes", "%u", (unsigned)hostHal.getSerialBytes());
+  printStat("sim.log_dropped", "%u", (unsigned)logger.getDropped());
+  printStat("sim.ir_frames_captured", "%u", (unsigned)irCapture.getFrames());
+  printStat("sim.ir_frames_dropped", "%u", (unsigned)irCapture.getDroppedFrames());
+  printStat("sim.ir_frames_sent", "%u", (unsigned)hostHal.getIrFrameCount());
+  printStat("sim.ir_tx_max_start_delay_us", "%u", (unsigned)irTxQueue.getMaxStartDelay());
+  printStat("sim.ir_tx_failed", "%u", (unsigned)irTxQueue.getFramesFailed());
+  printStat("sim.pin_writes", "%u", (unsigned)hostHal.getPinWrites());
+  printStat("sim.pattern_steps", "%u", (unsigned)patternGenerator.getStepsDone());
+  printStat("sim.pattern_late_steps", "%u", (unsigned)patternGenerator.getLateSteps());
+  printStat("sim.scope_sweeps", "%u", (unsigned)adcScope.getSweeps());
+  printStat("sim.scope_overflows", "%u", (unsigned)adcScope.getOverflows());
+  printStat("sim.ir_learned", "%u", (unsigned)irLearner.getLearned());
+  printStat("sim.ir_learn_duplicates", "%u", (unsigned)irLearner.getDuplicates());
+  printStat("sim.ir_learn_saved", "%u", (unsigned)irLearner.getSaved());
+  printStat("sim.ir_learn_failed", "%u", (unsigned)irLearner.getFailed());
+  printStat("sim.ir_library_codes", "%u", (unsigned)irLibrary.size());
+  return check && checkExpectations(script) > 0 ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,319 @@
+// Decodes Profiler dumps captured from the serial port (or from
+// neoos_sim --serial-log). The capture may contain ordinary text around
+// the dumps; every "NPRF" block in it is decoded.
+//
+//   neoos_profile_decode <capture> [--chrome trace.json] [--folded stacks.txt]
+//
+// Prints a per-span summary. --chrome writes a Chrome/Perfetto trace
+// (chrome://tracing, ui.perfetto.dev); --folded writes collapsed stacks
+// for flamegraph.pl or speedscope, weighted in microseconds.
+
+#include "Profiler.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+struct Span {
+  uint8_t id;
+  uint8_t context;  // 0 = loop task, 1 = another task
+  double start;     // us from the first record of the dump
+  double duration;
+  uint8_t depth;
+};
+
+struct Dump {
+  std::vector<std::string> names;
+  std::vector<Span> spans;
+  uint32_t overwritten;
+  double window;  // us covered by the records
+};
+
+static uint16_t getU16(const uint8_t* in) {
+  return in[0] | (in[1] << 8);
+}
+
+static uint32_t getU32(const uint8_t* in) {
+  return in[0] | (in[1] << 8) | (in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+struct Event {
+  double time;
+  uint8_t tag;
+};
+
+// Pair begin/end records per context into spans. Ends whose begin was
+// overwritten and begins still open at dump time are dropped.
+static void buildSpans(const std::vector<Event>& events, Dump& dump) {
+  for (uint8_t context = 0; context < 2; context++) {
+    std::vector<Event> stack;
+    for (size_t i = 0; i < events.size(); i++) {
+      const Event& event = events[i];
+      if (((event.tag & PROFILER_TAG_TASK) != 0) != (context == 1)) {
+        continue;
+      }
+      uint8_t id = event.tag & PROFILER_TAG_SPAN;
+      if (!(event.tag & PROFILER_TAG_END)) {
+        stack.push_back(event);
+        continue;
+      }
+      // Unwind to the matching begin, discarding unterminated inner spans
+      size_t match = stack.size();
+      while (match > 0 && (stack[match - 1].tag & PROFILER_TAG_SPAN) != id) {
+        match--;
+      }
+      if (match == 0) {
+        continue;
+      }
+      Span span;
+      span.id = id;
+      span.context = context;
+      span.start = stack[match - 1].time;
+      span.duration = event.time - span.start;
+      span.depth = match - 1;
+      dump.spans.push_back(span);
+      stack.resize(match - 1);
+    }
+  }
+  std::sort(dump.spans.begin(), dump.spans.end(), [](const Span& a, const Span& b) {
+    return a.start < b.start || (a.start == b.start && a.depth < b.depth);
+  });
+}
+
+// Returns the offset just past the dump, or 0 if the block is malformed
+static size_t parseDump(const std::vector<uint8_t>& data, size_t at, Dump& dump) {
+  if (at + PROFILER_HEADER_SIZE > data.size() || data[at + 4] != PROFILER_VERSION) {
+    return 0;
+  }
+  const uint8_t* header = &data[at];
+  uint8_t spanCount = header[5];
+  uint16_t recordCount = getU16(header + 6);
+  uint32_t tickRate = getU32(header + 8);
+  dump.overwritten = getU32(header + 12);
+  if (tickRate == 0) {
+    return 0;
+  }
+
+  size_t pos = at + PROFILER_HEADER_SIZE;
+  for (uint8_t i = 0; i < spanCount; i++) {
+    if (pos >= data.size() || pos + 1 + data[pos] > data.size()) {
+      return 0;
+    }
+    dump.names.push_back(std::string(data.begin() + pos + 1, data.begin() + pos + 1 + data[pos]));
+    pos += 1 + data[pos];
+  }
+  if (pos + (size_t)recordCount * PROFILER_RECORD_SIZE > data.size()) {
+    return 0;
+  }
+
+  // Unwrap the 32-bit counter; records from other tasks can be a little
+  // out of order, so deltas are signed
+  std::vector<Event> events;
+  int64_t ticks = 0;
+  uint32_t previous = recordCount > 0 ? getU32(&data[pos]) : 0;
+  for (uint16_t i = 0; i < recordCount; i++) {
+    const uint8_t* record = &data[pos + i * PROFILER_RECORD_SIZE];
+    uint32_t stamp = getU32(record);
+    ticks += (int32_t)(stamp - previous);
+    previous = stamp;
+    Event event;
+    event.time = ticks * 1e6 / tickRate;
+    event.tag = record[4];
+    events.push_back(event);
+  }
+  std::stable_sort(events.begin(), events.end(), [](const Event& a, const Event& b) {
+    return a.time < b.time;
+  });
+  dump.window = events.empty() ? 0 : events.back().time - events.front().time;
+  if (!events.empty() && events.front().time != 0) {
+    double origin = events.front().time;
+    for (size_t i = 0; i < events.size(); i++) {
+      events[i].time -= origin;
+    }
+  }
+
+  buildSpans(events, dump);
+  return pos + (size_t)recordCount * PROFILER_RECORD_SIZE;
+}
+
+static std::string spanLabel(const Dump& dump, uint8_t id) {
+  return id < dump.names.size() ? dump.names[id] : "span" + std::to_string(id);
+}
+
+static const char* contextName(uint8_t context) {
+  return context == 0 ? "loop" : "task";
+}
+
+static void printSummary(const std::vector<Dump>& dumps) {
+  struct Totals {
+    uint32_t count;
+    double total;
+    double max;
+  };
+  std::map<std::string, Totals> totals;
+  double window = 0;
+  uint32_t overwritten = 0;
+  for (size_t d = 0; d < dumps.size(); d++) {
+    window += dumps[d].window;
+    overwritten += dumps[d].overwritten;
+    for (size_t i = 0; i < dumps[d].spans.size(); i++) {
+      const Span& span = dumps[d].spans[i];
+      Totals& entry = totals[spanLabel(dumps[d], span.id)];
+      entry.count++;
+      entry.total += span.duration;
+      entry.max = std::max(entry.max, span.duration);
+    }
+  }
+
+  printf("dumps=%u window_us=%.0f overwritten=%u\n", (unsigned)dumps.size(), window, (unsigned)overwritten);
+  for (std::map<std::string, Totals>::const_iterator it = totals.begin(); it != totals.end(); ++it) {
+    const Totals& entry = it->second;
+    printf("span=%s count=%u total_us=%.1f mean_us=%.2f max_us=%.2f share_pct=%.2f\n",
+           it->first.c_str(), (unsigned)entry.count, entry.total, entry.total / entry.count, entry.max,
+           window > 0 ? 100.0 * entry.total / window : 0.0);
+  }
+}
+
+static bool writeChrome(const std::vector<Dump>& dumps, const char* path) {
+  FILE* out = fopen(path, "w");
+  if (out == nullptr) {
+    return false;
+  }
+  fprintf(out, "{\"traceEvents\":[\n");
+  bool first = true;
+  for (size_t d = 0; d < dumps.size(); d++) {
+    for (uint8_t context = 0; context < 2; context++) {
+      fprintf(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+              first ? "" : ",\n", (unsigned)d, (unsigned)context, contextName(context));
+      first = false;
+    }
+    for (size_t i = 0; i < dumps[d].spans.size(); i++) {
+      const Span& span = dumps[d].spans[i];
+      fprintf(out, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%u,\"tid\":%u}",
+              spanLabel(dumps[d], span.id).c_str(), span.start, span.duration, (unsigned)d,
+              (unsigned)span.context);
+    }
+  }
+  fprintf(out, "\n]}\n");
+  fclose(out);
+  return true;
+}
+
+// Collapsed stacks, self time only: "loop;render;flush 123"
+static bool writeFolded(const std::vector<Dump>& dumps, const char* path) {
+  std::map<std::string, double> stacks;
+  for (size_t d = 0; d < dumps.size(); d++) {
+    const std::vector<Span>& spans = dumps[d].spans;
+    for (uint8_t context = 0; context < 2; context++) {
+      // Spans are sorted by start, parents before children
+      std::vector<size_t> open;
+      std::vector<double> childTime(spans.size(), 0);
+      for (size_t i = 0; i < spans.size(); i++) {
+        if (spans[i].context != context) {
+          continue;
+        }
+        while (!open.empty() && spans[open.back()].start + spans[open.back()].duration <= spans[i].start) {
+          open.pop_back();
+        }
+        if (!open.empty()) {
+          childTime[open.back()] += spans[i].duration;
+        }
+        open.push_back(i);
+      }
+
+      open.clear();
+      for (size_t i = 0; i < spans.size(); i++) {
+        if (spans[i].context != context) {
+          continue;
+        }
+        while (!open.empty() && spans[open.back()].start + spans[open.back()].duration <= spans[i].start) {
+          open.pop_back();
+        }
+        open.push_back(i);
+        std::string key = contextName(context);
+        for (size_t j = 0; j < open.size(); j++) {
+          key += ";" + spanLabel(dumps[d], spans[open[j]].id);
+        }
+        stacks[key] += std::max(0.0, spans[i].duration - childTime[i]);
+      }
+    }
+  }
+
+  FILE* out = fopen(path, "w");
+  if (out == nullptr) {
+    return false;
+  }
+  for (std::map<std::string, double>::const_iterator it = stacks.begin(); it != stacks.end(); ++it) {
+    fprintf(out, "%s %.0f\n", it->first.c_str(), it->second);
+  }
+  fclose(out);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  const char* input = nullptr;
+  const char* chromePath = nullptr;
+  const char* foldedPath = nullptr;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--chrome") == 0 && i + 1 < argc) {
+      chromePath = argv[++i];
+    } else if (strcmp(argv[i], "--folded") == 0 && i + 1 < argc) {
+      foldedPath = argv[++i];
+    } else if (input == nullptr && argv[i][0] != '-') {
+      input = argv[i];
+    } else {
+      input = nullptr;
+      break;
+    }
+  }
+  if (input == nullptr) {
+    fprintf(stderr, "usage: neoos_profile_decode <capture> [--chrome trace.json] [--folded stacks.txt]\n");
+    return 2;
+  }
+
+  FILE* file = fopen(input, "rb");
+  if (file == nullptr) {
+    fprintf(stderr, "neoos_profile_decode: cannot read %s\n", input);
+    return 1;
+  }
+  std::vector<uint8_t> data;
+  uint8_t buffer[4096];
+  size_t length;
+  while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    data.insert(data.end(), buffer, buffer + length);
+  }
+  fclose(file);
+
+  std::vector<Dump> dumps;
+  size_t at = 0;
+  while (at + 4 <= data.size()) {
+    if (memcmp(&data[at], PROFILER_MAGIC, 4) != 0) {
+      at++;
+      continue;
+    }
+    Dump dump;
+    size_t next = parseDump(data, at, dump);
+    if (next == 0) {
+      at++;
+      continue;
+    }
+    dumps.push_back(dump);
+    at = next;
+  }
+  if (dumps.empty()) {
+    fprintf(stderr, "neoos_profile_decode: no profiler dump in %s\n", input);
+    return 1;
+  }
+
+  printSummary(dumps);
+  if (chromePath != nullptr && !writeChrome(dumps, chromePath)) {
+    fprintf(stderr, "neoos_profile_decode: cannot write %s\n", chromePath);
+    return 1;
+  }
+  if (foldedPath != nullptr && !writeFolded(dumps, foldedPath)) {
+    fprintf(stderr, "neoos_profile_decode: cannot write %s\n", foldedPath);
+    return 1;
+  }
+  return 0;
+}
\ No newline at end of file
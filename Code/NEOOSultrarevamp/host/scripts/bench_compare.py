@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""Compare two benchmark outputs made of "bench=<name> key=value ..." lines.
+
+    bench_compare.py baseline.txt candidate.txt [--threshold 10]
+
+Prints every numeric field that changed and exits with 1 when a time
+field got slower by more than the threshold (percent).
+"""
+import sys
+
+
+def load(path):
+    results = {}
+    with open(path) as f:
+        for line in f:
+            if line.startswith("#") or "bench=" not in line:
+                continue
+            fields = dict(token.split("=", 1) for token in line.split() if "=" in token)
+            results[fields.pop("bench")] = fields
+    return results
+
+
+def main(argv):
+    threshold = 10.0
+    paths = []
+    args = iter(argv[1:])
+    for arg in args:
+        if arg == "--threshold":
+            threshold = float(next(args))
+        else:
+            paths.append(arg)
+    if len(paths) != 2:
+        print(__doc__.strip(), file=sys.stderr)
+        return 2
+
+    baseline, candidate = load(paths[0]), load(paths[1])
+    regressed = False
+    for name in sorted(set(baseline) | set(candidate)):
+        if name not in baseline or name not in candidate:
+            print("%-24s %s" % (name, "added" if name in candidate else "removed"))
+            continue
+        for key, old in baseline[name].items():
+            new = candidate[name].get(key)
+            if new is None or not old.isdigit() or not new.isdigit() or old == new:
+                continue
+            old_value, new_value = int(old), int(new)
+            change = 100.0 * (new_value - old_value) / old_value if old_value else float("inf")
+            flag = ""
+            if key.startswith("time") and change > threshold:
+                flag = "  REGRESSION"
+                regressed = True
+            print("%-24s %-18s %10d -> %10d  %+7.1f%%%s" % (name, key, old_value, new_value, change, flag))
+    return 1 if regressed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
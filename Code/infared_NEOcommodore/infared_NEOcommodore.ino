@@ -21,6 +21,10 @@ U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE);
 #define DEBOUNCE_DELAY 200
 unsigned long lastButtonPress = 0;
 
+// Message screen shown by displayMessage()
+unsigned long messageShownAt = 0;
+unsigned long messageDuration = 0;
+
 // Menu constants
 #define MAX_MENU_ITEMS 5
 int currentMenuItem = 0;
@@ -119,9 +123,11 @@ void displayMessage(const char* line1, const char* line2 = nullptr, const char*
     }
     
     u8g2.sendBuffer();
-    if(duration > 0) {
-        delay(duration);
-    }
+
+    // Keep the message up for duration ms without blocking; loop() skips
+    // redrawing the menu until it expires
+    messageShownAt = millis();
+    messageDuration = duration > 0 ? duration : 0;
 }
 
 // IR Functions
@@ -170,8 +176,6 @@ void sendLastCode() {
         default:
             IrSender.sendNEC(lastIRCode, lastIRBits);
     }
-    
-    delay(1000);
 }
 
 
@@ -402,7 +406,9 @@ void setup() {
 
 void loop() {
     handleButtons();
-    drawMenu();
+    if (millis() - messageShownAt >= messageDuration) {
+        drawMenu();
+    }
     
     if(isButtonPressed(BTN_SELECT)) {
         handleMenuSelection();